@@ -621,3 +621,33 @@ function(add_cxx_test FILE_NAME)
   endif()
   message(STATUS "Configuring test ${FILE_NAME}: ...DONE")
 endfunction()
+
+# add_cxx_benchmark()
+# CMake function to generate and build C++ Google Benchmark micro-benchmark.
+# Parameters:
+#  the C++ filename
+# e.g.:
+# add_cxx_benchmark(foo_benchmark.cc)
+function(add_cxx_benchmark FILE_NAME)
+  message(STATUS "Configuring benchmark ${FILE_NAME}: ...")
+  get_filename_component(BENCHMARK_NAME ${FILE_NAME} NAME_WE)
+  get_filename_component(COMPONENT_DIR ${FILE_NAME} DIRECTORY)
+  get_filename_component(COMPONENT_NAME ${COMPONENT_DIR} NAME)
+
+  add_executable(${COMPONENT_NAME}_${BENCHMARK_NAME} ${FILE_NAME})
+  target_compile_features(${COMPONENT_NAME}_${BENCHMARK_NAME} PRIVATE cxx_std_17)
+  target_link_libraries(${COMPONENT_NAME}_${BENCHMARK_NAME} PRIVATE
+    ${PROJECT_NAMESPACE}::ortools
+    benchmark::benchmark_main
+  )
+  message(STATUS "Configuring benchmark ${FILE_NAME}: ...DONE")
+endfunction()
+
+if(BUILD_BENCHMARKS)
+  add_cxx_benchmark(${PROJECT_SOURCE_DIR}/ortools/glop/lu_factorization_benchmark.cc)
+  add_cxx_benchmark(${PROJECT_SOURCE_DIR}/ortools/sat/propagation_benchmark.cc)
+  add_cxx_benchmark(${PROJECT_SOURCE_DIR}/ortools/sat/scheduling_benchmark.cc)
+  if(USE_PDLP)
+    add_cxx_benchmark(${PROJECT_SOURCE_DIR}/ortools/pdlp/sharder_benchmark.cc)
+  endif()
+endif()
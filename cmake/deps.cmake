@@ -140,6 +140,10 @@ if(USE_SCIP)
   endif()
 endif()
 
+if(BUILD_BENCHMARKS)
+  find_package(benchmark REQUIRED)
+endif()
+
 # Check optional Dependencies
 if(USE_CPLEX)
   find_package(CPLEX REQUIRED)
@@ -125,6 +125,7 @@ void CreateJobs(const JsspInputProblem& problem, int64_t horizon,
     const Job& job = problem.jobs(j);
     const int num_tasks_in_job = job.tasks_size();
     std::vector<JobTaskData>& task_data = job_to_tasks[j];
+    task_data.reserve(num_tasks_in_job);
 
     const int64_t hard_start =
         job.has_earliest_start() ? job.earliest_start().value() : 0L;
@@ -138,6 +139,7 @@ void CreateJobs(const JsspInputProblem& problem, int64_t horizon,
 
       // Add the "main" task interval.
       std::vector<int64_t> durations;
+      durations.reserve(num_alternatives);
       int64_t min_duration = task.duration(0);
       int64_t max_duration = task.duration(0);
       durations.push_back(task.duration(0));
@@ -222,6 +224,7 @@ void CreateAlternativeTasks(
       CHECK_EQ(num_alternatives, task.duration_size());
       std::vector<AlternativeTaskData>& alternatives =
           job_task_to_alternatives[j][t];
+      alternatives.reserve(num_alternatives);
 
       if (num_alternatives == 1) {
         if (absl::GetFlag(FLAGS_use_variable_duration_to_encode_transition) &&
@@ -301,7 +304,16 @@ std::vector<std::vector<MachineTaskData>> GetDataPerMachine(
         job_task_to_alternatives) {
   const int num_jobs = problem.jobs_size();
   const int num_machines = problem.machines_size();
+  std::vector<int> num_tasks_per_machine(num_machines, 0);
+  for (const Job& job : problem.jobs()) {
+    for (const Task& task : job.tasks()) {
+      for (const int machine : task.machine()) ++num_tasks_per_machine[machine];
+    }
+  }
   std::vector<std::vector<MachineTaskData>> machine_to_tasks(num_machines);
+  for (int m = 0; m < num_machines; ++m) {
+    machine_to_tasks[m].reserve(num_tasks_per_machine[m]);
+  }
   for (int j = 0; j < num_jobs; ++j) {
     const Job& job = problem.jobs(j);
     const int num_tasks_in_job = job.tasks_size();
@@ -333,6 +345,7 @@ void CreateMachines(
   // Add one no_overlap constraint per machine.
   for (int m = 0; m < num_machines; ++m) {
     std::vector<IntervalVar> intervals;
+    intervals.reserve(machine_to_tasks[m].size() + 1);
     for (const MachineTaskData& task : machine_to_tasks[m]) {
       intervals.push_back(task.interval);
     }
@@ -650,6 +663,22 @@ void Solve(const JsspInputProblem& problem) {
                               ? absl::GetFlag(FLAGS_horizon)
                               : ComputeHorizon(problem);
 
+  // Preallocate the model from the problem size. Each task creates at most a
+  // start, a duration and an end variable, and each alternative a presence
+  // and a start variable.
+  int64_t num_tasks = 0;
+  int64_t num_alternatives = 0;
+  for (const Job& job : problem.jobs()) {
+    num_tasks += job.tasks_size();
+    for (const Task& task : job.tasks()) {
+      if (task.machine_size() > 1) num_alternatives += task.machine_size();
+    }
+  }
+  cp_model.MutableProto()->mutable_variables()->Reserve(
+      3 * num_tasks + 2 * num_alternatives);
+  cp_model.MutableProto()->mutable_constraints()->Reserve(
+      2 * num_tasks + 2 * num_alternatives + problem.machines_size());
+
   // Create the main job structure.
   const int num_jobs = problem.jobs_size();
   std::vector<std::vector<JobTaskData>> job_to_tasks(num_jobs);
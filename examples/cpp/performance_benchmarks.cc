@@ -0,0 +1,451 @@
+// Copyright 2010-2022 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Performance benchmark suite.
+//
+// Runs a fixed set of representative instances on several solvers of the
+// library (glop, pdlp, CP-SAT, routing, max flow, min cost flow, set cover)
+// with pinned parameters, and reports for each of them the wall time, the
+// deterministic time (when the solver has one), the number of iterations
+// (when meaningful), the peak resident memory and the objective, as JSON.
+//
+// The instances are generated from a fixed seed using only the raw output of
+// std::mt19937, which is specified by the standard, so they are identical on
+// all platforms. All the solvers run single-threaded and with work limits
+// rather than time limits, so that the objective and deterministic time are
+// reproducible and only the wall time and memory depend on the machine.
+//
+// Instances are small by default; use --scale to make them larger. The peak
+// memory is the one of the whole process, so to track it per benchmark, run
+// each benchmark in its own process, e.g.:
+//   performance_benchmarks --benchmarks=glop --scale=20 --output=glop.json
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+#include "absl/flags/flag.h"
+#include "absl/strings/str_format.h"
+#include "absl/strings/str_join.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
+#include "ortools/algorithms/set_cover.h"
+#include "ortools/algorithms/set_cover_ledger.h"
+#include "ortools/algorithms/set_cover_model.h"
+#include "ortools/base/file.h"
+#include "ortools/base/init_google.h"
+#include "ortools/base/logging.h"
+#include "ortools/base/sysinfo.h"
+#include "ortools/base/timer.h"
+#include "ortools/base/version.h"
+#include "ortools/constraint_solver/routing.h"
+#include "ortools/constraint_solver/routing_enums.pb.h"
+#include "ortools/constraint_solver/routing_index_manager.h"
+#include "ortools/constraint_solver/routing_parameters.h"
+#include "ortools/glop/lp_solver.h"
+#include "ortools/glop/parameters.pb.h"
+#include "ortools/graph/max_flow.h"
+#include "ortools/graph/min_cost_flow.h"
+#include "ortools/linear_solver/linear_solver.h"
+#include "ortools/linear_solver/linear_solver.pb.h"
+#include "ortools/lp_data/lp_data.h"
+#include "ortools/lp_data/proto_utils.h"
+#include "ortools/sat/cp_model.h"
+#include "ortools/sat/cp_model.pb.h"
+#include "ortools/sat/cp_model_solver.h"
+#include "ortools/sat/sat_parameters.pb.h"
+
+ABSL_FLAG(std::string, benchmarks, "",
+          "Comma-separated list of benchmarks to run. Empty means all of them: "
+          "glop, pdlp, cp_sat, routing, max_flow, min_cost_flow, set_cover.");
+ABSL_FLAG(int, scale, 1,
+          "Multiplies the size of all the instances. The default is small "
+          "enough for a smoke test.");
+ABSL_FLAG(std::string, output, "",
+          "If not empty, the JSON report is written to this file instead of "
+          "stdout.");
+
+namespace operations_research {
+namespace {
+
+constexpr uint32_t kSeed = 12345;
+
+struct BenchmarkResult {
+  std::string name;
+  std::string status;
+  double objective = 0.0;
+  double wall_time = 0.0;
+  // Negative when the solver does not report it.
+  double deterministic_time = -1.0;
+  int64_t iterations = -1;
+  int64_t peak_rss_bytes = 0;
+};
+
+// Returns a number in [0, n). The bias of the modulo does not matter here,
+// what matters is that the sequence does not depend on the platform.
+int64_t Draw(std::mt19937& random, int64_t n) { return random() % n; }
+
+int64_t PeakMemoryUsage() {
+#if defined(__linux__) || defined(__APPLE__)
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#if defined(__APPLE__)
+    return usage.ru_maxrss;
+#else
+    return int64_t{1024} * usage.ru_maxrss;
+#endif
+  }
+#endif
+  return GetProcessMemoryUsage();
+}
+
+// A covering LP: min c.x s.t. A.x >= b, 0 <= x <= 10, with A, b, c >= 0.
+// It is feasible (x = 10 satisfies all the constraints) and bounded.
+MPModelProto RandomCoveringLp(int num_rows, int num_cols) {
+  std::mt19937 random(kSeed);
+  MPModelProto model;
+  for (int col = 0; col < num_cols; ++col) {
+    MPVariableProto* var = model.add_variable();
+    var->set_lower_bound(0.0);
+    var->set_upper_bound(10.0);
+    var->set_objective_coefficient(1 + Draw(random, 100));
+  }
+  for (int row = 0; row < num_rows; ++row) {
+    // Merges the duplicate columns, glop expects a clean matrix.
+    std::map<int, int64_t> terms;
+    int64_t sum = 0;
+    for (int k = 0; k < 10; ++k) {
+      const int64_t coeff = 1 + Draw(random, 20);
+      terms[Draw(random, num_cols)] += coeff;
+      sum += coeff;
+    }
+    MPConstraintProto* ct = model.add_constraint();
+    for (const auto& [col, coeff] : terms) {
+      ct->add_var_index(col);
+      ct->add_coefficient(coeff);
+    }
+    ct->set_lower_bound(sum * (1 + Draw(random, 9)));
+    ct->set_upper_bound(std::numeric_limits<double>::infinity());
+  }
+  return model;
+}
+
+BenchmarkResult RunGlop(int scale) {
+  const MPModelProto model = RandomCoveringLp(500 * scale, 1000 * scale);
+  glop::LinearProgram lp;
+  glop::MPModelProtoToLinearProgram(model, &lp);
+  glop::GlopParameters params;
+  params.set_random_seed(kSeed);
+
+  BenchmarkResult result;
+  WallTimer timer;
+  timer.Start();
+  glop::LPSolver solver;
+  solver.SetParameters(params);
+  const glop::ProblemStatus status = solver.Solve(lp);
+  result.wall_time = timer.Get();
+  result.status = glop::GetProblemStatusString(status);
+  result.objective = solver.GetObjectiveValue();
+  result.deterministic_time = solver.DeterministicTime();
+  result.iterations = solver.GetNumberOfSimplexIterations();
+  return result;
+}
+
+BenchmarkResult RunPdlp(int scale) {
+  BenchmarkResult result;
+  if (!MPSolver::SupportsProblemType(MPSolver::PDLP_LINEAR_PROGRAMMING)) {
+    result.status = "NOT_AVAILABLE";
+    return result;
+  }
+  const MPModelProto model = RandomCoveringLp(500 * scale, 1000 * scale);
+  MPSolver solver("pdlp_benchmark", MPSolver::PDLP_LINEAR_PROGRAMMING);
+  std::string error;
+  CHECK_EQ(solver.LoadModelFromProto(model, &error),
+           MPSOLVER_MODEL_IS_VALID)
+      << error;
+  CHECK(solver.SetSolverSpecificParametersAsString(
+      "num_threads: 1 "
+      "termination_criteria { iteration_limit: 100000"
+      " simple_optimality_criteria {"
+      " eps_optimal_absolute: 1e-6 eps_optimal_relative: 1e-6 } }"));
+
+  WallTimer timer;
+  timer.Start();
+  const MPSolver::ResultStatus status = solver.Solve();
+  result.wall_time = timer.Get();
+  result.status = MPSolverResponseStatus_Name(
+      static_cast<MPSolverResponseStatus>(status));
+  result.objective = solver.Objective().Value();
+  result.iterations = solver.iterations();
+  return result;
+}
+
+// A multi-dimensional knapsack.
+BenchmarkResult RunCpSat(int scale) {
+  std::mt19937 random(kSeed);
+  const int num_items = 30 * scale;
+  const int num_dimensions = 5;
+  sat::CpModelBuilder cp_model;
+  std::vector<sat::BoolVar> take;
+  std::vector<int64_t> values;
+  for (int i = 0; i < num_items; ++i) {
+    take.push_back(cp_model.NewBoolVar());
+    values.push_back(1 + Draw(random, 100));
+  }
+  for (int d = 0; d < num_dimensions; ++d) {
+    std::vector<int64_t> weights;
+    int64_t total = 0;
+    for (int i = 0; i < num_items; ++i) {
+      weights.push_back(1 + Draw(random, 100));
+      total += weights.back();
+    }
+    cp_model.AddLessOrEqual(sat::LinearExpr::WeightedSum(take, weights),
+                            total / 4);
+  }
+  cp_model.Maximize(sat::LinearExpr::WeightedSum(take, values));
+
+  sat::SatParameters params;
+  params.set_num_workers(1);
+  params.set_random_seed(kSeed);
+  params.set_max_deterministic_time(5.0);
+
+  BenchmarkResult result;
+  WallTimer timer;
+  timer.Start();
+  const sat::CpSolverResponse response =
+      sat::SolveWithParameters(cp_model.Build(), params);
+  result.wall_time = timer.Get();
+  result.status = sat::CpSolverStatus_Name(response.status());
+  result.objective = response.objective_value();
+  result.deterministic_time = response.deterministic_time();
+  result.iterations = response.num_branches();
+  return result;
+}
+
+// A TSP on random points with Manhattan distances, solved up to a local
+// optimum so that the result does not depend on the machine speed.
+BenchmarkResult RunRouting(int scale) {
+  std::mt19937 random(kSeed);
+  const int num_nodes = 100 * scale;
+  std::vector<std::pair<int64_t, int64_t>> points;
+  for (int i = 0; i < num_nodes; ++i) {
+    points.push_back({Draw(random, 1000), Draw(random, 1000)});
+  }
+  RoutingIndexManager manager(num_nodes, 1, RoutingIndexManager::NodeIndex(0));
+  RoutingModel routing(manager);
+  const int transit = routing.RegisterTransitCallback(
+      [&manager, &points](int64_t from, int64_t to) {
+        const auto& a = points[manager.IndexToNode(from).value()];
+        const auto& b = points[manager.IndexToNode(to).value()];
+        return std::abs(a.first - b.first) + std::abs(a.second - b.second);
+      });
+  routing.SetArcCostEvaluatorOfAllVehicles(transit);
+  RoutingSearchParameters params = DefaultRoutingSearchParameters();
+  params.set_first_solution_strategy(FirstSolutionStrategy::PATH_CHEAPEST_ARC);
+  params.set_local_search_metaheuristic(
+      LocalSearchMetaheuristic::GREEDY_DESCENT);
+
+  BenchmarkResult result;
+  WallTimer timer;
+  timer.Start();
+  const Assignment* solution = routing.SolveWithParameters(params);
+  result.wall_time = timer.Get();
+  result.status = solution != nullptr ? "FEASIBLE" : "NO_SOLUTION";
+  if (solution != nullptr) result.objective = solution->ObjectiveValue();
+  result.iterations = routing.solver()->branches();
+  return result;
+}
+
+// A layered graph from node 0 to the last node.
+BenchmarkResult RunMaxFlow(int scale) {
+  std::mt19937 random(kSeed);
+  const int num_layers = 20;
+  const int layer_size = 500 * scale;
+  const int source = 0;
+  const int sink = num_layers * layer_size + 1;
+  SimpleMaxFlow max_flow;
+  for (int i = 0; i < layer_size; ++i) {
+    max_flow.AddArcWithCapacity(source, 1 + i, 1 + Draw(random, 1000));
+    max_flow.AddArcWithCapacity((num_layers - 1) * layer_size + 1 + i, sink,
+                                1 + Draw(random, 1000));
+  }
+  for (int layer = 0; layer + 1 < num_layers; ++layer) {
+    for (int i = 0; i < layer_size; ++i) {
+      const int tail = 1 + layer * layer_size + i;
+      for (int k = 0; k < 5; ++k) {
+        const int head =
+            1 + (layer + 1) * layer_size + Draw(random, layer_size);
+        max_flow.AddArcWithCapacity(tail, head, 1 + Draw(random, 1000));
+      }
+    }
+  }
+
+  BenchmarkResult result;
+  WallTimer timer;
+  timer.Start();
+  const SimpleMaxFlow::Status status = max_flow.Solve(source, sink);
+  result.wall_time = timer.Get();
+  result.status = status == SimpleMaxFlow::OPTIMAL ? "OPTIMAL" : "ERROR";
+  result.objective = max_flow.OptimalFlow();
+  return result;
+}
+
+// A transportation problem between random supplies and demands.
+BenchmarkResult RunMinCostFlow(int scale) {
+  std::mt19937 random(kSeed);
+  const int num_sources = 100 * scale;
+  const int num_sinks = 100 * scale;
+  SimpleMinCostFlow min_cost_flow;
+  int64_t total_supply = 0;
+  for (int i = 0; i < num_sources; ++i) {
+    const int64_t supply = 1 + Draw(random, 100);
+    min_cost_flow.SetNodeSupply(i, supply);
+    total_supply += supply;
+  }
+  // Spread the total supply over the sinks so that the problem is balanced.
+  for (int j = 0; j < num_sinks; ++j) {
+    const int64_t demand =
+        total_supply / num_sinks + (j < total_supply % num_sinks ? 1 : 0);
+    min_cost_flow.SetNodeSupply(num_sources + j, -demand);
+  }
+  for (int i = 0; i < num_sources; ++i) {
+    for (int j = 0; j < num_sinks; ++j) {
+      min_cost_flow.AddArcWithCapacityAndUnitCost(i, num_sources + j, 100,
+                                                  1 + Draw(random, 1000));
+    }
+  }
+
+  BenchmarkResult result;
+  WallTimer timer;
+  timer.Start();
+  const SimpleMinCostFlow::Status status = min_cost_flow.Solve();
+  result.wall_time = timer.Get();
+  result.status =
+      status == SimpleMinCostFlow::OPTIMAL ? "OPTIMAL" : "NOT_OPTIMAL";
+  result.objective = min_cost_flow.OptimalCost();
+  return result;
+}
+
+// Random subsets, each element being in at least one of them.
+BenchmarkResult RunSetCover(int scale) {
+  std::mt19937 random(kSeed);
+  const int num_elements = 1000 * scale;
+  const int num_subsets = 5000 * scale;
+  SetCoverModel model;
+  for (int s = 0; s < num_subsets; ++s) {
+    model.AddEmptySubset(1 + Draw(random, 100));
+    const int size = 1 + Draw(random, 20);
+    for (int k = 0; k < size; ++k) {
+      // Make sure all the elements are covered by the first subsets.
+      const int element = s < num_elements && k == 0
+                              ? s
+                              : static_cast<int>(Draw(random, num_elements));
+      model.AddElementToLastSubset(element);
+    }
+  }
+  CHECK(model.ComputeFeasibility());
+
+  BenchmarkResult result;
+  WallTimer timer;
+  timer.Start();
+  SetCoverLedger ledger(&model);
+  GreedySolutionGenerator greedy(&ledger);
+  CHECK(greedy.NextSolution());
+  SteepestSearch steepest(&ledger);
+  steepest.NextSolution(10000);
+  result.wall_time = timer.Get();
+  result.status = ledger.CheckSolution() ? "FEASIBLE" : "INVALID";
+  result.objective = ledger.cost();
+  return result;
+}
+
+std::string ToJson(const std::vector<BenchmarkResult>& results, int scale) {
+  std::vector<std::string> entries;
+  for (const BenchmarkResult& r : results) {
+    entries.push_back(absl::StrFormat(
+        "    {\"name\": \"%s\", \"status\": \"%s\", \"objective\": %.17g, "
+        "\"wall_time_sec\": %.6f, \"deterministic_time\": %.6f, "
+        "\"iterations\": %d, \"peak_rss_bytes\": %d}",
+        r.name, r.status, r.objective, r.wall_time, r.deterministic_time,
+        r.iterations, r.peak_rss_bytes));
+  }
+  return absl::StrFormat(
+      "{\n  \"or_tools_version\": \"%s\",\n  \"scale\": %d,\n"
+      "  \"benchmarks\": [\n%s\n  ]\n}\n",
+      OrToolsVersionString(), scale, absl::StrJoin(entries, ",\n"));
+}
+
+void RunBenchmarks() {
+  const std::vector<std::pair<std::string, std::function<BenchmarkResult(int)>>>
+      kBenchmarks = {
+          {"glop", RunGlop},           {"pdlp", RunPdlp},
+          {"cp_sat", RunCpSat},        {"routing", RunRouting},
+          {"max_flow", RunMaxFlow},    {"min_cost_flow", RunMinCostFlow},
+          {"set_cover", RunSetCover},
+      };
+  const std::vector<std::string> selected =
+      absl::StrSplit(absl::GetFlag(FLAGS_benchmarks), ',', absl::SkipEmpty());
+  for (const std::string& name : selected) {
+    bool found = false;
+    for (const auto& [benchmark_name, unused] : kBenchmarks) {
+      found |= benchmark_name == name;
+    }
+    if (!found) LOG(FATAL) << "Unknown benchmark: " << name;
+  }
+
+  const int scale = absl::GetFlag(FLAGS_scale);
+  CHECK_GE(scale, 1);
+  std::vector<BenchmarkResult> results;
+  for (const auto& [name, run] : kBenchmarks) {
+    if (!selected.empty() &&
+        std::find(selected.begin(), selected.end(), name) == selected.end()) {
+      continue;
+    }
+    LOG(INFO) << "Running " << name;
+    BenchmarkResult result = run(scale);
+    result.name = name;
+    result.peak_rss_bytes = PeakMemoryUsage();
+    LOG(INFO) << name << ": " << result.status << " in " << result.wall_time
+              << "s";
+    results.push_back(std::move(result));
+  }
+
+  const std::string json = ToJson(results, scale);
+  const std::string& output = absl::GetFlag(FLAGS_output);
+  if (output.empty()) {
+    std::fputs(json.c_str(), stdout);
+  } else {
+    CHECK_OK(file::SetContents(output, json, file::Defaults()));
+  }
+}
+
+}  // namespace
+}  // namespace operations_research
+
+int main(int argc, char** argv) {
+  InitGoogle(argv[0], &argc, &argv, true);
+  operations_research::RunBenchmarks();
+  return EXIT_SUCCESS;
+}
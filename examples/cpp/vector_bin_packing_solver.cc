@@ -28,6 +28,7 @@
 #include "ortools/base/timer.h"
 #include "ortools/packing/arc_flow_builder.h"
 #include "ortools/packing/arc_flow_solver.h"
+#include "ortools/packing/column_generation_solver.h"
 #include "ortools/packing/vector_bin_packing.pb.h"
 #include "ortools/packing/vector_bin_packing_parser.h"
 
@@ -40,6 +41,9 @@ ABSL_FLAG(int, threads, 1, "Number of threads");
 ABSL_FLAG(bool, display_proto, false, "Print the input protobuf");
 ABSL_FLAG(int, max_bins, -1,
           "Maximum number of bins: default = -1 meaning no limits");
+ABSL_FLAG(bool, column_generation, false,
+          "Use column generation instead of the arc-flow model. This scales "
+          "to larger instances but does not always prove optimality.");
 
 namespace operations_research {
 void ParseAndSolve(const std::string& filename, absl::string_view solver,
@@ -79,9 +83,13 @@ void ParseAndSolve(const std::string& filename, absl::string_view solver,
   MPSolver::OptimizationProblemType solver_type;
   MPSolver::ParseSolverType(solver, &solver_type);
   packing::vbp::VectorBinPackingSolution solution =
-      packing::SolveVectorBinPackingWithArcFlow(
-          data, solver_type, params, absl::GetFlag(FLAGS_time_limit),
-          absl::GetFlag(FLAGS_threads), absl::GetFlag(FLAGS_max_bins));
+      absl::GetFlag(FLAGS_column_generation)
+          ? packing::SolveVectorBinPackingWithColumnGeneration(
+                data, solver_type, params, absl::GetFlag(FLAGS_time_limit),
+                absl::GetFlag(FLAGS_threads), absl::GetFlag(FLAGS_max_bins))
+          : packing::SolveVectorBinPackingWithArcFlow(
+                data, solver_type, params, absl::GetFlag(FLAGS_time_limit),
+                absl::GetFlag(FLAGS_threads), absl::GetFlag(FLAGS_max_bins));
   if (!solution.bins().empty()) {
     for (int b = 0; b < solution.bins_size(); ++b) {
       LOG(INFO) << "Bin " << b;
@@ -19,6 +19,7 @@
 #include <utility>
 #include <vector>
 
+#include "absl/numeric/bits.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/str_join.h"
 #include "ortools/base/murmur.h"
@@ -126,9 +127,22 @@ void DynamicPartition::Refine(const std::vector<int>& distinguished_subset) {
   }
 
   // Sort affected parts. This is important to behave as advertised in the .h.
-  // TODO(user): automatically switch to an O(N) sort when it's faster
-  // than this one, which is O(K log K) with K = tmp_affected_parts_.size().
-  std::sort(tmp_affected_parts_.begin(), tmp_affected_parts_.end());
+  // When a large fraction of the parts are affected, scanning all the counters
+  // in O(NumParts()) is cheaper than the O(K log K) sort, with
+  // K = tmp_affected_parts_.size().
+  const int num_affected_parts = tmp_affected_parts_.size();
+  const int num_parts = NumParts();
+  if (num_affected_parts > 1 &&
+      static_cast<int64_t>(num_affected_parts) *
+              absl::bit_width(static_cast<uint32_t>(num_affected_parts)) >
+          num_parts) {
+    tmp_affected_parts_.clear();
+    for (int part = 0; part < num_parts; ++part) {
+      if (tmp_counter_of_part_[part] > 0) tmp_affected_parts_.push_back(part);
+    }
+  } else {
+    std::sort(tmp_affected_parts_.begin(), tmp_affected_parts_.end());
+  }
 
   // Iterate on each affected part and split it, or keep it intact if all
   // of its elements were distinguished.
@@ -143,22 +157,21 @@ void DynamicPartition::Refine(const std::vector<int>& distinguished_subset) {
     // Do nothing if all elements were distinguished.
     if (split_index == start_index) continue;
 
-    // Compute the fingerprint of the new part.
+    // Compute the fingerprint of the new part, and move its elements to it, in
+    // a single pass over them.
+    const int new_part = NumParts();
     uint64_t new_fprint = 0;
     for (int i = split_index; i < end_index; ++i) {
-      new_fprint ^= FprintOfInt32(element_[i]);
+      const int element = element_[i];
+      new_fprint ^= FprintOfInt32(element);
+      part_of_[element] = new_part;
     }
 
-    const int new_part = NumParts();
-
     // Perform the split.
     part_[part].end_index = split_index;
     part_[part].fprint ^= new_fprint;
     part_.push_back(Part(/*start_index*/ split_index, /*end_index*/ end_index,
                          /*parent_part*/ part, new_fprint));
-    for (const int element : ElementsInPart(new_part)) {
-      part_of_[element] = new_part;
-    }
   }
 }
 
@@ -23,6 +23,7 @@
 #include "absl/random/bit_gen_ref.h"
 #include "absl/random/random.h"
 #include "absl/strings/str_join.h"
+#include "benchmark/benchmark.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "ortools/base/stl_util.h"
@@ -438,5 +439,38 @@ TEST(SimpleDynamicPartitionTest, BasicTest) {
   EXPECT_EQ(1, partition.SizeOfPart(2));
 }
 
+// Measures the throughput of Refine() on a large partition: each iteration
+// refines by a random subset of the given size, and undoes everything once the
+// partition has too many parts, like the graph symmetry finder does.
+void BM_Refine(benchmark::State& state) {
+  const int num_elements = state.range(0);
+  const int subset_size = state.range(1);
+  std::mt19937 random(12345);
+  std::vector<std::vector<int>> subsets(16);
+  for (std::vector<int>& subset : subsets) {
+    for (int i = 0; i < subset_size; ++i) {
+      subset.push_back(absl::Uniform(random, 0, num_elements));
+    }
+    gtl::STLSortAndRemoveDuplicates(&subset);
+  }
+  DynamicPartition partition(num_elements);
+  int index = 0;
+  for (auto _ : state) {
+    partition.Refine(subsets[index]);
+    if (++index == static_cast<int>(subsets.size())) {
+      index = 0;
+      partition.UndoRefineUntilNumPartsEqual(1);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * subset_size);
+}
+
+BENCHMARK(BM_Refine)
+    ->ArgPair(1000, 1)
+    ->ArgPair(1000, 100)
+    ->ArgPair(1000000, 1)
+    ->ArgPair(1000000, 1000)
+    ->ArgPair(1000000, 100000);
+
 }  // namespace
 }  // namespace operations_research
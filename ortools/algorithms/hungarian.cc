@@ -687,4 +687,130 @@ void MaximizeLinearAssignment(
   }
 }
 
+namespace {
+
+// O(n^2 * m) shortest augmenting path algorithm on a dense n x m cost matrix,
+// with n <= m: rows are added one by one, and each one is assigned along a
+// shortest alternating path with respect to the reduced costs given by the
+// dual potentials. This is the core of the Jonker-Volgenant algorithm, without
+// its initialization heuristics. Returns the row assigned to each column, or
+// -1 for the unassigned columns.
+//
+// 'cost(row, col)' returns the cost of the given cell, this allows to run the
+// algorithm on the transposed and/or negated matrix without copying it.
+template <typename CostFunction>
+std::vector<int> ShortestAugmentingPathAssignment(int num_rows, int num_cols,
+                                                  const CostFunction& cost) {
+  DCHECK_LE(num_rows, num_cols);
+  const double kInfinity = std::numeric_limits<double>::infinity();
+  // Column num_cols is a virtual column from which each augmenting path starts.
+  const int root = num_cols;
+  std::vector<double> row_potential(num_rows, 0.0);
+  std::vector<double> col_potential(num_cols + 1, 0.0);
+  std::vector<int> col_to_row(num_cols + 1, -1);
+  std::vector<int> previous_col(num_cols + 1, root);
+  std::vector<double> min_reduced_cost(num_cols + 1);
+  std::vector<bool> col_visited(num_cols + 1);
+  for (int new_row = 0; new_row < num_rows; ++new_row) {
+    col_to_row[root] = new_row;
+    std::fill(min_reduced_cost.begin(), min_reduced_cost.end(), kInfinity);
+    std::fill(col_visited.begin(), col_visited.end(), false);
+    int current_col = root;
+    do {
+      col_visited[current_col] = true;
+      const int row = col_to_row[current_col];
+      double delta = kInfinity;
+      int next_col = -1;
+      for (int col = 0; col < num_cols; ++col) {
+        if (col_visited[col]) continue;
+        const double reduced_cost =
+            cost(row, col) - row_potential[row] - col_potential[col];
+        if (reduced_cost < min_reduced_cost[col]) {
+          min_reduced_cost[col] = reduced_cost;
+          previous_col[col] = current_col;
+        }
+        if (min_reduced_cost[col] < delta) {
+          delta = min_reduced_cost[col];
+          next_col = col;
+        }
+      }
+      DCHECK_NE(next_col, -1);
+      for (int col = 0; col <= num_cols; ++col) {
+        if (col_visited[col]) {
+          row_potential[col_to_row[col]] += delta;
+          col_potential[col] -= delta;
+        } else {
+          min_reduced_cost[col] -= delta;
+        }
+      }
+      current_col = next_col;
+    } while (col_to_row[current_col] != -1);
+    // Augment along the path found.
+    while (current_col != root) {
+      const int col = previous_col[current_col];
+      col_to_row[current_col] = col_to_row[col];
+      current_col = col;
+    }
+  }
+  col_to_row.pop_back();
+  return col_to_row;
+}
+
+void DenseLinearAssignment(const std::vector<std::vector<double>>& cost,
+                           bool maximize,
+                           absl::flat_hash_map<int, int>* direct_assignment,
+                           absl::flat_hash_map<int, int>* reverse_assignment) {
+  if (InputContainsNan(cost)) {
+    LOG(ERROR) << "Returning before invoking the dense assignment solver.";
+    return;
+  }
+  const int num_agents = cost.size();
+  const int num_tasks = num_agents == 0 ? 0 : cost[0].size();
+  if (num_agents == 0 || num_tasks == 0) return;
+  const double sign = maximize ? -1.0 : 1.0;
+  if (num_agents <= num_tasks) {
+    const std::vector<int> task_to_agent = ShortestAugmentingPathAssignment(
+        num_agents, num_tasks,
+        [&cost, sign](int agent, int task) {
+          return sign * cost[agent][task];
+        });
+    for (int task = 0; task < num_tasks; ++task) {
+      const int agent = task_to_agent[task];
+      if (agent == -1) continue;
+      (*direct_assignment)[agent] = task;
+      (*reverse_assignment)[task] = agent;
+    }
+  } else {
+    const std::vector<int> agent_to_task = ShortestAugmentingPathAssignment(
+        num_tasks, num_agents,
+        [&cost, sign](int task, int agent) {
+          return sign * cost[agent][task];
+        });
+    for (int agent = 0; agent < num_agents; ++agent) {
+      const int task = agent_to_task[agent];
+      if (task == -1) continue;
+      (*direct_assignment)[agent] = task;
+      (*reverse_assignment)[task] = agent;
+    }
+  }
+}
+
+}  // namespace
+
+void MinimizeDenseLinearAssignment(
+    const std::vector<std::vector<double>>& cost,
+    absl::flat_hash_map<int, int>* direct_assignment,
+    absl::flat_hash_map<int, int>* reverse_assignment) {
+  DenseLinearAssignment(cost, /*maximize=*/false, direct_assignment,
+                        reverse_assignment);
+}
+
+void MaximizeDenseLinearAssignment(
+    const std::vector<std::vector<double>>& cost,
+    absl::flat_hash_map<int, int>* direct_assignment,
+    absl::flat_hash_map<int, int>* reverse_assignment) {
+  DenseLinearAssignment(cost, /*maximize=*/true, direct_assignment,
+                        reverse_assignment);
+}
+
 }  // namespace operations_research
@@ -56,6 +56,22 @@ void MaximizeLinearAssignment(
     absl::flat_hash_map<int, int>* direct_assignment,
     absl::flat_hash_map<int, int>* reverse_assignment);
 
+// Same as above, but using an O(n^3) shortest augmenting path algorithm (the
+// core of the Jonker-Volgenant algorithm) instead of the O(n^4) Hungarian
+// method. This is the method of choice for dense, mid-sized problems; for
+// sparse problems, LinearSumAssignment in graph/linear_assignment.h is usually
+// faster. All the costs must be finite. The returned assignment is optimal,
+// but in case of ties it may differ from the one of the functions above.
+void MinimizeDenseLinearAssignment(
+    const std::vector<std::vector<double> >& cost,
+    absl::flat_hash_map<int, int>* direct_assignment,
+    absl::flat_hash_map<int, int>* reverse_assignment);
+
+void MaximizeDenseLinearAssignment(
+    const std::vector<std::vector<double> >& cost,
+    absl::flat_hash_map<int, int>* direct_assignment,
+    absl::flat_hash_map<int, int>* reverse_assignment);
+
 }  // namespace operations_research
 
 #endif  // OR_TOOLS_ALGORITHMS_HUNGARIAN_H_
@@ -15,6 +15,7 @@
 
 #include "ortools/algorithms/hungarian.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <random>
@@ -170,4 +171,82 @@ TEST(LinearAssignmentTest, Small4x3Matrix) {
 
 #undef MATRIX_TEST
 
+double AssignmentCost(const std::vector<std::vector<double>>& cost,
+                      const absl::flat_hash_map<int, int>& direct_assignment) {
+  double total = 0.0;
+  for (const auto& [agent, task] : direct_assignment) {
+    total += cost[agent][task];
+  }
+  return total;
+}
+
+TEST(DenseLinearAssignmentTest, Small4x4Matrix) {
+  const std::vector<std::vector<double>> cost = {{90, 75, 75, 80},
+                                                 {35, 85, 55, 65},
+                                                 {125, 95, 90, 105},
+                                                 {45, 110, 95, 115}};
+  absl::flat_hash_map<int, int> direct_assignment;
+  absl::flat_hash_map<int, int> reverse_assignment;
+  MinimizeDenseLinearAssignment(cost, &direct_assignment, &reverse_assignment);
+  // There are two optimal assignments: {3, 2, 1, 0} and {1, 3, 2, 0}.
+  EXPECT_EQ(direct_assignment.size(), 4);
+  EXPECT_EQ(reverse_assignment.size(), 4);
+  EXPECT_EQ(AssignmentCost(cost, direct_assignment), 275);
+  MaximizeDenseLinearAssignment(cost, &direct_assignment, &reverse_assignment);
+  const int expected_agents_for_max[] = {0, 1, 2, 3};
+  const int expected_tasks_for_max[] = {2, 1, 0, 3};
+  GenericCheck(4, direct_assignment, reverse_assignment,
+               expected_agents_for_max, expected_tasks_for_max);
+}
+
+TEST(DenseLinearAssignmentTest, NullAndInvalidMatrix) {
+  absl::flat_hash_map<int, int> direct_assignment;
+  absl::flat_hash_map<int, int> reverse_assignment;
+  MinimizeDenseLinearAssignment({}, &direct_assignment, &reverse_assignment);
+  EXPECT_TRUE(direct_assignment.empty());
+  MaximizeDenseLinearAssignment({{1, 2}, {-std::sqrt(-1), 3}},
+                                &direct_assignment, &reverse_assignment);
+  EXPECT_TRUE(direct_assignment.empty());
+}
+
+TEST(DenseLinearAssignmentTest, RandomMatricesMatchHungarian) {
+  std::mt19937 random(12345);
+  for (int num_agents = 1; num_agents <= 12; ++num_agents) {
+    for (int num_tasks = 1; num_tasks <= 12; ++num_tasks) {
+      std::vector<std::vector<double>> cost(num_agents,
+                                            std::vector<double>(num_tasks));
+      for (std::vector<double>& row : cost) {
+        for (double& value : row) value = absl::Uniform(random, 0, 100);
+      }
+      for (const bool maximize : {false, true}) {
+        absl::flat_hash_map<int, int> direct_assignment;
+        absl::flat_hash_map<int, int> reverse_assignment;
+        absl::flat_hash_map<int, int> dense_direct_assignment;
+        absl::flat_hash_map<int, int> dense_reverse_assignment;
+        if (maximize) {
+          MaximizeLinearAssignment(cost, &direct_assignment,
+                                   &reverse_assignment);
+          MaximizeDenseLinearAssignment(cost, &dense_direct_assignment,
+                                        &dense_reverse_assignment);
+        } else {
+          MinimizeLinearAssignment(cost, &direct_assignment,
+                                   &reverse_assignment);
+          MinimizeDenseLinearAssignment(cost, &dense_direct_assignment,
+                                        &dense_reverse_assignment);
+        }
+        EXPECT_EQ(dense_direct_assignment.size(),
+                  std::min(num_agents, num_tasks));
+        EXPECT_EQ(dense_reverse_assignment.size(),
+                  dense_direct_assignment.size());
+        for (const auto& [agent, task] : dense_direct_assignment) {
+          EXPECT_EQ(gtl::FindOrDie(dense_reverse_assignment, task), agent);
+        }
+        EXPECT_NEAR(AssignmentCost(cost, dense_direct_assignment),
+                    AssignmentCost(cost, direct_assignment), 1e-6)
+            << num_agents << "x" << num_tasks << " maximize=" << maximize;
+      }
+    }
+  }
+}
+
 }  // namespace operations_research
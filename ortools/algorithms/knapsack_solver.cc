@@ -21,6 +21,7 @@
 #include <string>
 #include <vector>
 
+#include "absl/numeric/bits.h"
 #include "ortools/base/stl_util.h"
 #include "ortools/linear_solver/linear_solver.h"
 #include "ortools/util/bitset.h"
@@ -952,6 +953,13 @@ class KnapsackDynamicProgrammingSolver : public BaseKnapsackSolver {
  private:
   int64_t SolveSubProblem(int64_t capacity, int num_items);
 
+  // Solves the problem when the profit of each item is equal to its weight,
+  // i.e. a subset sum problem. The reachable sums are stored as a bitset, so
+  // that each item is processed with word-parallel shifts and ors, and the
+  // first item reaching each sum is recorded so that the solution can be
+  // reconstructed without solving sub-problems.
+  int64_t SolveSubsetSum();
+
   std::vector<int64_t> profits_;
   std::vector<int64_t> weights_;
   int64_t capacity_;
@@ -1006,10 +1014,65 @@ int64_t KnapsackDynamicProgrammingSolver::SolveSubProblem(int64_t capacity,
   return selected_item_ids_.at(capacity);
 }
 
+int64_t KnapsackDynamicProgrammingSolver::SolveSubsetSum() {
+  const int num_items = profits_.size();
+  const int64_t num_words = capacity_ / 64 + 1;
+  // Bit s of reachable is set iff some subset of the items processed so far
+  // has a total weight of s. selected_item_ids_[s] is the first item with
+  // which s became reachable; it is only meaningful for reachable s > 0.
+  std::vector<uint64_t> reachable(num_words, 0);
+  reachable[0] = 1;
+  selected_item_ids_.assign(capacity_ + 1, -1);
+  const uint64_t last_word_mask =
+      capacity_ % 64 == 63 ? ~uint64_t{0}
+                           : (uint64_t{1} << (capacity_ % 64 + 1)) - 1;
+  for (int item_id = 0; item_id < num_items; ++item_id) {
+    const int64_t weight = weights_[item_id];
+    if (weight <= 0 || weight > capacity_) continue;
+    const int64_t word_shift = weight / 64;
+    const int bit_shift = weight % 64;
+    // reachable |= reachable << weight, from the highest word so that the
+    // words that are read have not been modified yet.
+    for (int64_t w = num_words - 1; w >= word_shift; --w) {
+      uint64_t shifted = reachable[w - word_shift] << bit_shift;
+      if (bit_shift != 0 && w - word_shift > 0) {
+        shifted |= reachable[w - word_shift - 1] >> (64 - bit_shift);
+      }
+      if (w == num_words - 1) shifted &= last_word_mask;
+      uint64_t newly_reachable = shifted & ~reachable[w];
+      reachable[w] |= shifted;
+      while (newly_reachable != 0) {
+        const int bit = absl::countr_zero(newly_reachable);
+        selected_item_ids_[w * 64 + bit] = item_id;
+        newly_reachable &= newly_reachable - 1;
+      }
+    }
+  }
+
+  int64_t best_sum = 0;
+  for (int64_t w = num_words - 1; w >= 0; --w) {
+    if (reachable[w] != 0) {
+      best_sum = w * 64 + 63 - absl::countl_zero(reachable[w]);
+      break;
+    }
+  }
+  // Since s became reachable with item i, s - weight(i) was reachable with
+  // the items before i: following selected_item_ids_ gives a valid subset.
+  best_solution_.assign(num_items, false);
+  for (int64_t sum = best_sum; sum > 0;) {
+    const int item_id = selected_item_ids_[sum];
+    DCHECK_GE(item_id, 0);
+    best_solution_[item_id] = true;
+    sum -= weights_[item_id];
+  }
+  return best_sum;
+}
+
 int64_t KnapsackDynamicProgrammingSolver::Solve(TimeLimit* /*time_limit*/,
                                                 bool* is_solution_optimal) {
   DCHECK(is_solution_optimal != nullptr);
   *is_solution_optimal = true;
+  if (profits_ == weights_) return SolveSubsetSum();
   const int64_t capacity_plus_1 = capacity_ + 1;
   selected_item_ids_.assign(capacity_plus_1, 0);
   computed_profits_.assign(capacity_plus_1, 0LL);
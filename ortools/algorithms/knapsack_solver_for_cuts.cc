@@ -76,6 +76,17 @@ KnapsackSearchNodeForCuts::KnapsackSearchNodeForCuts(
       profit_upper_bound_(kInfinity),
       next_item_id_(kNoSelection) {}
 
+void KnapsackSearchNodeForCuts::Reset(
+    const KnapsackSearchNodeForCuts* const parent,
+    const KnapsackAssignmentForCuts& assignment) {
+  depth_ = parent == nullptr ? 0 : parent->depth() + 1;
+  parent_ = parent;
+  assignment_ = assignment;
+  current_profit_ = 0;
+  profit_upper_bound_ = kInfinity;
+  next_item_id_ = kNoSelection;
+}
+
 // ----- KnapsackSearchPathForCuts -----
 KnapsackSearchPathForCuts::KnapsackSearchPathForCuts(
     const KnapsackSearchNodeForCuts* from, const KnapsackSearchNodeForCuts* to)
@@ -328,22 +339,23 @@ double KnapsackSolverForCuts::Solve(TimeLimit* time_limit,
   best_solution_profit_ = 0;
   *is_solution_optimal = true;
 
+  // The nodes of the previous searches are no longer needed.
+  num_search_nodes_used_ = 0;
   SearchQueue search_queue;
   const KnapsackAssignmentForCuts assignment(kNoSelection, true);
-  auto root_node =
-      std::make_unique<KnapsackSearchNodeForCuts>(nullptr, assignment);
+  KnapsackSearchNodeForCuts* const root_node =
+      NewSearchNode(nullptr, assignment);
   root_node->set_current_profit(GetCurrentProfit());
   root_node->set_profit_upper_bound(GetAggregatedProfitUpperBound());
   root_node->set_next_item_id(GetNextItemId());
-  search_nodes_.push_back(std::move(root_node));
   const KnapsackSearchNodeForCuts* current_node =
-      search_nodes_.back().get();  // Start with the root node.
+      root_node;  // Start with the root node.
 
   if (MakeNewNode(*current_node, false)) {
-    search_queue.push(search_nodes_.back().get());
+    search_queue.push(search_nodes_[num_search_nodes_used_ - 1].get());
   }
   if (MakeNewNode(*current_node, true)) {
-    search_queue.push(search_nodes_.back().get());
+    search_queue.push(search_nodes_[num_search_nodes_used_ - 1].get());
   }
 
   int64_t number_of_nodes_visited = 0;
@@ -378,10 +390,10 @@ double KnapsackSolverForCuts::Solve(TimeLimit* time_limit,
     number_of_nodes_visited++;
 
     if (MakeNewNode(*node, false)) {
-      search_queue.push(search_nodes_.back().get());
+      search_queue.push(search_nodes_[num_search_nodes_used_ - 1].get());
     }
     if (MakeNewNode(*node, true)) {
-      search_queue.push(search_nodes_.back().get());
+      search_queue.push(search_nodes_[num_search_nodes_used_ - 1].get());
     }
   }
   return best_solution_profit_;
@@ -441,16 +453,27 @@ bool KnapsackSolverForCuts::MakeNewNode(const KnapsackSearchNodeForCuts& node,
   }
 
   // The node is relevant.
-  auto relevant_node =
-      std::make_unique<KnapsackSearchNodeForCuts>(&node, assignment);
+  KnapsackSearchNodeForCuts* const relevant_node =
+      NewSearchNode(&node, assignment);
   relevant_node->set_current_profit(new_node.current_profit());
   relevant_node->set_profit_upper_bound(new_node.profit_upper_bound());
   relevant_node->set_next_item_id(new_node.next_item_id());
-  search_nodes_.push_back(std::move(relevant_node));
 
   return true;
 }
 
+KnapsackSearchNodeForCuts* KnapsackSolverForCuts::NewSearchNode(
+    const KnapsackSearchNodeForCuts* parent,
+    const KnapsackAssignmentForCuts& assignment) {
+  if (num_search_nodes_used_ < static_cast<int>(search_nodes_.size())) {
+    search_nodes_[num_search_nodes_used_]->Reset(parent, assignment);
+  } else {
+    search_nodes_.push_back(
+        std::make_unique<KnapsackSearchNodeForCuts>(parent, assignment));
+  }
+  return search_nodes_[num_search_nodes_used_++].get();
+}
+
 bool KnapsackSolverForCuts::IncrementalUpdate(
     bool revert, const KnapsackAssignmentForCuts& assignment) {
   // Do not stop on a failure: To be able to be incremental on the update,
@@ -109,6 +109,11 @@ class KnapsackSearchNodeForCuts {
   KnapsackSearchNodeForCuts& operator=(const KnapsackSearchNodeForCuts&) =
       delete;
 
+  // Resets the node as if it was just constructed with these arguments. This
+  // allows the solver to reuse its nodes from one Solve() to the next.
+  void Reset(const KnapsackSearchNodeForCuts* parent,
+             const KnapsackAssignmentForCuts& assignment);
+
   int depth() const { return depth_; }
   const KnapsackSearchNodeForCuts* parent() const { return parent_; }
   const KnapsackAssignmentForCuts& assignment() const { return assignment_; }
@@ -125,7 +130,7 @@ class KnapsackSearchNodeForCuts {
  private:
   // 'depth_' is used to navigate efficiently through the search tree.
   int depth_;
-  const KnapsackSearchNodeForCuts* const parent_;
+  const KnapsackSearchNodeForCuts* parent_;
   KnapsackAssignmentForCuts assignment_;
 
   // 'current_profit_' and 'profit_upper_bound_' fields are used to sort search
@@ -363,13 +368,23 @@ class KnapsackSolverForCuts {
   // means this node should be added to the search queue too.
   bool MakeNewNode(const KnapsackSearchNodeForCuts& node, bool is_in);
 
+  // Returns a node from search_nodes_, allocating a new one only when all the
+  // nodes of the previous Solve() calls are used.
+  KnapsackSearchNodeForCuts* NewSearchNode(
+      const KnapsackSearchNodeForCuts* parent,
+      const KnapsackAssignmentForCuts& assignment);
+
   // Gets the aggregated (min) profit upper bound among all propagators.
   double GetAggregatedProfitUpperBound();
   double GetCurrentProfit() const { return propagator_.current_profit(); }
   int GetNextItemId() const { return propagator_.GetNextItemId(); }
 
   KnapsackPropagatorForCuts propagator_;
+  // The search nodes, only the first num_search_nodes_used_ ones belong to the
+  // current search. They are kept from one Solve() to the next, since this
+  // solver is typically called many times on small problems.
   std::vector<std::unique_ptr<KnapsackSearchNodeForCuts>> search_nodes_;
+  int num_search_nodes_used_ = 0;
   KnapsackStateForCuts state_;
   double best_solution_profit_;
   std::vector<bool> best_solution_;
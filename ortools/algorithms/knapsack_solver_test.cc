@@ -15,8 +15,10 @@
 
 #include <cstdint>
 #include <limits>
+#include <random>
 #include <vector>
 
+#include "absl/random/distributions.h"
 #include "gtest/gtest.h"
 #include "ortools/base/macros.h"
 
@@ -614,5 +616,32 @@ TEST(KnapsackSolverTest, AllItemsReduced) {
   EXPECT_EQ(kOptimalProfit, profit);
 }
 
+TEST(KnapsackSolverTest, SubsetSumWithDynamicProgramming) {
+  // When profits are equal to weights, the dynamic programming solver uses a
+  // bitset on the reachable sums: check capacities across word boundaries.
+  std::mt19937 random(12345);
+  for (const int64_t capacity : {0, 1, 63, 64, 65, 127, 128, 200, 1000}) {
+    for (int trial = 0; trial < 10; ++trial) {
+      const int kNumItems = 12;
+      std::vector<int64_t> weights(kNumItems);
+      for (int64_t& weight : weights) {
+        weight = absl::Uniform<int64_t>(random, 1, 2 * capacity + 2);
+      }
+      const int64_t capacities[] = {capacity};
+      const int64_t dynamic_programming_profit =
+          SolveKnapsackProblemUsingSpecificSolver(
+              weights.data(), kNumItems, weights.data(), capacities, 1,
+              KnapsackSolver::KNAPSACK_DYNAMIC_PROGRAMMING_SOLVER);
+      const int64_t brute_force_profit =
+          SolveKnapsackProblemUsingSpecificSolver(
+              weights.data(), kNumItems, weights.data(), capacities, 1,
+              KnapsackSolver::KNAPSACK_BRUTE_FORCE_SOLVER);
+      EXPECT_NE(dynamic_programming_profit, kInvalidSolution);
+      EXPECT_EQ(dynamic_programming_profit, brute_force_profit)
+          << "capacity = " << capacity;
+    }
+  }
+}
+
 }  // namespace
 }  // namespace operations_research
@@ -0,0 +1,150 @@
+// Copyright 2010-2022 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ortools/algorithms/set_cover_lagrangian.h"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "ortools/algorithms/set_cover_model.h"
+#include "ortools/base/logging.h"
+
+namespace operations_research {
+
+namespace {
+// Parameters of the step size rule, as suggested by Beasley (1990).
+constexpr double kInitialStepFactor = 2.0;
+constexpr double kMinStepFactor = 0.005;
+// Number of iterations without improvement after which the step factor is
+// halved.
+constexpr int kNumIterationsBeforeHalving = 30;
+}  // namespace
+
+ElementCostVector SetCoverLagrangian::InitializeMultipliers() const {
+  const SparseColumnView& columns = model_->columns();
+  const SubsetCostVector& subset_costs = model_->subset_costs();
+  ElementCostVector multipliers(model_->num_elements(),
+                                std::numeric_limits<Cost>::infinity());
+  for (SubsetIndex subset(0); subset < columns.size(); ++subset) {
+    if (columns[subset].empty()) continue;
+    const Cost cost_per_element =
+        subset_costs[subset] / columns[subset].size().value();
+    for (const ElementIndex element : columns[subset]) {
+      multipliers[element] = std::min(multipliers[element], cost_per_element);
+    }
+  }
+  // Elements that are in no subset make the problem infeasible, and have no
+  // meaningful multiplier.
+  for (Cost& multiplier : multipliers) {
+    if (multiplier == std::numeric_limits<Cost>::infinity()) multiplier = 0.0;
+  }
+  return multipliers;
+}
+
+SubsetCostVector SetCoverLagrangian::ComputeReducedCosts(
+    const ElementCostVector& multipliers) const {
+  const SparseColumnView& columns = model_->columns();
+  SubsetCostVector reduced_costs = model_->subset_costs();
+  for (SubsetIndex subset(0); subset < columns.size(); ++subset) {
+    for (const ElementIndex element : columns[subset]) {
+      reduced_costs[subset] -= multipliers[element];
+    }
+  }
+  return reduced_costs;
+}
+
+Cost SetCoverLagrangian::ComputeLagrangianValue(
+    const ElementCostVector& multipliers,
+    const SubsetCostVector& reduced_costs) const {
+  Cost value = 0.0;
+  for (const Cost multiplier : multipliers) value += multiplier;
+  for (const Cost reduced_cost : reduced_costs) {
+    value += std::min<Cost>(reduced_cost, 0.0);
+  }
+  return value;
+}
+
+Cost SetCoverLagrangian::ComputeLowerBound(Cost upper_bound,
+                                           int num_iterations) {
+  const SparseColumnView& columns = model_->columns();
+  ElementCostVector multipliers = InitializeMultipliers();
+  ElementCostVector subgradient(model_->num_elements(), 0.0);
+  best_lower_bound_ = -std::numeric_limits<Cost>::infinity();
+  double step_factor = kInitialStepFactor;
+  int num_iterations_without_improvement = 0;
+  for (int iteration = 0; iteration < num_iterations; ++iteration) {
+    const SubsetCostVector reduced_costs = ComputeReducedCosts(multipliers);
+    const Cost lower_bound = ComputeLagrangianValue(multipliers, reduced_costs);
+    if (lower_bound > best_lower_bound_) {
+      best_lower_bound_ = lower_bound;
+      best_multipliers_ = multipliers;
+      best_reduced_costs_ = reduced_costs;
+      num_iterations_without_improvement = 0;
+    } else if (++num_iterations_without_improvement >=
+               kNumIterationsBeforeHalving) {
+      step_factor /= 2.0;
+      num_iterations_without_improvement = 0;
+      if (step_factor < kMinStepFactor) break;
+    }
+    if (lower_bound >= upper_bound) break;
+
+    // The subgradient is 1 - (number of subsets with a negative reduced cost
+    // containing the element), i.e. the violation of the covering constraints
+    // by the minimizer of the Lagrangian.
+    std::fill(subgradient.begin(), subgradient.end(), 1.0);
+    for (SubsetIndex subset(0); subset < columns.size(); ++subset) {
+      if (reduced_costs[subset] >= 0.0) continue;
+      for (const ElementIndex element : columns[subset]) {
+        subgradient[element] -= 1.0;
+      }
+    }
+    double squared_norm = 0.0;
+    for (ElementIndex element(0); element < subgradient.size(); ++element) {
+      // The multipliers that would become negative are projected back to 0,
+      // so their component of the subgradient is irrelevant.
+      if (multipliers[element] == 0.0 && subgradient[element] < 0.0) {
+        subgradient[element] = 0.0;
+      }
+      squared_norm += subgradient[element] * subgradient[element];
+    }
+    // The minimizer of the Lagrangian is a cover with complementary
+    // slackness: the bound is optimal.
+    if (squared_norm == 0.0) break;
+
+    const double step =
+        step_factor * (upper_bound - lower_bound) / squared_norm;
+    for (ElementIndex element(0); element < multipliers.size(); ++element) {
+      multipliers[element] =
+          std::max(0.0, multipliers[element] + step * subgradient[element]);
+    }
+    DVLOG(1) << "Iteration " << iteration << " lower bound = " << lower_bound
+             << " step factor = " << step_factor;
+  }
+  return best_lower_bound_;
+}
+
+std::vector<SubsetIndex> SetCoverLagrangian::ComputeSubsetsFixableToZero(
+    Cost upper_bound) const {
+  std::vector<SubsetIndex> fixable_subsets;
+  for (SubsetIndex subset(0); subset < best_reduced_costs_.size(); ++subset) {
+    if (best_lower_bound_ + std::max<Cost>(best_reduced_costs_[subset], 0.0) >=
+        upper_bound) {
+      fixable_subsets.push_back(subset);
+    }
+  }
+  return fixable_subsets;
+}
+
+}  // namespace operations_research
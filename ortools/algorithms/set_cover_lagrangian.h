@@ -0,0 +1,84 @@
+// Copyright 2010-2022 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OR_TOOLS_ALGORITHMS_SET_COVER_LAGRANGIAN_H_
+#define OR_TOOLS_ALGORITHMS_SET_COVER_LAGRANGIAN_H_
+
+#include <vector>
+
+#include "ortools/algorithms/set_cover_model.h"
+
+namespace operations_research {
+
+// Lower bounds for the weighted set-covering problem, by Lagrangian relaxation
+// of the covering constraints: with multipliers u_i >= 0 for each element i,
+//   L(u) = sum_i u_i + sum_j min(0, c_j - sum_{i in T_j} u_i)
+// is a lower bound on the cost of any cover. The quantity
+// c_j - sum_{i in T_j} u_i is the reduced cost of subset j.
+//
+// The bound is maximized by subgradient optimization, with the step size rule
+// of Held, Wolfe and Crowder, "Validation of subgradient optimization",
+// Mathematical Programming 6 (1974) 62-88, as in the set covering heuristic of
+// Beasley, "A Lagrangian heuristic for set-covering problems", Naval Research
+// Logistics 37 (1990) 151-164.
+//
+// The reduced costs can be used to fix subsets: if L(u) + max(0, r_j) >= UB,
+// where r_j is the reduced cost of subset j and UB is the cost of a known
+// solution, then no solution containing subset j is better than UB.
+class SetCoverLagrangian {
+ public:
+  explicit SetCoverLagrangian(SetCoverModel* model) : model_(model) {}
+
+  // Returns the initial multipliers: for each element, the minimum over the
+  // subsets containing it of the cost of the subset divided by its size.
+  ElementCostVector InitializeMultipliers() const;
+
+  // Returns the reduced cost of each subset for the given multipliers.
+  SubsetCostVector ComputeReducedCosts(
+      const ElementCostVector& multipliers) const;
+
+  // Returns L(u) for the given multipliers and their reduced costs.
+  Cost ComputeLagrangianValue(const ElementCostVector& multipliers,
+                              const SubsetCostVector& reduced_costs) const;
+
+  // Runs at most num_iterations of subgradient optimization, starting from
+  // InitializeMultipliers(). 'upper_bound' is the cost of a known solution,
+  // e.g. the one found by GreedySolutionGenerator, used to compute the step
+  // sizes. Returns the best lower bound found, whose multipliers and reduced
+  // costs are then available below.
+  Cost ComputeLowerBound(Cost upper_bound, int num_iterations);
+
+  const ElementCostVector& best_multipliers() const {
+    return best_multipliers_;
+  }
+  const SubsetCostVector& best_reduced_costs() const {
+    return best_reduced_costs_;
+  }
+
+  // Returns the subsets that can't appear in a solution strictly better than
+  // 'upper_bound', according to the best multipliers found by
+  // ComputeLowerBound().
+  std::vector<SubsetIndex> ComputeSubsetsFixableToZero(Cost upper_bound) const;
+
+ private:
+  // The model on which the algorithm runs.
+  SetCoverModel* model_;
+
+  Cost best_lower_bound_ = 0.0;
+  ElementCostVector best_multipliers_;
+  SubsetCostVector best_reduced_costs_;
+};
+
+}  // namespace operations_research
+
+#endif  // OR_TOOLS_ALGORITHMS_SET_COVER_LAGRANGIAN_H_
@@ -230,7 +230,7 @@ std::vector<SubsetIndex> SetCoverLedger::UnsafeToggle(SubsetIndex subset,
   const std::vector<SubsetIndex> impacted_subsets =
       ComputeImpactedSubsets(subset);
   UpdateIsRemovable(impacted_subsets);
-  UpdateMarginalImpacts(impacted_subsets);
+  DCHECK(CheckCoverageAndMarginalImpacts(is_selected_));
   DCHECK((is_selected_[subset] <= (marginal_impacts_[subset] == 0)));
   return impacted_subsets;
 }
@@ -245,10 +245,20 @@ void SetCoverLedger::UpdateCoverage(SubsetIndex subset, bool value) {
     coverage_[element] += delta;
     DCHECK_GE(coverage_[element], 0);
     DCHECK_LE(coverage_[element], rows[element].size().value());
-    if (coverage_[element] == 1) {
+    // The marginal impacts only change for the subsets containing an element
+    // that becomes covered or uncovered. Updating them here is much cheaper
+    // than recomputing them from the columns of all the impacted subsets.
+    if (value && coverage_[element] == 1) {
       ++num_elements_covered_;
-    } else if (coverage_[element] == 0) {
+      for (const SubsetIndex impacted_subset : rows[element]) {
+        --marginal_impacts_[impacted_subset];
+        DCHECK_GE(marginal_impacts_[impacted_subset], 0);
+      }
+    } else if (!value && coverage_[element] == 0) {
       --num_elements_covered_;
+      for (const SubsetIndex impacted_subset : rows[element]) {
+        ++marginal_impacts_[impacted_subset];
+      }
     }
   }
   DCHECK(CheckSingleSubsetCoverage(subset));
@@ -322,25 +332,6 @@ bool SetCoverLedger::CheckIsRemovable() const {
   return true;
 }
 
-void SetCoverLedger::UpdateMarginalImpacts(
-    const std::vector<SubsetIndex>& impacted_subsets) {
-  const SparseColumnView& columns = model_->columns();
-  for (const SubsetIndex subset : impacted_subsets) {
-    ElementIndex impact(0);
-    for (const ElementIndex element : columns[subset]) {
-      if (coverage_[element] == 0) {
-        ++impact;
-      }
-    }
-    DVLOG(2) << "Changing impact of subset " << subset << " from "
-             << marginal_impacts_[subset] << " to " << impact;
-    marginal_impacts_[subset] = impact;
-    DCHECK_LE(marginal_impacts_[subset], columns[subset].size().value());
-    DCHECK_GE(marginal_impacts_[subset], 0);
-  }
-  DCHECK(CheckCoverageAndMarginalImpacts(is_selected_));
-}
-
 std::vector<SubsetIndex> SetCoverLedger::ComputeSettableSubsets() const {
   const SparseRowView& rows = model_->rows();
   absl::flat_hash_set<SubsetIndex> collection;
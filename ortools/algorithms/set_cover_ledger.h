@@ -101,9 +101,6 @@ class SetCoverLedger {
   // Updates is_removable_ for each subset in impacted_subsets.
   void UpdateIsRemovable(const std::vector<SubsetIndex>& impacted_subsets);
 
-  // Updates marginal_impacts_ for each subset in impacted_subsets.
-  void UpdateMarginalImpacts(const std::vector<SubsetIndex>& impacted_subsets);
-
   // Toggles is_selected_[subset] to value, and incrementally updates the
   // ledger.
   // Returns a vector of subsets impacted by the change, in case they need
@@ -57,6 +57,7 @@ DEFINE_STRONG_INDEX_TYPE(EntryIndex);
 // The return type for size() is a simple size_t and not an Index as in
 // StrictITIVector, which makes the code less elegant.
 using SubsetCostVector = glop::StrictITIVector<SubsetIndex, Cost>;
+using ElementCostVector = glop::StrictITIVector<ElementIndex, Cost>;
 using SparseColumn = glop::StrictITIVector<EntryIndex, ElementIndex>;
 using SparseRow = glop::StrictITIVector<EntryIndex, SubsetIndex>;
 
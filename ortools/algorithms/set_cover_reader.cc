@@ -13,11 +13,16 @@
 
 #include "ortools/algorithms/set_cover_reader.h"
 
+#include <algorithm>
 #include <cctype>
 #include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
 
 #include "absl/base/log_severity.h"
 #include "absl/log/check.h"
+#include "absl/status/status.h"
 #include "absl/strings/numbers.h"
 #include "absl/strings/string_view.h"
 #include "ortools/algorithms/set_cover_model.h"
@@ -142,4 +147,120 @@ SetCoverModel ReadRailSetCoverProblem(absl::string_view filename) {
   return model;
 }
 
+namespace {
+
+constexpr char kBinaryFormatMagic[] = "SCB1";
+constexpr int kBinaryFormatMagicSize = 4;
+
+void AppendVarint(uint64_t value, std::string* output) {
+  while (value >= 0x80) {
+    output->push_back(static_cast<char>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  output->push_back(static_cast<char>(value));
+}
+
+// Reads the binary format of WriteSetCoverProblemInBinaryFormat(). As for the
+// text readers, there is no error handling beyond CHECKs.
+class BinarySetCoverParser {
+ public:
+  explicit BinarySetCoverParser(absl::string_view data)
+      : data_(data), pos_(0) {}
+
+  uint64_t ParseNextVarint() {
+    uint64_t value = 0;
+    for (int shift = 0;; shift += 7) {
+      CHECK_LT(pos_, data_.size()) << "Truncated set cover binary file.";
+      CHECK_LT(shift, 64) << "Malformed varint in set cover binary file.";
+      const uint8_t byte = static_cast<uint8_t>(data_[pos_++]);
+      value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) return value;
+    }
+  }
+
+  double ParseNextDouble() {
+    CHECK_LE(pos_ + sizeof(double), data_.size())
+        << "Truncated set cover binary file.";
+    uint64_t bits = 0;
+    for (int i = 0; i < sizeof(double); ++i) {
+      bits |= static_cast<uint64_t>(static_cast<uint8_t>(data_[pos_ + i]))
+              << (8 * i);
+    }
+    pos_ += sizeof(double);
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  absl::string_view ParseNextBytes(size_t size) {
+    CHECK_LE(pos_ + size, data_.size()) << "Truncated set cover binary file.";
+    const absl::string_view bytes = data_.substr(pos_, size);
+    pos_ += size;
+    return bytes;
+  }
+
+  bool AtEnd() const { return pos_ == data_.size(); }
+
+ private:
+  absl::string_view data_;
+  size_t pos_;
+};
+
+}  // namespace
+
+absl::Status WriteSetCoverProblemInBinaryFormat(SetCoverModel* model,
+                                                absl::string_view filename) {
+  const SparseColumnView& columns = model->columns();
+  const SubsetCostVector& subset_costs = model->subset_costs();
+  std::string output(kBinaryFormatMagic, kBinaryFormatMagicSize);
+  AppendVarint(model->num_elements().value(), &output);
+  AppendVarint(model->num_subsets().value(), &output);
+  std::vector<ElementIndex> column;
+  for (SubsetIndex subset(0); subset < model->num_subsets(); ++subset) {
+    uint64_t bits;
+    const double cost = subset_costs[subset];
+    std::memcpy(&bits, &cost, sizeof(bits));
+    for (int i = 0; i < sizeof(bits); ++i) {
+      output.push_back(static_cast<char>((bits >> (8 * i)) & 0xFF));
+    }
+    column.assign(columns[subset].begin(), columns[subset].end());
+    std::sort(column.begin(), column.end());
+    AppendVarint(column.size(), &output);
+    ElementIndex previous(0);
+    for (const ElementIndex element : column) {
+      AppendVarint((element - previous).value(), &output);
+      previous = element;
+    }
+  }
+  return file::SetContents(filename, output, file::Defaults());
+}
+
+SetCoverModel ReadBinarySetCoverProblem(absl::string_view filename) {
+  std::string data;
+  CHECK_OK(file::GetContents(filename, &data, file::Defaults()));
+  BinarySetCoverParser parser(data);
+  CHECK_EQ(parser.ParseNextBytes(kBinaryFormatMagicSize),
+           absl::string_view(kBinaryFormatMagic, kBinaryFormatMagicSize))
+      << "Not a set cover binary file: " << filename;
+  const uint64_t num_elements = parser.ParseNextVarint();
+  const uint64_t num_subsets = parser.ParseNextVarint();
+  DVLOG(1) << "num_elements: " << num_elements
+           << " num_subsets: " << num_subsets;
+  SetCoverModel model;
+  model.ReserveNumSubsets(num_subsets);
+  for (int subset = 0; subset < num_subsets; ++subset) {
+    model.SetSubsetCost(subset, parser.ParseNextDouble());
+    const uint64_t column_size = parser.ParseNextVarint();
+    model.ReserveNumElementsInSubset(column_size, subset);
+    uint64_t element = 0;
+    for (uint64_t entry = 0; entry < column_size; ++entry) {
+      element += parser.ParseNextVarint();
+      CHECK_LT(element, num_elements) << "Element out of range in " << filename;
+      model.AddElementToSubset(element, subset);
+    }
+  }
+  CHECK(parser.AtEnd()) << "Trailing data in set cover binary file.";
+  return model;
+}
+
 }  // namespace operations_research
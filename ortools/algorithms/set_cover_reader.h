@@ -14,6 +14,7 @@
 #ifndef OR_TOOLS_ALGORITHMS_SET_COVER_READER_H_
 #define OR_TOOLS_ALGORITHMS_SET_COVER_READER_H_
 
+#include "absl/status/status.h"
 #include "absl/strings/string_view.h"
 #include "ortools/algorithms/set_cover_model.h"
 
@@ -45,6 +46,22 @@ SetCoverModel ReadBeasleySetCoverProblem(absl::string_view filename);
 // that it covers.
 SetCoverModel ReadRailSetCoverProblem(absl::string_view filename);
 
+// Writes 'model' in a compact binary format, and reads it back. This is much
+// faster to load and much smaller than the text formats above, which makes it
+// the format of choice for huge instances: convert them once from text, then
+// read the binary file.
+// The format is, with all the integers written as base-128 varints:
+// - the magic string "SCB1",
+// - the number of elements and the number of subsets,
+// - for each subset: its cost as 8 little-endian bytes (IEEE 754 double), the
+//   number of elements in its column, then the elements of the column in
+//   increasing order, each one as the difference with the previous one (the
+//   first one as is).
+// Indices start from 0, as in SetCoverModel.
+absl::Status WriteSetCoverProblemInBinaryFormat(SetCoverModel* model,
+                                                absl::string_view filename);
+SetCoverModel ReadBinarySetCoverProblem(absl::string_view filename);
+
 }  // namespace operations_research
 
 #endif  // OR_TOOLS_ALGORITHMS_SET_COVER_READER_H_
@@ -13,16 +13,20 @@
 
 #include "ortools/algorithms/set_cover.h"
 
+#include <algorithm>
 #include <limits>
 #include <string>
 #include <vector>
 
 #include "absl/log/check.h"
 #include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
 #include "benchmark/benchmark.h"
 #include "gtest/gtest.h"
+#include "ortools/algorithms/set_cover_lagrangian.h"
 #include "ortools/algorithms/set_cover_ledger.h"
 #include "ortools/algorithms/set_cover_model.h"
+#include "ortools/algorithms/set_cover_reader.h"
 #include "ortools/base/logging.h"
 
 namespace operations_research {
@@ -88,6 +92,69 @@ SetCoverModel CreateKnightsCoverModel(int num_rows, int num_cols) {
   return model;
 }
 
+TEST(SetCoverTest, LagrangianLowerBound) {
+  SetCoverModel model = CreateKnightsCoverModel(16, 16);
+  SetCoverLedger ledger(&model);
+  GreedySolutionGenerator greedy(&ledger);
+  CHECK(greedy.NextSolution());
+  SteepestSearch steepest(&ledger);
+  CHECK(steepest.NextSolution(100000));
+  const Cost upper_bound = ledger.cost();
+
+  SetCoverLagrangian lagrangian(&model);
+  const Cost initial_bound = lagrangian.ComputeLagrangianValue(
+      lagrangian.InitializeMultipliers(),
+      lagrangian.ComputeReducedCosts(lagrangian.InitializeMultipliers()));
+  const Cost lower_bound = lagrangian.ComputeLowerBound(upper_bound, 1000);
+  LOG(INFO) << "Lagrangian lower bound: " << lower_bound
+            << " initial bound: " << initial_bound
+            << " upper bound: " << upper_bound;
+  EXPECT_GE(lower_bound, initial_bound);
+  EXPECT_GT(lower_bound, 0.0);
+  EXPECT_LE(lower_bound, upper_bound + 1e-9);
+  EXPECT_EQ(lagrangian.best_reduced_costs(),
+            lagrangian.ComputeReducedCosts(lagrangian.best_multipliers()));
+}
+
+TEST(SetCoverTest, LagrangianBoundIsTightOnDisjointSubsets) {
+  // Each element is in a cheap subset and in an expensive one. The cheap
+  // subsets are the optimal solution, of cost 3.
+  SetCoverModel model;
+  for (int element = 0; element < 3; ++element) {
+    model.AddEmptySubset(1);
+    model.AddElementToLastSubset(element);
+  }
+  model.AddEmptySubset(10);
+  model.AddElementToLastSubset(0);
+  model.AddElementToLastSubset(1);
+  model.AddElementToLastSubset(2);
+  SetCoverLagrangian lagrangian(&model);
+  EXPECT_NEAR(lagrangian.ComputeLowerBound(3.0, 100), 3.0, 1e-9);
+  // Only the expensive subset can't be in a solution of cost less than 3.5.
+  EXPECT_EQ(lagrangian.ComputeSubsetsFixableToZero(3.5),
+            std::vector<SubsetIndex>({SubsetIndex(3)}));
+}
+
+TEST(SetCoverTest, BinaryFormatRoundTrip) {
+  SetCoverModel model = CreateKnightsCoverModel(20, 30);
+  model.SetSubsetCost(7, 2.5);
+  const std::string filename =
+      absl::StrCat(::testing::TempDir(), "/knights_20_30.scb");
+  ASSERT_TRUE(WriteSetCoverProblemInBinaryFormat(&model, filename).ok());
+  SetCoverModel read_model = ReadBinarySetCoverProblem(filename);
+  ASSERT_EQ(read_model.num_elements(), model.num_elements());
+  ASSERT_EQ(read_model.num_subsets(), model.num_subsets());
+  for (SubsetIndex subset(0); subset < model.num_subsets(); ++subset) {
+    EXPECT_EQ(read_model.subset_costs()[subset], model.subset_costs()[subset]);
+    std::vector<ElementIndex> column(model.columns()[subset].begin(),
+                                     model.columns()[subset].end());
+    std::sort(column.begin(), column.end());
+    EXPECT_EQ(std::vector<ElementIndex>(read_model.columns()[subset].begin(),
+                                        read_model.columns()[subset].end()),
+              column);
+  }
+}
+
 void DisplayKnightsCoverSolution(const SubsetBoolVector& choices, int num_rows,
                                  int num_cols) {
   std::string line;
@@ -168,6 +168,9 @@ absl::Status GetContents(const absl::string_view& filename, std::string* output,
   if (!status.ok()) return status;
 
   const int64_t size = file->Size();
+  // Reserve the exact size up front, otherwise the repeated appends of
+  // ReadToString() may temporarily need about twice the file size.
+  if (size > 0) output->reserve(size);
   if (file->ReadToString(output, size) == size) {
     status.Update(file->Close(flags));
     return status;
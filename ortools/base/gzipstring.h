@@ -14,6 +14,8 @@
 #ifndef OR_TOOLS_BASE_GZIPSTRING_H_
 #define OR_TOOLS_BASE_GZIPSTRING_H_
 
+#include <algorithm>
+#include <cstddef>
 #include <string>
 
 #include "ortools/base/logging.h"
@@ -31,22 +33,32 @@ bool GunzipString(const std::string& str, std::string* out) {
     return false;
   }
 
-  zs.next_in = (Bytef*)str.data();
-  zs.avail_in = str.size();
+  // avail_in is a 32 bits integer, so inputs of 4 GB or more must be fed to
+  // zlib in several pieces.
+  constexpr size_t kMaxInputChunk = size_t{1} << 30;
+  const char* next_input = str.data();
+  size_t input_left = str.size();
 
   int status;
   char buffer[32768];
 
   // Decompress string by block.
   do {
+    if (zs.avail_in == 0 && input_left > 0) {
+      const size_t chunk = std::min(input_left, kMaxInputChunk);
+      zs.next_in = (Bytef*)next_input;
+      zs.avail_in = chunk;
+      next_input += chunk;
+      input_left -= chunk;
+    }
     zs.next_out = reinterpret_cast<Bytef*>(buffer);
     zs.avail_out = sizeof(buffer);
 
     status = inflate(&zs, 0);
 
-    if (out->size() < zs.total_out) {
-      out->append(buffer, zs.total_out - out->size());
-    }
+    // Note that total_out is also limited to 32 bits on some platforms, so we
+    // use the number of bytes written in this block instead.
+    out->append(buffer, sizeof(buffer) - zs.avail_out);
   } while (status == Z_OK);
 
   inflateEnd(&zs);
@@ -15,6 +15,7 @@
 
 #include <functional>
 #include <mutex>
+#include <utility>
 
 #include "absl/log/check.h"
 #include "absl/strings/string_view.h"
@@ -61,7 +62,7 @@ std::function<void()> ThreadPool::GetNextTask() {
   std::unique_lock<std::mutex> lock(mutex_);
   for (;;) {
     if (!tasks_.empty()) {
-      std::function<void()> task = tasks_.front();
+      std::function<void()> task = std::move(tasks_.front());
       tasks_.pop_front();
       if (tasks_.size() < queue_capacity_ && waiting_for_capacity_) {
         waiting_for_capacity_ = false;
@@ -84,10 +85,12 @@ void ThreadPool::Schedule(std::function<void()> closure) {
     waiting_for_capacity_ = true;
     capacity_condition_.wait(lock);
   }
-  tasks_.push_back(closure);
+  tasks_.push_back(std::move(closure));
   if (started_) {
     lock.unlock();
-    condition_.notify_all();
+    // Only one worker can take the new task. Waking all of them would make
+    // them contend on mutex_ for nothing, which shows with many threads.
+    condition_.notify_one();
   }
 }
 
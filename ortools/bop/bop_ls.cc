@@ -19,7 +19,9 @@
 #include <cstdlib>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "absl/container/flat_hash_map.h"
@@ -204,8 +206,7 @@ template class BacktrackableIntegerSet<ConstraintIndex>;
 AssignmentAndConstraintFeasibilityMaintainer::
     AssignmentAndConstraintFeasibilityMaintainer(
         const LinearBooleanProblem& problem, absl::BitGenRef random)
-    : by_variable_matrix_(problem.num_variables()),
-      constraint_lower_bounds_(),
+    : constraint_lower_bounds_(),
       constraint_upper_bounds_(),
       assignment_(problem, "Assignment"),
       reference_(problem, "Assignment"),
@@ -213,6 +214,9 @@ AssignmentAndConstraintFeasibilityMaintainer::
       flipped_var_trail_backtrack_levels_(),
       flipped_var_trail_(),
       constraint_set_hasher_(random) {
+  // The matrix entries, in the order of the constraints.
+  std::vector<std::pair<VariableIndex, ConstraintEntry>> entries;
+
   // Add the objective constraint as the first constraint.
   const LinearObjective& objective = problem.objective();
   CHECK_EQ(objective.literals_size(), objective.coefficients_size());
@@ -222,8 +226,7 @@ AssignmentAndConstraintFeasibilityMaintainer::
 
     const VariableIndex var(objective.literals(i) - 1);
     const int64_t weight = objective.coefficients(i);
-    by_variable_matrix_[var].push_back(
-        ConstraintEntry(kObjectiveConstraint, weight));
+    entries.push_back({var, ConstraintEntry(kObjectiveConstraint, weight)});
   }
   constraint_lower_bounds_.push_back(std::numeric_limits<int64_t>::min());
   constraint_values_.push_back(0);
@@ -243,8 +246,8 @@ AssignmentAndConstraintFeasibilityMaintainer::
     for (int i = 0; i < constraint.literals_size(); ++i) {
       const VariableIndex var(constraint.literals(i) - 1);
       const int64_t weight = constraint.coefficients(i);
-      by_variable_matrix_[var].push_back(
-          ConstraintEntry(num_constraints_with_objective, weight));
+      entries.push_back(
+          {var, ConstraintEntry(num_constraints_with_objective, weight)});
     }
     constraint_lower_bounds_.push_back(
         constraint.has_lower_bound() ? constraint.lower_bound()
@@ -257,6 +260,21 @@ AssignmentAndConstraintFeasibilityMaintainer::
     ++num_constraints_with_objective;
   }
 
+  // Group the entries by variable, keeping the constraint order.
+  by_variable_starts_.assign(problem.num_variables() + 1, 0);
+  for (const auto& [var, entry] : entries) {
+    ++by_variable_starts_[var.value() + 1];
+  }
+  std::partial_sum(by_variable_starts_.begin(), by_variable_starts_.end(),
+                   by_variable_starts_.begin());
+  std::vector<int> positions(by_variable_starts_.begin(),
+                             by_variable_starts_.end() - 1);
+  by_variable_entries_.resize(entries.size(),
+                              ConstraintEntry(kObjectiveConstraint, 0));
+  for (const auto& [var, entry] : entries) {
+    by_variable_entries_[positions[var.value()]++] = entry;
+  }
+
   // Initialize infeasible_constraint_set_;
   infeasible_constraint_set_.ClearAndResize(
       ConstraintIndex(constraint_values_.size()));
@@ -283,7 +301,7 @@ void AssignmentAndConstraintFeasibilityMaintainer::SetReferenceSolution(
   constraint_values_.assign(NumConstraints(), 0);
   for (VariableIndex var(0); var < assignment_.Size(); ++var) {
     if (assignment_.Value(var)) {
-      for (const ConstraintEntry& entry : by_variable_matrix_[var]) {
+      for (const ConstraintEntry& entry : ConstraintEntries(var)) {
         constraint_values_[entry.constraint] += entry.weight;
       }
     }
@@ -329,7 +347,7 @@ void AssignmentAndConstraintFeasibilityMaintainer::Assign(
     if (assignment_.Value(var) != value) {
       flipped_var_trail_.push_back(var);
       assignment_.SetValue(var, value);
-      for (const ConstraintEntry& entry : by_variable_matrix_[var]) {
+      for (const ConstraintEntry& entry : ConstraintEntries(var)) {
         const bool was_feasible = ConstraintIsFeasible(entry.constraint);
         constraint_values_[entry.constraint] +=
             value ? entry.weight : -entry.weight;
@@ -355,7 +373,7 @@ void AssignmentAndConstraintFeasibilityMaintainer::BacktrackOneLevel() {
     const bool new_value = !assignment_.Value(var);
     DCHECK_EQ(new_value, reference_.Value(var));
     assignment_.SetValue(var, new_value);
-    for (const ConstraintEntry& entry : by_variable_matrix_[var]) {
+    for (const ConstraintEntry& entry : ConstraintEntries(var)) {
       constraint_values_[entry.constraint] +=
           new_value ? entry.weight : -entry.weight;
     }
@@ -441,12 +459,13 @@ void AssignmentAndConstraintFeasibilityMaintainer::
       FromConstraintIndex(kObjectiveConstraint, true));
   constraint_set_hasher_.IgnoreElement(
       FromConstraintIndex(kObjectiveConstraint, false));
-  for (VariableIndex var(0); var < by_variable_matrix_.size(); ++var) {
+  const VariableIndex num_variables(by_variable_starts_.size() - 1);
+  for (VariableIndex var(0); var < num_variables; ++var) {
     // We add two entries, one for a positive flip (from false to true) and one
     // for a negative flip (from true to false).
     for (const bool flip_is_positive : {true, false}) {
       uint64_t hash = 0;
-      for (const ConstraintEntry& entry : by_variable_matrix_[var]) {
+      for (const ConstraintEntry& entry : ConstraintEntries(var)) {
         const bool coeff_is_positive = entry.weight > 0;
         hash ^= constraint_set_hasher_.Hash(FromConstraintIndex(
             entry.constraint,
@@ -40,6 +40,7 @@
 #include "absl/random/bit_gen_ref.h"
 #include "absl/random/random.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 #include "ortools/base/macros.h"
 #include "ortools/base/strong_vector.h"
 #include "ortools/bop/bop_base.h"
@@ -412,9 +413,20 @@ class AssignmentAndConstraintFeasibilityMaintainer {
     int64_t weight;
   };
 
-  absl::StrongVector<VariableIndex,
-                     absl::StrongVector<EntryIndex, ConstraintEntry>>
-      by_variable_matrix_;
+  // Returns the entries of the sparse matrix by variable for var.
+  absl::Span<const ConstraintEntry> ConstraintEntries(VariableIndex var) const {
+    return absl::MakeConstSpan(by_variable_entries_)
+        .subspan(by_variable_starts_[var.value()],
+                 by_variable_starts_[var.value() + 1] -
+                     by_variable_starts_[var.value()]);
+  }
+
+  // The sparse matrix by variable in compressed form: the entries of var are
+  // by_variable_entries_[by_variable_starts_[var], by_variable_starts_[var+1]).
+  // This keeps the entries contiguous for the loops of Assign() and
+  // BacktrackOneLevel(), which dominate the local search.
+  std::vector<int> by_variable_starts_;
+  std::vector<ConstraintEntry> by_variable_entries_;
   absl::StrongVector<ConstraintIndex, int64_t> constraint_lower_bounds_;
   absl::StrongVector<ConstraintIndex, int64_t> constraint_upper_bounds_;
 
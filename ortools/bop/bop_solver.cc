@@ -13,6 +13,8 @@
 
 #include "ortools/bop/bop_solver.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <memory>
 #include <string>
@@ -20,7 +22,10 @@
 
 #include "absl/log/check.h"
 #include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
+#include "absl/synchronization/blocking_counter.h"
+#include "absl/synchronization/mutex.h"
 #include "google/protobuf/text_format.h"
 #include "ortools/base/logging.h"
 #include "ortools/base/threadpool.h"
@@ -140,8 +145,190 @@ BopSolveStatus BopSolver::InternalMonothreadSolver(TimeLimit* time_limit) {
 
 BopSolveStatus BopSolver::InternalMultithreadSolver(TimeLimit* time_limit) {
   CHECK(time_limit != nullptr);
-  // Not implemented.
-  return BopSolveStatus::INVALID_PROBLEM;
+  if (parameters_.synchronization_type() !=
+      BopParameters::NO_SYNCHRONIZATION) {
+    return InternalSynchronizedMultithreadSolver(time_limit);
+  }
+  const int num_solvers = parameters_.number_of_solvers();
+
+  // Each solver runs its own portfolio on its own ProblemState, and they all
+  // stop as soon as one of them proves optimality or infeasibility. The
+  // learned information is only merged into problem_state_ once the solver is
+  // done.
+  absl::Mutex mutex;
+  std::atomic<bool> stop_solvers(false);
+  std::atomic<bool>* const external_stop = time_limit->ExternalBooleanAsLimit();
+  const double time_left = time_limit->GetTimeLeft();
+  const double deterministic_time_left = time_limit->GetDeterministicTimeLeft();
+  std::vector<double> deterministic_times(num_solvers, 0.0);
+  const auto run_solver = [&](int solver_index) {
+    BopParameters local_parameters = parameters_;
+    local_parameters.set_random_seed(parameters_.random_seed() + solver_index);
+    ProblemState local_state(problem_);
+    local_state.SetParameters(local_parameters);
+    {
+      absl::MutexLock lock(&mutex);
+      local_state.set_assignment_preference(
+          problem_state_.assignment_preference());
+      local_state.MergeLearnedInfo(problem_state_.GetLearnedInfo(),
+                                   BopOptimizerBase::CONTINUE);
+    }
+
+    TimeLimit local_time_limit(time_left, deterministic_time_left);
+    local_time_limit.RegisterExternalBooleanAsLimit(&stop_solvers);
+    local_time_limit.RegisterSecondaryExternalBooleanAsLimit(external_stop);
+    const int set_index =
+        std::min(solver_index, parameters_.solver_optimizer_sets_size() - 1);
+    PortfolioOptimizer optimizer(local_state, local_parameters,
+                                 parameters_.solver_optimizer_sets(set_index),
+                                 absl::StrCat("Portfolio_", solver_index));
+    LearnedInfo learned_info(problem_);
+    while (!local_time_limit.LimitReached()) {
+      const BopOptimizerBase::Status optimization_status =
+          optimizer.Optimize(local_parameters, local_state, &learned_info,
+                             &local_time_limit);
+      local_state.MergeLearnedInfo(learned_info, optimization_status);
+      learned_info.Clear();
+
+      if (local_state.IsOptimal() || local_state.IsInfeasible()) {
+        stop_solvers = true;
+        break;
+      }
+      if (optimization_status == BopOptimizerBase::ABORT) break;
+    }
+
+    absl::MutexLock lock(&mutex);
+    problem_state_.MergeLearnedInfo(local_state.GetLearnedInfo(),
+                                    local_state.IsInfeasible()
+                                        ? BopOptimizerBase::INFEASIBLE
+                                        : BopOptimizerBase::CONTINUE);
+    deterministic_times[solver_index] =
+        local_time_limit.GetElapsedDeterministicTime();
+  };
+  {
+    ThreadPool thread_pool("BopSolver", num_solvers);
+    thread_pool.StartWorkers();
+    for (int i = 0; i < num_solvers; ++i) {
+      thread_pool.Schedule([&run_solver, i]() { run_solver(i); });
+    }
+  }
+  time_limit->AdvanceDeterministicTime(*std::max_element(
+      deterministic_times.begin(), deterministic_times.end()));
+  return GetMultithreadStatus();
+}
+
+BopSolveStatus BopSolver::InternalSynchronizedMultithreadSolver(
+    TimeLimit* time_limit) {
+  CHECK(time_limit != nullptr);
+  const int num_solvers = parameters_.number_of_solvers();
+  const bool synchronize_all =
+      parameters_.synchronization_type() == BopParameters::SYNCHRONIZE_ALL;
+
+  // The solvers run their optimizers in rounds: each active solver runs one
+  // optimizer, then we wait for all of them before exchanging the learned
+  // information in the solver order. With SYNCHRONIZE_ALL, every solver
+  // learns what all the others found in the round; with SYNCHRONIZE_ON_RIGHT,
+  // solver i only learns from solvers 0..i. Since nothing depends on which
+  // thread finishes first, the search is deterministic as long as only the
+  // deterministic time limit is reached.
+  struct Solver {
+    Solver(const sat::LinearBooleanProblem& problem,
+           const BopParameters& params, double time_left,
+           double deterministic_time_left)
+        : parameters(params),
+          state(problem),
+          learned_info(problem),
+          time_limit(time_left, deterministic_time_left) {}
+
+    BopParameters parameters;
+    ProblemState state;
+    LearnedInfo learned_info;
+    TimeLimit time_limit;
+    std::unique_ptr<PortfolioOptimizer> optimizer;
+    BopOptimizerBase::Status status = BopOptimizerBase::CONTINUE;
+    bool ran = false;
+    bool done = false;
+  };
+  std::vector<std::unique_ptr<Solver>> solvers;
+  std::atomic<bool>* const external_stop = time_limit->ExternalBooleanAsLimit();
+  for (int i = 0; i < num_solvers; ++i) {
+    BopParameters local_parameters = parameters_;
+    local_parameters.set_random_seed(parameters_.random_seed() + i);
+    solvers.push_back(std::make_unique<Solver>(
+        problem_, local_parameters, time_limit->GetTimeLeft(),
+        time_limit->GetDeterministicTimeLeft()));
+    Solver& solver = *solvers.back();
+    solver.state.SetParameters(local_parameters);
+    solver.state.set_assignment_preference(
+        problem_state_.assignment_preference());
+    solver.state.MergeLearnedInfo(problem_state_.GetLearnedInfo(),
+                                  BopOptimizerBase::CONTINUE);
+    solver.time_limit.RegisterExternalBooleanAsLimit(external_stop);
+    const int set_index =
+        std::min(i, parameters_.solver_optimizer_sets_size() - 1);
+    solver.optimizer = std::make_unique<PortfolioOptimizer>(
+        solver.state, local_parameters,
+        parameters_.solver_optimizer_sets(set_index),
+        absl::StrCat("Portfolio_", i));
+  }
+
+  ThreadPool thread_pool("BopSolver", num_solvers);
+  thread_pool.StartWorkers();
+  while (!problem_state_.IsOptimal() && !problem_state_.IsInfeasible()) {
+    int num_active_solvers = 0;
+    for (const auto& solver : solvers) {
+      solver->ran = !solver->done && !solver->time_limit.LimitReached();
+      if (solver->ran) ++num_active_solvers;
+    }
+    if (num_active_solvers == 0) break;
+
+    absl::BlockingCounter blocking_counter(num_active_solvers);
+    for (const auto& solver : solvers) {
+      if (!solver->ran) continue;
+      thread_pool.Schedule([s = solver.get(), &blocking_counter]() {
+        s->status = s->optimizer->Optimize(s->parameters, s->state,
+                                           &s->learned_info, &s->time_limit);
+        blocking_counter.DecrementCount();
+      });
+    }
+    blocking_counter.Wait();
+
+    for (int i = 0; i < num_solvers; ++i) {
+      Solver& solver = *solvers[i];
+      if (!solver.ran) continue;
+      problem_state_.MergeLearnedInfo(solver.learned_info, solver.status);
+      const int last = synchronize_all ? num_solvers - 1 : i;
+      for (int j = 0; j <= last; ++j) {
+        if (!solvers[j]->ran) continue;
+        solver.state.MergeLearnedInfo(solvers[j]->learned_info,
+                                      solvers[j]->status);
+      }
+    }
+    for (const auto& solver : solvers) {
+      if (!solver->ran) continue;
+      solver->done = solver->status == BopOptimizerBase::ABORT;
+      solver->learned_info.Clear();
+    }
+  }
+
+  double deterministic_time = 0.0;
+  for (const auto& solver : solvers) {
+    deterministic_time = std::max(
+        deterministic_time, solver->time_limit.GetElapsedDeterministicTime());
+  }
+  time_limit->AdvanceDeterministicTime(deterministic_time);
+  return GetMultithreadStatus();
+}
+
+BopSolveStatus BopSolver::GetMultithreadStatus() const {
+  if (problem_state_.IsOptimal()) {
+    return BopSolveStatus::OPTIMAL_SOLUTION_FOUND;
+  } else if (problem_state_.IsInfeasible()) {
+    return BopSolveStatus::INFEASIBLE_PROBLEM;
+  }
+  return problem_state_.solution().IsFeasible()
+             ? BopSolveStatus::FEASIBLE_SOLUTION_FOUND
+             : BopSolveStatus::NO_SOLUTION_FOUND;
 }
 
 BopSolveStatus BopSolver::Solve(const BopSolution& first_solution) {
@@ -81,6 +81,8 @@ class BopSolver {
   void UpdateParameters();
   BopSolveStatus InternalMonothreadSolver(TimeLimit* time_limit);
   BopSolveStatus InternalMultithreadSolver(TimeLimit* time_limit);
+  BopSolveStatus InternalSynchronizedMultithreadSolver(TimeLimit* time_limit);
+  BopSolveStatus GetMultithreadStatus() const;
 
   const sat::LinearBooleanProblem& problem_;
   ProblemState problem_state_;
@@ -656,20 +656,26 @@ class CompressedTrail {
   void PopBack() {
     if (size_ > 0) {
       --current_;
-      if (current_ <= 0) {
-        if (buffer_used_) {
-          data_.swap(buffer_);
-          current_ = block_size_;
-          buffer_used_ = false;
-        } else if (blocks_ != nullptr) {
-          packer_->Unpack(blocks_->compressed, data_.get());
-          FreeTopBlock();
-          current_ = block_size_;
-        }
-      }
+      if (current_ <= 0) RefillData();
       --size_;
     }
   }
+  // Restores and pops all the entries above 'target', most recent first.
+  // Equivalent to calling Back().restore() and PopBack() in a loop, but
+  // restores each block in a tight loop.
+  void BacktrackTo(int target) {
+    DCHECK_GE(target, 0);
+    while (size_ > target) {
+      const int count = std::min(current_, size_ - target);
+      const addrval<T>* const data = data_.get();
+      for (int i = current_ - 1; i >= current_ - count; --i) {
+        data[i].restore();
+      }
+      current_ -= count;
+      size_ -= count;
+      if (current_ <= 0) RefillData();
+    }
+  }
   void PushBack(const addrval<T>& addr_val) {
     if (current_ >= block_size_) {
       if (buffer_used_) {  // Buffer is used.
@@ -695,6 +701,18 @@ class CompressedTrail {
     Block* next;
   };
 
+  // Moves the most recent saved block, if any, into data_.
+  void RefillData() {
+    if (buffer_used_) {
+      data_.swap(buffer_);
+      current_ = block_size_;
+      buffer_used_ = false;
+    } else if (blocks_ != nullptr) {
+      packer_->Unpack(blocks_->compressed, data_.get());
+      FreeTopBlock();
+      current_ = block_size_;
+    }
+  }
   void FreeTopBlock() {
     Block* block = blocks_;
     blocks_ = block->next;
@@ -768,43 +786,23 @@ struct Trail {
 
   void BacktrackTo(StateMarker* m) {
     int target = m->rev_int_index_;
-    for (int curr = rev_ints_.size(); curr > target; --curr) {
-      const addrval<int>& cell = rev_ints_.Back();
-      cell.restore();
-      rev_ints_.PopBack();
-    }
+    rev_ints_.BacktrackTo(target);
     DCHECK_EQ(rev_ints_.size(), target);
     // Incorrect trail size after backtrack.
     target = m->rev_int64_index_;
-    for (int curr = rev_int64s_.size(); curr > target; --curr) {
-      const addrval<int64_t>& cell = rev_int64s_.Back();
-      cell.restore();
-      rev_int64s_.PopBack();
-    }
+    rev_int64s_.BacktrackTo(target);
     DCHECK_EQ(rev_int64s_.size(), target);
     // Incorrect trail size after backtrack.
     target = m->rev_uint64_index_;
-    for (int curr = rev_uint64s_.size(); curr > target; --curr) {
-      const addrval<uint64_t>& cell = rev_uint64s_.Back();
-      cell.restore();
-      rev_uint64s_.PopBack();
-    }
+    rev_uint64s_.BacktrackTo(target);
     DCHECK_EQ(rev_uint64s_.size(), target);
     // Incorrect trail size after backtrack.
     target = m->rev_double_index_;
-    for (int curr = rev_doubles_.size(); curr > target; --curr) {
-      const addrval<double>& cell = rev_doubles_.Back();
-      cell.restore();
-      rev_doubles_.PopBack();
-    }
+    rev_doubles_.BacktrackTo(target);
     DCHECK_EQ(rev_doubles_.size(), target);
     // Incorrect trail size after backtrack.
     target = m->rev_ptr_index_;
-    for (int curr = rev_ptrs_.size(); curr > target; --curr) {
-      const addrval<void*>& cell = rev_ptrs_.Back();
-      cell.restore();
-      rev_ptrs_.PopBack();
-    }
+    rev_ptrs_.BacktrackTo(target);
     DCHECK_EQ(rev_ptrs_.size(), target);
     // Incorrect trail size after backtrack.
     target = m->rev_boolvar_list_index_;
@@ -5231,6 +5231,15 @@ class AssignmentContainer {
   /// Copies all the elements of 'container' to this container, clearing its
   /// previous content.
   void Copy(const AssignmentContainer<V, E>& container) {
+    // When both containers hold the same variables in the same order (the
+    // usual case in local search), copy in place: this keeps elements_map_
+    // valid and reuses the memory held by the elements.
+    if (HasSameVariablesAs(container)) {
+      for (int i = 0; i < container.elements_.size(); ++i) {
+        elements_[i].Copy(container.elements_[i]);
+      }
+      return;
+    }
     Clear();
     for (int i = 0; i < container.elements_.size(); ++i) {
       const E& element = container.elements_[i];
@@ -5317,6 +5326,13 @@ class AssignmentContainer {
   }
 
  private:
+  bool HasSameVariablesAs(const AssignmentContainer<V, E>& container) const {
+    if (elements_.size() != container.elements_.size()) return false;
+    for (int i = 0; i < elements_.size(); ++i) {
+      if (elements_[i].Var() != container.elements_[i].Var()) return false;
+    }
+    return true;
+  }
   void EnsureMapIsUpToDate() const {
     absl::flat_hash_map<const V*, int>* map =
         const_cast<absl::flat_hash_map<const V*, int>*>(&elements_map_);
@@ -55,7 +55,11 @@ class DemonProfiler : public PropagationMonitor {
       : PropagationMonitor(solver),
         active_constraint_(nullptr),
         active_demon_(nullptr),
-        start_time_ns_(absl::GetCurrentTimeNanos()) {}
+        start_time_ns_(absl::GetCurrentTimeNanos()),
+        sampling_period_(std::max(
+            1, solver->const_parameters()
+                   .profile_propagation_sampling_period())),
+        runs_to_next_sample_(0) {}
 
   ~DemonProfiler() override {
     gtl::STLDeleteContainerPairSecondPointers(constraint_map_.begin(),
@@ -151,6 +155,12 @@ class DemonProfiler : public PropagationMonitor {
       return;
     }
     CHECK(active_demon_ == nullptr);
+    // Only time one run out of sampling_period_.
+    if (runs_to_next_sample_ > 0) {
+      --runs_to_next_sample_;
+      return;
+    }
+    runs_to_next_sample_ = sampling_period_ - 1;
     active_demon_ = demon;
     DemonRuns* const demon_run = demon_map_[active_demon_];
     if (demon_run != nullptr) {
@@ -163,6 +173,9 @@ class DemonProfiler : public PropagationMonitor {
     if (demon->priority() == Solver::VAR_PRIORITY) {
       return;
     }
+    if (active_demon_ == nullptr && sampling_period_ > 1) {
+      return;  // This run was not sampled.
+    }
     CHECK_EQ(active_demon_, demon);
     DemonRuns* const demon_run = demon_map_[active_demon_];
     if (demon_run != nullptr) {
@@ -425,6 +438,8 @@ class DemonProfiler : public PropagationMonitor {
   Constraint* active_constraint_;
   Demon* active_demon_;
   const int64_t start_time_ns_;
+  const int sampling_period_;
+  int runs_to_next_sample_;
   absl::flat_hash_map<const Constraint*, ConstraintRuns*> constraint_map_;
   absl::flat_hash_map<const Demon*, DemonRuns*> demon_map_;
   absl::flat_hash_map<const Constraint*, std::vector<DemonRuns*> >
@@ -3583,10 +3583,11 @@ class SumObjectiveFilter : public IntVarLocalSearchFilter {
     if (delta == nullptr) return false;
     if (deltadelta->Empty()) {
       if (incremental_) {
-        for (int i = 0; i < primary_vars_size_; ++i) {
-          delta_costs_[i] = synchronized_costs_[i];
+        for (const int index : changed_delta_costs_) {
+          delta_costs_[index] = synchronized_costs_[index];
         }
       }
+      changed_delta_costs_.clear();
       incremental_ = false;
       delta_sum_ = CapAdd(synchronized_sum_, CostOfChanges(delta, false));
     } else {
@@ -3615,9 +3616,22 @@ class SumObjectiveFilter : public IntVarLocalSearchFilter {
   int64_t GetAcceptedObjectiveValue() const override { return delta_sum_; }
 
  protected:
+  // Sets the incremental cost of the primary variable 'index', keeping track
+  // of the costs differing from their synchronized value so that they can be
+  // reset in O(changes).
+  void SetDeltaCost(int64_t index, int64_t cost) {
+    if (delta_costs_[index] == synchronized_costs_[index] &&
+        cost != delta_costs_[index]) {
+      changed_delta_costs_.push_back(index);
+    }
+    delta_costs_[index] = cost;
+  }
+
   const int primary_vars_size_;
   std::vector<int64_t> synchronized_costs_;
   std::vector<int64_t> delta_costs_;
+  // Indices of delta_costs_ which may differ from synchronized_costs_.
+  std::vector<int> changed_delta_costs_;
   Filter filter_;
   int64_t synchronized_sum_;
   int64_t delta_sum_;
@@ -3633,6 +3647,7 @@ class SumObjectiveFilter : public IntVarLocalSearchFilter {
       synchronized_sum_ = CapAdd(synchronized_sum_, cost);
     }
     delta_sum_ = synchronized_sum_;
+    changed_delta_costs_.clear();
     incremental_ = false;
   }
 };
@@ -3666,7 +3681,7 @@ class BinaryObjectiveFilter : public SumObjectiveFilter<Filter> {
         }
         total_cost = CapAdd(total_cost, new_cost);
         if (incremental) {
-          this->delta_costs_[index] = new_cost;
+          this->SetDeltaCost(index, new_cost);
         }
       }
     }
@@ -3742,7 +3757,7 @@ class TernaryObjectiveFilter : public SumObjectiveFilter<Filter> {
         }
         total_cost = CapAdd(total_cost, new_cost);
         if (incremental) {
-          this->delta_costs_[index] = new_cost;
+          this->SetDeltaCost(index, new_cost);
         }
       }
     }
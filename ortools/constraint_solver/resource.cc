@@ -44,6 +44,7 @@
 #include "ortools/util/bitset.h"
 #include "ortools/util/monoid_operation_tree.h"
 #include "ortools/util/saturated_arithmetic.h"
+#include "ortools/util/sort.h"
 #include "ortools/util/string_array.h"
 
 namespace operations_research {
@@ -487,13 +488,13 @@ NotLast::NotLast(Solver* const solver,
 
 bool NotLast::Propagate() {
   // ---- Init ----
-  std::sort(by_start_max_.begin(), by_start_max_.end(),
-            StartMaxLessThan<DisjunctiveTask>);
-  std::sort(by_end_max_.begin(), by_end_max_.end(),
-            EndMaxLessThan<DisjunctiveTask>);
+  IncrementalSort(by_start_max_.begin(), by_start_max_.end(),
+                  StartMaxLessThan<DisjunctiveTask>);
+  IncrementalSort(by_end_max_.begin(), by_end_max_.end(),
+                  EndMaxLessThan<DisjunctiveTask>);
   // Update start min positions
-  std::sort(by_start_min_.begin(), by_start_min_.end(),
-            StartMinLessThan<DisjunctiveTask>);
+  IncrementalSort(by_start_min_.begin(), by_start_min_.end(),
+                  StartMinLessThan<DisjunctiveTask>);
   for (int i = 0; i < by_start_min_.size(); ++i) {
     by_start_min_[i]->index = i;
   }
@@ -611,8 +612,8 @@ EdgeFinderAndDetectablePrecedences::EdgeFinderAndDetectablePrecedences(
 }
 
 void EdgeFinderAndDetectablePrecedences::UpdateEst() {
-  std::sort(by_start_min_.begin(), by_start_min_.end(),
-            ShortestDurationStartMinLessThan<DisjunctiveTask>);
+  IncrementalSort(by_start_min_.begin(), by_start_min_.end(),
+                  ShortestDurationStartMinLessThan<DisjunctiveTask>);
   for (int i = 0; i < size(); ++i) {
     by_start_min_[i]->index = i;
   }
@@ -621,8 +622,8 @@ void EdgeFinderAndDetectablePrecedences::UpdateEst() {
 void EdgeFinderAndDetectablePrecedences::OverloadChecking() {
   // Initialization.
   UpdateEst();
-  std::sort(by_end_max_.begin(), by_end_max_.end(),
-            EndMaxLessThan<DisjunctiveTask>);
+  IncrementalSort(by_end_max_.begin(), by_end_max_.end(),
+                  EndMaxLessThan<DisjunctiveTask>);
   theta_tree_.Clear();
 
   for (DisjunctiveTask* const task : by_end_max_) {
@@ -639,10 +640,10 @@ bool EdgeFinderAndDetectablePrecedences::DetectablePrecedences() {
   new_est_.assign(size(), std::numeric_limits<int64_t>::min());
 
   // Propagate in one direction
-  std::sort(by_end_min_.begin(), by_end_min_.end(),
-            EndMinLessThan<DisjunctiveTask>);
-  std::sort(by_start_max_.begin(), by_start_max_.end(),
-            StartMaxLessThan<DisjunctiveTask>);
+  IncrementalSort(by_end_min_.begin(), by_end_min_.end(),
+                  EndMinLessThan<DisjunctiveTask>);
+  IncrementalSort(by_start_max_.begin(), by_start_max_.end(),
+                  StartMaxLessThan<DisjunctiveTask>);
   theta_tree_.Clear();
   int j = 0;
   for (DisjunctiveTask* const task_i : by_end_min_) {
@@ -692,8 +693,8 @@ bool EdgeFinderAndDetectablePrecedences::EdgeFinder() {
   }
 
   // Push in one direction.
-  std::sort(by_end_max_.begin(), by_end_max_.end(),
-            EndMaxLessThan<DisjunctiveTask>);
+  IncrementalSort(by_end_max_.begin(), by_end_max_.end(),
+                  EndMaxLessThan<DisjunctiveTask>);
   lt_tree_.Clear();
   for (int i = 0; i < size(); ++i) {
     lt_tree_.Insert(*by_start_min_[i]);
@@ -1494,15 +1495,17 @@ class EdgeFinder : public Constraint {
     }
 
     // sort by start min.
-    std::sort(by_start_min_.begin(), by_start_min_.end(),
-              StartMinLessThan<Task>);
+    IncrementalSort(by_start_min_.begin(), by_start_min_.end(),
+                    StartMinLessThan<Task>);
     for (int i = 0; i < by_start_min_.size(); ++i) {
       by_start_min_[i]->index = i;
     }
     // Sort by end max.
-    std::sort(by_end_max_.begin(), by_end_max_.end(), EndMaxLessThan<Task>);
+    IncrementalSort(by_end_max_.begin(), by_end_max_.end(),
+                    EndMaxLessThan<Task>);
     // Sort by end min.
-    std::sort(by_end_min_.begin(), by_end_min_.end(), EndMinLessThan<Task>);
+    IncrementalSort(by_end_min_.begin(), by_end_min_.end(),
+                    EndMinLessThan<Task>);
     // Initialize the tree with the new capacity.
     lt_tree_.Init(capacity_->Max());
     // Clear updates
@@ -1816,8 +1819,8 @@ class CumulativeTimeTable : public Constraint {
 
   // Update the start min for all tasks. Runs in O(n^2) and Omega(n).
   void PushTasks() {
-    std::sort(by_start_min_.begin(), by_start_min_.end(),
-              StartMinLessThan<Task>);
+    IncrementalSort(by_start_min_.begin(), by_start_min_.end(),
+                    StartMinLessThan<Task>);
     int64_t usage = 0;
     int profile_index = 0;
     for (const Task* const task : by_start_min_) {
@@ -247,12 +247,11 @@ void RoutingModel::NodeNeighborsByCostClass::ComputeNeighbors(
   const int num_cost_classes = routing_model.GetCostClassesCount();
   for (int node_index = 0; node_index < size_with_vehicle_nodes; node_index++) {
     node_index_to_neighbors_by_cost_class_[node_index].resize(num_cost_classes);
-    for (int cc = 0; cc < num_cost_classes; cc++) {
-      node_index_to_neighbors_by_cost_class_[node_index][cc] =
-          std::make_unique<SparseBitset<int>>(size);
-    }
   }
 
+  // Neighbors are first collected with duplicates, and deduplicated at the end.
+  // This uses memory proportional to the number of neighbors, instead of one
+  // bitset of the size of the model per node and cost class.
   std::vector<std::pair</*cost*/ int64_t, /*node*/ int>> cost_nodes;
   cost_nodes.reserve(size);
   for (int node_index = 0; node_index < size_with_vehicle_nodes; ++node_index) {
@@ -284,16 +283,16 @@ void RoutingModel::NodeNeighborsByCostClass::ComputeNeighbors(
       // Make sure the order of the n first element is always the same.
       std::sort(cost_nodes.begin(), cost_nodes.end());
 
-      auto& node_neighbors =
+      std::vector<int>& node_neighbors =
           node_index_to_neighbors_by_cost_class_[node_index][cost_class];
       for (const auto& costed_node : cost_nodes) {
         const int neighbor = costed_node.second;
-        node_neighbors->Set(neighbor);
+        node_neighbors.push_back(neighbor);
 
         // Add reverse neighborhood.
         DCHECK(!routing_model.IsEnd(neighbor) &&
                !routing_model.IsStart(neighbor));
-        node_index_to_neighbors_by_cost_class_[neighbor][cost_class]->Set(
+        node_index_to_neighbors_by_cost_class_[neighbor][cost_class].push_back(
             node_index);
       }
       // Add all vehicle starts as neighbors to this node and vice-versa.
@@ -301,15 +300,36 @@ void RoutingModel::NodeNeighborsByCostClass::ComputeNeighbors(
       // prune arcs going from node to start for instance.
       for (int vehicle = 0; vehicle < routing_model.vehicles(); vehicle++) {
         const int vehicle_start = routing_model.Start(vehicle);
-        if (add_vehicle_starts_to_neighbors) node_neighbors->Set(vehicle_start);
-        node_index_to_neighbors_by_cost_class_[vehicle_start][cost_class]->Set(
-            node_index);
+        if (add_vehicle_starts_to_neighbors) {
+          node_neighbors.push_back(vehicle_start);
+        }
+        node_index_to_neighbors_by_cost_class_[vehicle_start][cost_class]
+            .push_back(node_index);
         node_index_to_neighbors_by_cost_class_[routing_model.End(vehicle)]
                                               [cost_class]
-                                                  ->Set(node_index);
+                                                  .push_back(node_index);
       }
     }
   }
+
+  // Remove duplicates, keeping the first occurrence of each neighbor. This
+  // gives the same order as SparseBitset::PositionsSetAtLeastOnce() would on
+  // the same sequence of insertions.
+  SparseBitset<int> seen(size);
+  for (std::vector<std::vector<int>>& neighbors_by_cost_class :
+       node_index_to_neighbors_by_cost_class_) {
+    for (std::vector<int>& neighbors : neighbors_by_cost_class) {
+      int new_size = 0;
+      for (const int neighbor : neighbors) {
+        if (seen[neighbor]) continue;
+        seen.Set(neighbor);
+        neighbors[new_size++] = neighbor;
+      }
+      neighbors.resize(new_size);
+      neighbors.shrink_to_fit();
+      seen.SparseClearAll();
+    }
+  }
 }
 
 const RoutingModel::NodeNeighborsByCostClass*
@@ -525,10 +545,23 @@ int RoutingModel::RegisterTransitMatrix(
           ? kTransitEvaluatorSignPositiveOrZero
           : (all_transits_leq_zero ? kTransitEvaluatorSignNegativeOrZero
                                    : kTransitEvaluatorSignUnknown);
+  // Store the matrix as a single flat array, which saves an indirection and
+  // improves locality on each evaluation. The rows do not need to have the
+  // same size, so each of them gets the width of the widest one.
+  int64_t num_columns = 0;
+  for (const std::vector<int64_t>& transit_values : values) {
+    num_columns = std::max<int64_t>(num_columns, transit_values.size());
+  }
+  std::vector<int64_t> flat_values(values.size() * num_columns, 0);
+  for (int64_t node = 0; node < values.size(); ++node) {
+    std::copy(values[node].begin(), values[node].end(),
+              flat_values.begin() + node * num_columns);
+  }
   return RegisterTransitCallback(
-      [this, values = std::move(values)](int64_t i, int64_t j) {
-        return values[manager_.IndexToNode(i).value()]
-                     [manager_.IndexToNode(j).value()];
+      [this, flat_values = std::move(flat_values), num_columns](int64_t i,
+                                                                int64_t j) {
+        return flat_values[manager_.IndexToNode(i).value() * num_columns +
+                           manager_.IndexToNode(j).value()];
       },
       sign);
 }
@@ -2050,9 +2083,11 @@ void RoutingModel::CloseModelWithParameters(
 
   // Reduce domain of next variables.
   for (int i = 0; i < size; ++i) {
-    // No variable can point back to a start.
-    solver_->AddConstraint(MakeDifferentFromValues(solver_.get(), nexts_[i],
-                                                   paths_metadata_.Starts()));
+    // No variable can point back to a start. The starts are shared by all the
+    // constraints, since copying them for each node would take
+    // O(num_nodes * num_vehicles) memory.
+    solver_->AddConstraint(MakeDifferentFromValues(
+        solver_.get(), nexts_[i], &paths_metadata_.Starts()));
     // Extra constraint to state an active node can't point to itself.
     solver_->AddConstraint(
         solver_->MakeIsDifferentCstCt(nexts_[i], i, active_[i]));
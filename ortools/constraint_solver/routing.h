@@ -1452,14 +1452,14 @@ class RoutingModel {
     /// Returns the neighbors of the given node for the given cost_class.
     const std::vector<int>& GetNeighborsOfNodeForCostClass(
         int cost_class, int node_index) const {
-      return all_nodes_.empty() ? node_index_to_neighbors_by_cost_class_
-                                      [node_index][cost_class]
-                                          ->PositionsSetAtLeastOnce()
-                                : all_nodes_;
+      return all_nodes_.empty()
+                 ? node_index_to_neighbors_by_cost_class_[node_index]
+                                                         [cost_class]
+                 : all_nodes_;
     }
 
    private:
-    std::vector<std::vector<std::unique_ptr<SparseBitset<int>>>>
+    std::vector<std::vector<std::vector<int>>>
         node_index_to_neighbors_by_cost_class_;
     std::vector<int> all_nodes_;
   };
@@ -1675,6 +1675,9 @@ class RoutingModel {
                                    bool call_at_solution_monitors);
   /// Returns the underlying constraint solver. Can be used to add extra
   /// constraints and/or modify search algorithms.
+  /// Per-operator and per-filter statistics of the local search are available
+  /// from solver()->GetLocalSearchStatistics() when the model is created with
+  /// solver_parameters.profile_local_search set in its RoutingModelParameters.
   Solver* solver() const { return solver_.get(); }
 
   /// Returns true if the search limit has been crossed with the given time
@@ -36,7 +36,13 @@ namespace {
 class DifferentFromValues : public Constraint {
  public:
   DifferentFromValues(Solver* solver, IntVar* var, std::vector<int64_t> values)
-      : Constraint(solver), var_(var), values_(std::move(values)) {}
+      : Constraint(solver),
+        var_(var),
+        owned_values_(std::move(values)),
+        values_(owned_values_) {}
+  DifferentFromValues(Solver* solver, IntVar* var,
+                      const std::vector<int64_t>* values)
+      : Constraint(solver), var_(var), values_(*values) {}
   void Post() override {}
   void InitialPropagate() override { var_->RemoveValues(values_); }
   std::string DebugString() const override { return "DifferentFromValues"; }
@@ -50,7 +56,9 @@ class DifferentFromValues : public Constraint {
 
  private:
   IntVar* const var_;
-  const std::vector<int64_t> values_;
+  // Empty if the values are not owned.
+  const std::vector<int64_t> owned_values_;
+  const std::vector<int64_t>& values_;
 };
 }  // namespace
 
@@ -60,6 +68,11 @@ Constraint* MakeDifferentFromValues(Solver* solver, IntVar* var,
       new DifferentFromValues(solver, var, std::move(values)));
 }
 
+Constraint* MakeDifferentFromValues(Solver* solver, IntVar* var,
+                                    const std::vector<int64_t>* values) {
+  return solver->RevAlloc(new DifferentFromValues(solver, var, values));
+}
+
 namespace {
 // For each vehicle, computes information on the partially fixed start/end
 // chains (based on bound NextVar values):
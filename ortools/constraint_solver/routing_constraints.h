@@ -25,6 +25,12 @@ namespace operations_research {
 Constraint* MakeDifferentFromValues(Solver* solver, IntVar* var,
                                     std::vector<int64_t> values);
 
+/// Same as above, but the values are not copied and must outlive the
+/// constraint. This saves one copy of the values per variable when the same
+/// values are removed from many variables.
+Constraint* MakeDifferentFromValues(Solver* solver, IntVar* var,
+                                    const std::vector<int64_t>* values);
+
 Constraint* MakeResourceConstraint(
     const RoutingModel::ResourceGroup* resource_group,
     const std::vector<IntVar*>* vehicle_resource_vars, RoutingModel* model);
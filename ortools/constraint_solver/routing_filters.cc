@@ -980,20 +980,25 @@ class PathCumulFilter : public BasePathFilter {
 
   // This class caches transit values between nodes of paths. Transit and path
   // nodes are to be added in the order in which they appear on a path.
+  // The memory of cleared paths is kept, so that filtering a delta usually does
+  // not need any allocation.
   class PathTransits {
    public:
     void Clear() {
-      paths_.clear();
-      transits_.clear();
+      for (int path = 0; path < num_paths_; ++path) ClearPath(path);
+      num_paths_ = 0;
     }
     void ClearPath(int path) {
       paths_[path].clear();
       transits_[path].clear();
     }
     int AddPaths(int num_paths) {
-      const int first_path = paths_.size();
-      paths_.resize(first_path + num_paths);
-      transits_.resize(first_path + num_paths);
+      const int first_path = num_paths_;
+      num_paths_ += num_paths;
+      if (paths_.size() < static_cast<size_t>(num_paths_)) {
+        paths_.resize(num_paths_);
+        transits_.resize(num_paths_);
+      }
       return first_path;
     }
     void ReserveTransits(int path, int number_of_route_arcs) {
@@ -1010,7 +1015,7 @@ class PathCumulFilter : public BasePathFilter {
       DCHECK_EQ(paths_[path].back(), node);
       paths_[path].push_back(next);
     }
-    int NumPaths() const { return paths_.size(); }
+    int NumPaths() const { return num_paths_; }
     int PathSize(int path) const { return paths_[path].size(); }
     int Node(int path, int position) const { return paths_[path][position]; }
     int64_t Transit(int path, int position) const {
@@ -1023,6 +1028,8 @@ class PathCumulFilter : public BasePathFilter {
     // transits_[r][i] is the transit value between nodes path_[i] and
     // path_[i+1] on path r.
     std::vector<std::vector<int64_t>> transits_;
+    // Only the first num_paths_ paths of paths_ and transits_ are used.
+    int num_paths_ = 0;
   };
 
   bool InitializeAcceptPath() override {
@@ -1157,6 +1164,14 @@ class PathCumulFilter : public BasePathFilter {
                                           int path, int64_t path_start,
                                           int64_t min_end_cumul) const;
 
+  // Calls optimizer->ComputeRouteCumulCostWithoutFixedTransits() on the path
+  // of the vehicle in the current delta, reusing the result if the same path
+  // was already optimized since the last synchronization. This happens often,
+  // for instance for the path a node is removed from, which is the same for
+  // all the positions at which the node can be inserted.
+  DimensionSchedulingStatus ComputeRouteCumulCostWithCache(
+      LocalDimensionCumulOptimizer* optimizer, int vehicle, int64_t* cost);
+
   const RoutingModel& routing_model_;
   const RoutingDimension& dimension_;
   const std::vector<IntVar*> cumuls_;
@@ -1213,6 +1228,17 @@ class PathCumulFilter : public BasePathFilter {
   const bool propagate_own_objective_value_;
 
   std::vector<int64_t> min_path_cumuls_;
+
+  // Results of ComputeRouteCumulCostWithCache(), keyed by whether the MP
+  // optimizer was used, the vehicle and the nodes of its path.
+  struct RouteCumulCost {
+    DimensionSchedulingStatus status;
+    int64_t cost;
+  };
+  static constexpr int kMaxRouteCumulCostCacheSize = 1 << 12;
+  absl::flat_hash_map<std::vector<int64_t>, RouteCumulCost>
+      route_cumul_cost_cache_;
+  std::vector<int64_t> route_cumul_cost_cache_key_;
 };
 
 PathCumulFilter::PathCumulFilter(const RoutingModel& routing_model,
@@ -1394,7 +1420,37 @@ int64_t PathCumulFilter::GetPathCumulSoftLowerBoundCost(
   return current_cumul_cost_value;
 }
 
+DimensionSchedulingStatus PathCumulFilter::ComputeRouteCumulCostWithCache(
+    LocalDimensionCumulOptimizer* optimizer, int vehicle, int64_t* cost) {
+  std::vector<int64_t>& key = route_cumul_cost_cache_key_;
+  key.clear();
+  key.push_back(optimizer == mp_optimizer_);
+  key.push_back(vehicle);
+  for (int64_t node = routing_model_.Start(vehicle);
+       !routing_model_.IsEnd(node); node = GetNext(node)) {
+    DCHECK_NE(node, kUnassigned);
+    key.push_back(node);
+  }
+  if (const auto it = route_cumul_cost_cache_.find(key);
+      it != route_cumul_cost_cache_.end()) {
+    if (cost != nullptr) *cost = it->second.cost;
+    return it->second.status;
+  }
+  int64_t route_cost = 0;
+  const DimensionSchedulingStatus status =
+      optimizer->ComputeRouteCumulCostWithoutFixedTransits(
+          vehicle, path_accessor_, cost != nullptr ? &route_cost : nullptr);
+  if (cost != nullptr) *cost = route_cost;
+  if (route_cumul_cost_cache_.size() >= kMaxRouteCumulCostCacheSize) {
+    route_cumul_cost_cache_.clear();
+  }
+  route_cumul_cost_cache_[key] = {status, route_cost};
+  return status;
+}
+
 void PathCumulFilter::OnBeforeSynchronizePaths() {
+  // The cached route costs were computed for deltas of the previous solution.
+  route_cumul_cost_cache_.clear();
   total_current_cumul_cost_value_ = 0;
   cumul_cost_delta_ = 0;
   current_cumul_cost_values_.clear();
@@ -1584,14 +1640,9 @@ bool PathCumulFilter::AcceptPath(int64_t path_start, int64_t /*chain_start*/,
     cumul_cost_delta = CapAdd(GetCumulSoftCost(node, cumul),
                               GetCumulPiecewiseLinearCost(node, cumul));
   }
-  // Evaluating route length to reserve memory to store transit information.
-  int number_of_route_arcs = 0;
-  while (node < Size()) {
-    ++number_of_route_arcs;
-    node = GetNext(node);
-    DCHECK_NE(node, kUnassigned);
-  }
-  delta_path_transits_.ReserveTransits(path, number_of_route_arcs);
+  // There is no need to reserve memory for the transits of the path: the
+  // memory of previous deltas is reused, and not walking the whole path first
+  // makes infeasible paths cheaper to reject.
   min_path_cumuls_.clear();
   min_path_cumuls_.push_back(cumul);
   // Check that the path is feasible with regards to cumul bounds, scanning
@@ -1600,6 +1651,7 @@ bool PathCumulFilter::AcceptPath(int64_t path_start, int64_t /*chain_start*/,
   node = path_start;
   while (node < Size()) {
     const int64_t next = GetNext(node);
+    DCHECK_NE(next, kUnassigned);
     const int64_t transit = (*evaluators_[vehicle])(node, next);
     total_transit = CapAdd(total_transit, transit);
     const int64_t transit_slack = CapAdd(transit, slacks_[node]->Min());
@@ -1849,10 +1901,9 @@ bool PathCumulFilter::FinalizeAcceptPath(int64_t /*objective_min*/,
         continue;
       }
       int64_t path_delta_cost_with_lp = 0;
-      const DimensionSchedulingStatus status =
-          optimizer_->ComputeRouteCumulCostWithoutFixedTransits(
-              vehicle, path_accessor_,
-              filter_objective_cost_ ? &path_delta_cost_with_lp : nullptr);
+      const DimensionSchedulingStatus status = ComputeRouteCumulCostWithCache(
+          optimizer_, vehicle,
+          filter_objective_cost_ ? &path_delta_cost_with_lp : nullptr);
       if (status == DimensionSchedulingStatus::INFEASIBLE) {
         return false;
       }
@@ -1884,8 +1935,8 @@ bool PathCumulFilter::FinalizeAcceptPath(int64_t /*objective_min*/,
       const int64_t start = GetTouchedPathStarts()[i];
       const int vehicle = start_to_vehicle_[start];
       int64_t path_delta_cost_with_mp = 0;
-      if (mp_optimizer_->ComputeRouteCumulCostWithoutFixedTransits(
-              vehicle, path_accessor_,
+      if (ComputeRouteCumulCostWithCache(
+              mp_optimizer_, vehicle,
               filter_objective_cost_ ? &path_delta_cost_with_mp : nullptr) ==
           DimensionSchedulingStatus::INFEASIBLE) {
         return false;
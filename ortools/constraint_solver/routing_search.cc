@@ -1737,11 +1737,12 @@ bool GlobalCheapestInsertionFilteredHeuristic::UpdateExistingPairEntriesOnChain(
     std::vector<GlobalCheapestInsertionFilteredHeuristic::PairEntries>*
         delivery_to_entries) {
   int64_t insert_after = insert_after_start;
+  std::vector<PairEntry*> to_remove;
   while (insert_after != insert_after_end) {
     DCHECK(!model()->IsEnd(insert_after));
     // Remove entries at 'insert_after' with nodes which have already been
     // inserted and update remaining entries.
-    std::vector<PairEntry*> to_remove;
+    to_remove.clear();
     for (const PairEntries* pair_entries :
          {&pickup_to_entries->at(insert_after),
           &delivery_to_entries->at(insert_after)}) {
@@ -2078,7 +2079,10 @@ bool GlobalCheapestInsertionFilteredHeuristic::UpdateExistingNodeEntriesOnChain(
   int64_t insert_after = insert_after_start;
   while (insert_after != insert_after_end) {
     DCHECK(!model()->IsEnd(insert_after));
-    AddNodeEntriesAfter(nodes, vehicle, insert_after, all_vehicles, queue);
+    if (!AddNodeEntriesAfter(nodes, vehicle, insert_after, all_vehicles,
+                             queue)) {
+      return false;
+    }
     insert_after = Value(insert_after);
   }
   return true;
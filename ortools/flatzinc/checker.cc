@@ -1167,10 +1167,11 @@ bool CheckSymmetricAllDifferent(
   return true;
 }
 
-using CallMap =
-    absl::flat_hash_map<std::string,
-                        std::function<bool(const Constraint& ct,
-                                           std::function<int64_t(Variable*)>)>>;
+// Note that we use plain function pointers taking the evaluator by reference,
+// so that no std::function is copied for each checked constraint.
+using CallMap = absl::flat_hash_map<
+    std::string, bool (*)(const Constraint& ct,
+                          const std::function<int64_t(Variable*)>& evaluator)>;
 
 // Creates a map between flatzinc predicates and CP-SAT builders.
 //
@@ -1323,10 +1324,11 @@ bool CheckSolution(const Model& model,
                    const std::function<int64_t(Variable*)>& evaluator,
                    SolverLogger* logger) {
   bool ok = true;
-  const CallMap call_map = CreateCallMap();
+  // The map never changes, so we only build it once per process.
+  static const CallMap* const call_map = new CallMap(CreateCallMap());
   for (Constraint* ct : model.constraints()) {
     if (!ct->active) continue;
-    const auto& checker = call_map.at(ct->type);
+    const auto& checker = call_map->at(ct->type);
     if (!checker(*ct, evaluator)) {
       SOLVER_LOG(logger, "Failing constraint ", ct->DebugString());
       ok = false;
@@ -137,17 +137,15 @@ struct CpModelProtoWithMapping {
 };
 
 int CpModelProtoWithMapping::LookupConstant(int64_t value) {
-  if (constant_value_to_index.contains(value)) {
-    return constant_value_to_index[value];
-  }
+  const auto [it, inserted] =
+      constant_value_to_index.insert({value, proto.variables_size()});
+  if (!inserted) return it->second;
 
   // Create the constant on the fly.
-  const int index = proto.variables_size();
   IntegerVariableProto* var_proto = proto.add_variables();
   var_proto->add_domain(value);
   var_proto->add_domain(value);
-  constant_value_to_index[value] = index;
-  return index;
+  return it->second;
 }
 
 int CpModelProtoWithMapping::LookupVar(const fz::Argument& argument) {
@@ -187,6 +185,7 @@ std::vector<int> CpModelProtoWithMapping::LookupVars(
   std::vector<int> result;
   if (argument.type == fz::Argument::VOID_ARGUMENT) return result;
   if (argument.type == fz::Argument::INT_LIST) {
+    result.reserve(argument.values.size());
     for (int64_t value : argument.values) {
       result.push_back(LookupConstant(value));
     }
@@ -194,6 +193,7 @@ std::vector<int> CpModelProtoWithMapping::LookupVars(
     result.push_back(LookupConstant(argument.Value()));
   } else {
     CHECK_EQ(argument.type, fz::Argument::VAR_REF_ARRAY);
+    result.reserve(argument.variables.size());
     for (fz::Variable* var : argument.variables) {
       CHECK(var != nullptr);
       result.push_back(fz_var_to_index[var]);
@@ -208,6 +208,7 @@ std::vector<VarOrValue> CpModelProtoWithMapping::LookupVarsOrValues(
   const int no_var = kNoVar;
   if (argument.type == fz::Argument::VOID_ARGUMENT) return result;
   if (argument.type == fz::Argument::INT_LIST) {
+    result.reserve(argument.values.size());
     for (int64_t value : argument.values) {
       result.push_back({no_var, value});
     }
@@ -215,6 +216,7 @@ std::vector<VarOrValue> CpModelProtoWithMapping::LookupVarsOrValues(
     result.push_back({no_var, argument.Value()});
   } else {
     CHECK_EQ(argument.type, fz::Argument::VAR_REF_ARRAY);
+    result.reserve(argument.variables.size());
     for (fz::Variable* var : argument.variables) {
       CHECK(var != nullptr);
       if (var->domain.HasOneValue()) {
@@ -1271,6 +1273,13 @@ void SolveFzWithCpModelProto(const fz::Model& fz_model,
   // The translation is easy, we create one variable per flatzinc variable,
   // plus eventually a bunch of constant variables that will be created
   // lazily.
+  //
+  // On large models, reserving the memory upfront avoids many rehashes and
+  // reallocations. Inactive variables and constraints only cost a bit of
+  // extra capacity.
+  m.fz_var_to_index.reserve(fz_model.variables().size());
+  m.proto.mutable_variables()->Reserve(fz_model.variables().size());
+  m.proto.mutable_constraints()->Reserve(fz_model.constraints().size());
   int num_variables = 0;
   for (fz::Variable* fz_var : fz_model.variables()) {
     if (!fz_var->active) continue;
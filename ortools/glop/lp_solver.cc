@@ -18,6 +18,7 @@
 #include <cstdlib>
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "absl/flags/flag.h"
 #include "absl/log/check.h"
@@ -154,6 +155,8 @@ ProblemStatus LPSolver::SolveWithTimeLimit(const LinearProgram& lp,
   }
   ++num_solves_;
   num_revised_simplex_iterations_ = 0;
+  const bool matrix_is_unchanged =
+      std::exchange(notify_that_matrix_is_unchanged_, false);
   DumpLinearProgramIfRequiredByFlags(lp, num_solves_);
 
   // Display a warning if running in non-opt, unless we're inside a unit test.
@@ -242,7 +245,7 @@ ProblemStatus LPSolver::SolveWithTimeLimit(const LinearProgram& lp,
   // mean that the pre-processors were not all run, and current_linear_program_
   // might not be in a completely safe state.
   if (!time_limit->LimitReached()) {
-    RunRevisedSimplexIfNeeded(&solution, time_limit);
+    RunRevisedSimplexIfNeeded(&solution, time_limit, matrix_is_unchanged);
   }
   if (postsolve_is_needed) preprocessor.DestructiveRecoverSolution(&solution);
   const ProblemStatus status = LoadAndVerifySolution(lp, solution);
@@ -589,7 +592,8 @@ void LPSolver::ResizeSolution(RowIndex num_rows, ColIndex num_cols) {
 }
 
 void LPSolver::RunRevisedSimplexIfNeeded(ProblemSolution* solution,
-                                         TimeLimit* time_limit) {
+                                         TimeLimit* time_limit,
+                                         bool matrix_is_unchanged) {
   // Note that the transpose matrix is no longer needed at this point.
   // This helps reduce the peak memory usage of the solver.
   //
@@ -604,6 +608,10 @@ void LPSolver::RunRevisedSimplexIfNeeded(ProblemSolution* solution,
     revised_simplex_->SetLogger(&logger_);
   }
   revised_simplex_->SetParameters(parameters_);
+  if (matrix_is_unchanged && !parameters_.use_preprocessing() &&
+      !parameters_.use_scaling()) {
+    revised_simplex_->NotifyThatMatrixIsUnchangedForNextSolve();
+  }
   if (revised_simplex_->Solve(current_linear_program_, time_limit).ok()) {
     num_revised_simplex_iterations_ = revised_simplex_->GetNumberOfIterations();
     solution->status = revised_simplex_->GetProblemStatus();
@@ -90,6 +90,16 @@ class LPSolver {
   void SetInitialBasis(const VariableStatusRow& variable_statuses,
                        const ConstraintStatusColumn& constraint_statuses);
 
+  // Advanced usage. Tells the next Solve() that the constraint matrix of the
+  // given LinearProgram is exactly the same as the one of the last Solve(),
+  // only the bounds or the objective changed. This allows to skip the O(nnz)
+  // comparison of both matrices when warm-starting. This only applies to the
+  // next Solve(), and it is ignored if use_preprocessing or use_scaling is
+  // true since the internal matrix might then differ anyway.
+  void NotifyThatMatrixIsUnchangedForNextSolve() {
+    notify_that_matrix_is_unchanged_ = true;
+  }
+
   // This loads a given solution and computes related quantities so that the
   // getters below will refer to it.
   //
@@ -193,7 +203,8 @@ class LPSolver {
   // Runs the revised simplex algorithm if needed (i.e. if the program was not
   // already solved by the preprocessors).
   void RunRevisedSimplexIfNeeded(ProblemSolution* solution,
-                                 TimeLimit* time_limit);
+                                 TimeLimit* time_limit,
+                                 bool matrix_is_unchanged);
 
   // Checks that the returned solution values and statuses are consistent.
   // Returns true if this is the case. See the code for the exact check
@@ -278,6 +289,9 @@ class LPSolver {
   // The number of revised simplex iterations used by the last Solve().
   int num_revised_simplex_iterations_;
 
+  // See NotifyThatMatrixIsUnchangedForNextSolve().
+  bool notify_that_matrix_is_unchanged_ = false;
+
   // The current ProblemSolution.
   // TODO(user): use a ProblemSolution directly? Note, that primal_ray_,
   // constraints_dual_ray_ and variable_bounds_dual_ray_ are not currently in
@@ -0,0 +1,127 @@
+// Copyright 2010-2022 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Micro-benchmarks of the LU factorization used by the revised simplex.
+//
+// The matrices are synthetic: each column has a dominant diagonal entry and a
+// few random off-diagonal entries close to the diagonal. This is roughly the
+// density of the basis of a sparse LP, guarantees that the matrix is not
+// singular, and bounds the fill-in so that the larger sizes stay tractable.
+
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "ortools/base/logging.h"
+#include "ortools/glop/lu_factorization.h"
+#include "ortools/glop/status.h"
+#include "ortools/lp_data/lp_types.h"
+#include "ortools/lp_data/sparse.h"
+
+namespace operations_research {
+namespace glop {
+namespace {
+
+constexpr int kOffDiagonalEntriesPerColumn = 3;
+constexpr int kBandWidth = 20;
+
+void FillRandomBasis(int size, CompactSparseMatrix* matrix,
+                     RowToColMapping* basis) {
+  std::mt19937 random(12345);
+  std::uniform_real_distribution<double> value(-1.0, 1.0);
+  const RowIndex num_rows(size);
+  matrix->Reset(num_rows);
+  DenseColumn column(num_rows, 0.0);
+  std::vector<RowIndex> non_zeros;
+  for (int col = 0; col < size; ++col) {
+    column[RowIndex(col)] = 10.0;
+    non_zeros.push_back(RowIndex(col));
+    for (int k = 0; k < kOffDiagonalEntriesPerColumn; ++k) {
+      const int offset = static_cast<int>(random() % (2 * kBandWidth + 1));
+      const RowIndex row(col + offset - kBandWidth);
+      if (row < 0 || row >= num_rows || row == RowIndex(col)) continue;
+      column[row] = value(random);
+      non_zeros.push_back(row);
+    }
+    matrix->AddAndClearColumnWithNonZeros(&column, &non_zeros);
+    non_zeros.clear();
+  }
+  basis->resize(num_rows);
+  for (RowIndex row(0); row < num_rows; ++row) {
+    (*basis)[row] = RowToColIndex(row);
+  }
+}
+
+void BM_LuFactorization(benchmark::State& state) {
+  const int size = state.range(0);
+  CompactSparseMatrix matrix;
+  RowToColMapping basis;
+  FillRandomBasis(size, &matrix, &basis);
+  const CompactSparseMatrixView view(&matrix, &basis);
+  LuFactorization lu;
+  for (auto _ : state) {
+    CHECK(lu.ComputeFactorization(view).ok());
+  }
+  state.SetItemsProcessed(state.iterations() * matrix.num_entries().value());
+}
+BENCHMARK(BM_LuFactorization)->Arg(1000)->Arg(10000)->Arg(100000);
+
+void BM_LuRightSolve(benchmark::State& state) {
+  const int size = state.range(0);
+  CompactSparseMatrix matrix;
+  RowToColMapping basis;
+  FillRandomBasis(size, &matrix, &basis);
+  const CompactSparseMatrixView view(&matrix, &basis);
+  LuFactorization lu;
+  CHECK(lu.ComputeFactorization(view).ok());
+
+  std::mt19937 random(12345);
+  std::uniform_real_distribution<double> value(-1.0, 1.0);
+  DenseColumn rhs(RowIndex(size), 0.0);
+  for (RowIndex row(0); row < rhs.size(); ++row) rhs[row] = value(random);
+  DenseColumn x;
+  for (auto _ : state) {
+    x = rhs;
+    lu.RightSolve(&x);
+    benchmark::DoNotOptimize(x.data());
+  }
+  state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_LuRightSolve)->Arg(1000)->Arg(10000)->Arg(100000);
+
+void BM_LuLeftSolve(benchmark::State& state) {
+  const int size = state.range(0);
+  CompactSparseMatrix matrix;
+  RowToColMapping basis;
+  FillRandomBasis(size, &matrix, &basis);
+  const CompactSparseMatrixView view(&matrix, &basis);
+  LuFactorization lu;
+  CHECK(lu.ComputeFactorization(view).ok());
+
+  std::mt19937 random(12345);
+  std::uniform_real_distribution<double> value(-1.0, 1.0);
+  DenseRow rhs(ColIndex(size), 0.0);
+  for (ColIndex col(0); col < rhs.size(); ++col) rhs[col] = value(random);
+  DenseRow y;
+  for (auto _ : state) {
+    y = rhs;
+    lu.LeftSolve(&y);
+    benchmark::DoNotOptimize(y.data());
+  }
+  state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_LuLeftSolve)->Arg(1000)->Arg(10000)->Arg(100000);
+
+}  // namespace
+}  // namespace glop
+}  // namespace operations_research
@@ -244,15 +244,25 @@ void Markowitz::ExtractResidualSingletonColumns(
   SCOPED_TIME_STAT(&stats_);
   const ColIndex num_cols = basis_matrix.num_cols();
   RowIndex row = kInvalidRow;
-  for (ColIndex col(0); col < num_cols; ++col) {
-    if ((*col_perm)[col] != kInvalidCol) continue;
-    const ColumnView& column = basis_matrix.column(col);
-    if (!IsResidualSingletonColumn(column, *row_perm, &row)) continue;
-    (*col_perm)[col] = ColIndex(*index);
-    (*row_perm)[row] = RowIndex(*index);
-    lower_.AddDiagonalOnlyColumn(1.0);
-    upper_.AddTriangularColumn(column, row);
-    ++(*index);
+
+  // Extracting a column can turn a column we already scanned into a residual
+  // singleton, so we do a few more passes as long as they make progress. Each
+  // pass is linear in the number of entries, which is a lot cheaper than
+  // handling these columns in the general Markowitz loop.
+  const int kMaxNumPasses = 4;
+  for (int pass = 0; pass < kMaxNumPasses; ++pass) {
+    const int index_before_pass = *index;
+    for (ColIndex col(0); col < num_cols; ++col) {
+      if ((*col_perm)[col] != kInvalidCol) continue;
+      const ColumnView& column = basis_matrix.column(col);
+      if (!IsResidualSingletonColumn(column, *row_perm, &row)) continue;
+      (*col_perm)[col] = ColIndex(*index);
+      (*row_perm)[row] = RowIndex(*index);
+      lower_.AddDiagonalOnlyColumn(1.0);
+      upper_.AddTriangularColumn(column, row);
+      ++(*index);
+    }
+    if (*index == index_before_pass) break;
   }
   stats_.basis_residual_singleton_column_ratio.Add(
       static_cast<double>(*index) / basis_matrix.num_rows().value());
@@ -346,7 +346,8 @@ class Markowitz {
   // Fast track for columns that form a triangular matrix. This does not find
   // all of them, but because the column are ordered in the same way they were
   // ordered at the end of the previous factorization, this is likely to find
-  // quite a few.
+  // quite a few. A small number of extra passes catch the columns that only
+  // became residual singletons after a later column was extracted.
   //
   // The main gain here is that it avoids taking these columns into account in
   // InitializeResidualMatrix() and later in RemoveRowFromResidualMatrix().
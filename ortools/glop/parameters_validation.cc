@@ -87,6 +87,9 @@ std::string ValidateParameters(const GlopParameters& params) {
   if (params.markowitz_zlatev_parameter() < 1) {
     return "markowitz_zlatev_parameter must be >= 1";
   }
+  if (params.primal_pricing_num_sections() < 1) {
+    return "primal_pricing_num_sections must be >= 1";
+  }
 
   return "";
 }
@@ -14,6 +14,7 @@
 #include "ortools/glop/preprocessor.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstdint>
 #include <cstdlib>
@@ -90,17 +91,34 @@ bool MainLpPreprocessor::Run(LinearProgram* lp) {
 
     // We run it a few times because running one preprocessor may allow another
     // one to remove more stuff.
+    //
+    // As noted below, the preprocessors of this loop change the problem if and
+    // only if they push something on the stack. So if the last run of one of
+    // them did nothing and the stack size did not change since, it will not do
+    // anything either and we can skip it. This avoids a full rescan of the
+    // matrix by most of them during the last passes.
     const int kMaxNumPasses = 20;
+    const int kNumLoopPreprocessors = 8;
+    std::array<int, kNumLoopPreprocessors> stack_size_after_no_op;
+    stack_size_after_no_op.fill(-1);
+#define RUN_LOOP_PREPROCESSOR(index, name)                              \
+  if (preprocessors_.size() != stack_size_after_no_op[index]) {         \
+    const int stack_size_before = preprocessors_.size();                \
+    RUN_PREPROCESSOR(name);                                             \
+    stack_size_after_no_op[index] =                                     \
+        preprocessors_.size() == stack_size_before ? stack_size_before  \
+                                                   : -1;                \
+  }
     for (int i = 0; i < kMaxNumPasses; ++i) {
       const int old_stack_size = preprocessors_.size();
-      RUN_PREPROCESSOR(FixedVariablePreprocessor);
-      RUN_PREPROCESSOR(SingletonPreprocessor);
-      RUN_PREPROCESSOR(ForcingAndImpliedFreeConstraintPreprocessor);
-      RUN_PREPROCESSOR(FreeConstraintPreprocessor);
-      RUN_PREPROCESSOR(ImpliedFreePreprocessor);
-      RUN_PREPROCESSOR(UnconstrainedVariablePreprocessor);
-      RUN_PREPROCESSOR(DoubletonFreeColumnPreprocessor);
-      RUN_PREPROCESSOR(DoubletonEqualityRowPreprocessor);
+      RUN_LOOP_PREPROCESSOR(0, FixedVariablePreprocessor);
+      RUN_LOOP_PREPROCESSOR(1, SingletonPreprocessor);
+      RUN_LOOP_PREPROCESSOR(2, ForcingAndImpliedFreeConstraintPreprocessor);
+      RUN_LOOP_PREPROCESSOR(3, FreeConstraintPreprocessor);
+      RUN_LOOP_PREPROCESSOR(4, ImpliedFreePreprocessor);
+      RUN_LOOP_PREPROCESSOR(5, UnconstrainedVariablePreprocessor);
+      RUN_LOOP_PREPROCESSOR(6, DoubletonFreeColumnPreprocessor);
+      RUN_LOOP_PREPROCESSOR(7, DoubletonEqualityRowPreprocessor);
 
       // Abort early if none of the preprocessors did something. Technically
       // this is true if none of the preprocessors above needs postsolving,
@@ -111,6 +129,7 @@ bool MainLpPreprocessor::Run(LinearProgram* lp) {
         break;
       }
     }
+#undef RUN_LOOP_PREPROCESSOR
     RUN_PREPROCESSOR(EmptyColumnPreprocessor);
     RUN_PREPROCESSOR(EmptyConstraintPreprocessor);
 
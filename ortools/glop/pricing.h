@@ -14,6 +14,7 @@
 #ifndef OR_TOOLS_GLOP_PRICING_H_
 #define OR_TOOLS_GLOP_PRICING_H_
 
+#include <cstdint>
 #include <random>
 #include <string>
 
@@ -71,6 +72,17 @@ class DynamicMaximum {
   // uniformly if there is a large number of ties).
   Index GetMaximum();
 
+  // Same as GetMaximum(), except that when the top-k candidates are exhausted,
+  // this only scans one of num_sections sections of [0, n), in a round-robin
+  // fashion, and returns the best candidate found there. This is the classical
+  // "partial pricing" of the simplex. The empty sections are skipped, so this
+  // still returns Index(-1) only if there is no candidate at all.
+  //
+  // Scanning a section only makes sense if it contains more than the top-k
+  // candidates. When the last scan indicates that this is not the case, which
+  // is usually what happens near optimality, this falls back to GetMaximum().
+  Index GetPartialMaximum(int num_sections);
+
   // Removes the given index from the set of candidates.
   void Remove(Index position);
 
@@ -96,6 +108,23 @@ class DynamicMaximum {
   std::string StatString() const { return stats_.StatString(); }
 
  private:
+  // Number of top elements we try to maintain. We use a compile time size of
+  // the form 2^n - 1 to have a full binary heap.
+  //
+  // TODO(user): Adapt the size depending on the problem size? Note sure it is
+  // worth it. To experiment more.
+  static constexpr int kNumTops = 31;
+  static_assert(((kNumTops + 1) & kNumTops) == 0,
+                "kNumTops + 1 should be a power of 2.");
+
+  // Returns the maximum from tops_ or Index(-1) if none of its elements are
+  // still valid.
+  Index GetMaximumFromTops();
+
+  // Scans the candidates in the buckets [begin, end) of is_candidate_ to
+  // recompute tops_ and returns the maximum. Also counts the candidates.
+  Index ScanBuckets(int begin, int end, int* num_candidates);
+
   // Adds an elements to the set of top elements.
   void UpdateTopK(Index position, Fractional value);
 
@@ -141,6 +170,16 @@ class DynamicMaximum {
   Fractional threshold_;
   std::vector<HeapElement> tops_;
 
+  // When true, tops_ was computed by GetPartialMaximum() from one section only,
+  // so the invariant above only holds for that section and GetMaximum() cannot
+  // use it.
+  bool tops_are_partial_ = false;
+
+  // For GetPartialMaximum(): the next section to scan, and the number of
+  // candidates estimated by the last scan.
+  int next_section_ = 0;
+  int64_t num_candidates_estimate_ = 0;
+
   // Statistics about the class.
   struct QueryStats : public StatsGroup {
     QueryStats()
@@ -158,9 +197,11 @@ class DynamicMaximum {
 template <typename Index>
 inline void DynamicMaximum<Index>::ClearAndResize(Index n) {
   tops_.clear();
+  tops_are_partial_ = false;
   threshold_ = -kInfinity;
   values_.resize(n);
   is_candidate_.ClearAndResize(n);
+  num_candidates_estimate_ = n.value();
 }
 
 template <typename Index>
@@ -204,69 +245,131 @@ inline Index DynamicMaximum<Index>::RandomizeIfManyChoices(Index best) {
 }
 
 template <typename Index>
-inline Index DynamicMaximum<Index>::GetMaximum() {
-  SCOPED_TIME_STAT(&stats_);
+inline Index DynamicMaximum<Index>::GetMaximumFromTops() {
   Fractional best_value = -kInfinity;
   Index best_position(-1);
   equivalent_choices_.clear();
 
-  // Optimized version if the maximum is in tops_ already.
-  //
   // We do two things here:
   // 1/ Filter tops_ to only contain valid entries. This is because we never
   //    remove element, so the value of one of the element in tops might have
   //    decreased now. Note that we leave threshold_ untouched, so it
   //    can actually be lower than the minimum of the element in tops.
   // 2/ Get the maximum of the valid elements.
-  if (!tops_.empty()) {
-    int new_size = 0;
-    for (const HeapElement e : tops_) {
-      // The two possible sources of "invalidity".
-      if (!is_candidate_[e.index]) continue;
-      if (values_[e.index] != e.value) continue;
-
-      tops_[new_size++] = e;
-      if (e.value >= best_value) {
-        if (e.value == best_value) {
-          equivalent_choices_.push_back(e.index);
+  int new_size = 0;
+  for (const HeapElement e : tops_) {
+    // The two possible sources of "invalidity".
+    if (!is_candidate_[e.index]) continue;
+    if (values_[e.index] != e.value) continue;
+
+    tops_[new_size++] = e;
+    if (e.value >= best_value) {
+      if (e.value == best_value) {
+        equivalent_choices_.push_back(e.index);
+        continue;
+      }
+      equivalent_choices_.clear();
+      best_value = e.value;
+      best_position = e.index;
+    }
+  }
+  tops_.resize(new_size);
+  if (new_size == 0) return Index(-1);
+  stats_.heap_size_on_hit.Add(new_size);
+  return RandomizeIfManyChoices(best_position);
+}
+
+template <typename Index>
+inline Index DynamicMaximum<Index>::ScanBuckets(int begin, int end,
+                                                int* num_candidates) {
+  Fractional best_value = -kInfinity;
+  Index best_position(-1);
+  equivalent_choices_.clear();
+  threshold_ = -kInfinity;
+  tops_.clear();
+
+  *num_candidates = 0;
+  const auto values = values_.const_view();
+  const uint64_t* const words = is_candidate_.const_view().data();
+  for (int bucket = begin; bucket < end; ++bucket) {
+    for (uint64_t word = words[bucket]; word != 0; word &= word - 1) {
+      ++*num_candidates;
+      const Index position(BitShift64(bucket) |
+                           LeastSignificantBitPosition64(word));
+      const Fractional value = values[position];
+
+      // TODO(user): Add a mode when we do not maintain the TopK for small
+      // sizes (like n < 1000) ? The gain might not be worth the extra code
+      // though.
+      if (value < threshold_) continue;
+      UpdateTopK(position, value);
+
+      if (value >= best_value) {
+        if (value == best_value) {
+          equivalent_choices_.push_back(position);
           continue;
         }
         equivalent_choices_.clear();
-        best_value = e.value;
-        best_position = e.index;
+        best_value = value;
+        best_position = position;
       }
     }
-    tops_.resize(new_size);
-    if (new_size != 0) {
-      stats_.heap_size_on_hit.Add(new_size);
-      return RandomizeIfManyChoices(best_position);
-    }
+  }
+
+  return RandomizeIfManyChoices(best_position);
+}
+
+template <typename Index>
+inline Index DynamicMaximum<Index>::GetMaximum() {
+  SCOPED_TIME_STAT(&stats_);
+
+  // Optimized version if the maximum is in tops_ already.
+  if (!tops_.empty() && !tops_are_partial_) {
+    const Index best = GetMaximumFromTops();
+    if (best != Index(-1)) return best;
   }
 
   // We need to iterate over all the candidates.
-  threshold_ = -kInfinity;
-  DCHECK(tops_.empty());
-  const auto values = values_.const_view();
-  for (const Index position : is_candidate_) {
-    const Fractional value = values[position];
+  int num_candidates;
+  tops_are_partial_ = false;
+  const Index best =
+      ScanBuckets(0, BitLength64(values_.size().value()), &num_candidates);
+  num_candidates_estimate_ = num_candidates;
+  return best;
+}
 
-    // TODO(user): Add a mode when we do not maintain the TopK for small sizes
-    // (like n < 1000) ? The gain might not be worth the extra code though.
-    if (value < threshold_) continue;
-    UpdateTopK(position, value);
+template <typename Index>
+inline Index DynamicMaximum<Index>::GetPartialMaximum(int num_sections) {
+  if (num_sections <= 1 || num_candidates_estimate_ < kNumTops * num_sections) {
+    return GetMaximum();
+  }
 
-    if (value >= best_value) {
-      if (value == best_value) {
-        equivalent_choices_.push_back(position);
-        continue;
-      }
-      equivalent_choices_.clear();
-      best_value = value;
-      best_position = position;
-    }
+  SCOPED_TIME_STAT(&stats_);
+  if (!tops_.empty()) {
+    const Index best = GetMaximumFromTops();
+    if (best != Index(-1)) return best;
   }
 
-  return RandomizeIfManyChoices(best_position);
+  // The sections are made of whole buckets of is_candidate_.
+  const int num_buckets = BitLength64(values_.size().value());
+  for (int i = 0; i < num_sections; ++i) {
+    const int section = next_section_;
+    next_section_ = (next_section_ + 1) % num_sections;
+    const int begin =
+        static_cast<int64_t>(num_buckets) * section / num_sections;
+    const int end =
+        static_cast<int64_t>(num_buckets) * (section + 1) / num_sections;
+    int num_candidates;
+    const Index best = ScanBuckets(begin, end, &num_candidates);
+    if (best == Index(-1)) continue;
+    tops_are_partial_ = true;
+    num_candidates_estimate_ =
+        static_cast<int64_t>(num_candidates) * num_sections;
+    return best;
+  }
+  tops_are_partial_ = false;
+  num_candidates_estimate_ = 0;
+  return Index(-1);
 }
 
 template <typename Index>
@@ -275,12 +378,7 @@ inline void DynamicMaximum<Index>::UpdateTopK(Index position,
   // Note that this should only be called when an update is required.
   DCHECK_GE(value, threshold_);
 
-  // We use a compile time size of the form 2^n - 1 to have a full binary heap.
-  //
-  // TODO(user): Adapt the size depending on the problem size? Note sure it is
-  // worth it. To experiment more.
-  constexpr int k = 31;
-  static_assert(((k + 1) & k) == 0, "k + 1 should be a power of 2.");
+  constexpr int k = kNumTops;
 
   // Simply grow the vector until we hit a size of k.
   if (tops_.size() < k) {
@@ -564,7 +564,7 @@ ColIndex PrimalPrices::GetBestEnteringColumn() {
         variables_info_.GetIsRelevantBitRow());
     recompute_ = false;
   }
-  return prices_.GetMaximum();
+  return prices_.GetPartialMaximum(num_pricing_sections_);
 }
 
 // A variable is an entering candidate if it can move in a direction that
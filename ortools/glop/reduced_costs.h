@@ -302,8 +302,14 @@ class PrimalPrices {
   PrimalPrices(absl::BitGenRef random, const VariablesInfo& variables_info,
                PrimalEdgeNorms* primal_edge_norms, ReducedCosts* reduced_costs);
 
+  // Sets the pricing parameters.
+  void SetParameters(const GlopParameters& parameters) {
+    num_pricing_sections_ = parameters.primal_pricing_num_sections();
+  }
+
   // Returns the best candidate out of the dual infeasible positions to enter
-  // the basis during a primal simplex iterations.
+  // the basis during a primal simplex iterations. With partial pricing, this is
+  // only the best candidate of a section of the columns.
   ColIndex GetBestEnteringColumn();
 
   // Similar to the other UpdateBeforeBasisPivot() functions.
@@ -332,6 +338,7 @@ class PrimalPrices {
   void UpdateEnteringCandidates(const ColumnsToUpdate& cols);
 
   bool recompute_ = true;
+  int num_pricing_sections_ = 1;
   DynamicMaximum<ColIndex> prices_;
 
   const VariablesInfo& variables_info_;
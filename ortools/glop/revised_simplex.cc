@@ -983,6 +983,7 @@ bool RevisedSimplex::InitializeMatrixAndTestIfUnchanged(
   first_slack_col_ = lp_first_slack;
 
   // Initialize the new dimensions.
+  const RowIndex old_num_rows = num_rows_;
   num_rows_ = lp.num_constraints();
   num_cols_ = lp_first_slack + RowToColIndex(lp.num_constraints());
 
@@ -995,7 +996,14 @@ bool RevisedSimplex::InitializeMatrixAndTestIfUnchanged(
     compact_matrix_.PopulateFromSparseMatrixAndAddSlacks(lp.GetSparseMatrix());
   }
   if (parameters_.use_transposed_matrix()) {
-    transposed_matrix_.PopulateFromTranspose(compact_matrix_);
+    // When we only add rows, as in a cut loop, the transpose of the old rows
+    // is unchanged and we just append the new ones.
+    if (*only_change_is_new_rows && !transposed_matrix_.IsEmpty() &&
+        transposed_matrix_.num_cols() == RowToColIndex(old_num_rows)) {
+      transposed_matrix_.AddTransposeOfNewRows(compact_matrix_, old_num_rows);
+    } else {
+      transposed_matrix_.PopulateFromTranspose(compact_matrix_);
+    }
   } else {
     transposed_matrix_.Reset(RowIndex(0));
   }
@@ -3607,6 +3615,7 @@ void RevisedSimplex::PropagateParameters() {
   dual_edge_norms_.SetParameters(parameters_);
   primal_edge_norms_.SetParameters(parameters_);
   update_row_.SetParameters(parameters_);
+  primal_prices_.SetParameters(parameters_);
 }
 
 void RevisedSimplex::DisplayIterationInfo(bool primal,
@@ -13,13 +13,16 @@
 
 #include "ortools/graph/christofides.h"
 
+#include <cmath>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <limits>
+#include <random>
 #include <string>
 #include <vector>
 
+#include "absl/random/distributions.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/string_view.h"
 #include "benchmark/benchmark.h"
@@ -288,4 +291,30 @@ void BM_ChristofidesPathSolver(benchmark::State& state) {
 BENCHMARK_TEMPLATE(BM_ChristofidesPathSolver, true)->Range(2, 1 << 5);
 BENCHMARK_TEMPLATE(BM_ChristofidesPathSolver, false)->Range(2, 1 << 4);
 
+// Benchmark for the minimum weight perfect matching alone, on the complete
+// graph of 'num_nodes' random points in the plane. This is the matching phase
+// of the Christofides algorithm, and it dominates its running time.
+void BM_MinCostPerfectMatchingOnCompleteGraph(benchmark::State& state) {
+  const int num_nodes = state.range(0);
+  std::mt19937 random(12345);
+  std::vector<int> x(num_nodes);
+  std::vector<int> y(num_nodes);
+  for (int i = 0; i < num_nodes; ++i) {
+    x[i] = absl::Uniform(random, 0, 10000);
+    y[i] = absl::Uniform(random, 0, 10000);
+  }
+  for (auto _ : state) {
+    MinCostPerfectMatching matching(num_nodes);
+    for (int i = 0; i < num_nodes; ++i) {
+      for (int j = i + 1; j < num_nodes; ++j) {
+        matching.AddEdgeWithCost(
+            i, j, std::lround(std::hypot(x[i] - x[j], y[i] - y[j])));
+      }
+    }
+    EXPECT_EQ(MinCostPerfectMatching::OPTIMAL, matching.Solve());
+  }
+}
+
+BENCHMARK(BM_MinCostPerfectMatchingOnCompleteGraph)->Range(16, 1 << 10);
+
 }  // namespace operations_research
@@ -14,12 +14,15 @@
 #include "ortools/graph/cliques.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <numeric>
 #include <utility>
 #include <vector>
 
 #include "absl/container/flat_hash_set.h"
+#include "absl/numeric/bits.h"
 #include "ortools/base/hash.h"
 
 namespace operations_research {
@@ -261,4 +264,186 @@ void CoverArcsByCliques(std::function<bool(int, int)> graph, int node_count,
          &actual, &stop);
 }
 
+namespace {
+
+// Bit-parallel branch and bound for FindMaximumClique(). The nodes are renamed
+// by decreasing degree, so that the greedy coloring bound is tighter, and all
+// the sets of nodes are bitsets over these new indices.
+class MaximumCliqueFinder {
+ public:
+  MaximumCliqueFinder(const std::function<bool(int, int)>& graph,
+                      int num_nodes, TimeLimit* time_limit)
+      : num_nodes_(num_nodes),
+        num_words_((num_nodes + kBitsPerWord - 1) / kBitsPerWord),
+        time_limit_(time_limit),
+        adjacency_(static_cast<size_t>(num_nodes) * num_words_, 0) {
+    std::vector<std::vector<int>> neighbors(num_nodes);
+    for (int i = 0; i < num_nodes; ++i) {
+      for (int j = i + 1; j < num_nodes; ++j) {
+        if (graph(i, j)) {
+          neighbors[i].push_back(j);
+          neighbors[j].push_back(i);
+        }
+      }
+    }
+    original_node_.resize(num_nodes);
+    std::iota(original_node_.begin(), original_node_.end(), 0);
+    std::stable_sort(original_node_.begin(), original_node_.end(),
+                     [&neighbors](int a, int b) {
+                       return neighbors[a].size() > neighbors[b].size();
+                     });
+    std::vector<int> new_index(num_nodes);
+    for (int i = 0; i < num_nodes; ++i) new_index[original_node_[i]] = i;
+    for (int node = 0; node < num_nodes; ++node) {
+      for (const int neighbor : neighbors[node]) {
+        SetBit(new_index[neighbor], Neighbors(new_index[node]));
+      }
+    }
+  }
+
+  BronKerboschAlgorithmStatus Run(std::vector<int>* clique) {
+    interrupted_ = false;
+    best_clique_.clear();
+    current_clique_.clear();
+    std::vector<uint64_t> candidates(num_words_, 0);
+    for (int i = 0; i < num_nodes_; ++i) SetBit(i, candidates.data());
+    if (num_nodes_ > 0) Expand(std::move(candidates));
+
+    clique->clear();
+    for (const int node : best_clique_) {
+      clique->push_back(original_node_[node]);
+    }
+    std::sort(clique->begin(), clique->end());
+    return interrupted_ ? BronKerboschAlgorithmStatus::INTERRUPTED
+                        : BronKerboschAlgorithmStatus::COMPLETED;
+  }
+
+ private:
+  static constexpr int kBitsPerWord = 64;
+  // Same order of magnitude as the one used by BronKerboschAlgorithm per
+  // candidate, but per 64-bit word operation.
+  static constexpr double kDeterministicTimePerWordOperation = 1e-8;
+
+  uint64_t* Neighbors(int node) {
+    return adjacency_.data() + static_cast<size_t>(node) * num_words_;
+  }
+  static void SetBit(int i, uint64_t* bitset) {
+    bitset[i / kBitsPerWord] |= uint64_t{1} << (i % kBitsPerWord);
+  }
+  static void ClearBit(int i, uint64_t* bitset) {
+    bitset[i / kBitsPerWord] &= ~(uint64_t{1} << (i % kBitsPerWord));
+  }
+
+  // Returns the first set bit of 'bitset' at or after word 'start_word', and
+  // updates 'start_word' to its word, or returns -1 if there is none.
+  int FirstSetBit(const std::vector<uint64_t>& bitset, int* start_word) const {
+    for (int w = *start_word; w < num_words_; ++w) {
+      if (bitset[w] != 0) {
+        *start_word = w;
+        return w * kBitsPerWord + absl::countr_zero(bitset[w]);
+      }
+    }
+    *start_word = num_words_;
+    return -1;
+  }
+
+  // Colors the candidates greedily, in increasing node order: each color class
+  // is an independent set, so a clique contains at most one node per color.
+  // Fills 'nodes' and 'colors' with the candidates whose color may lead to a
+  // better clique, sorted by increasing color.
+  void ColorCandidates(const std::vector<uint64_t>& candidates,
+                       std::vector<int>* nodes, std::vector<int>* colors) {
+    nodes->clear();
+    colors->clear();
+    const int min_useful_color =
+        static_cast<int>(best_clique_.size() - current_clique_.size()) + 1;
+    std::vector<uint64_t> uncolored = candidates;
+    std::vector<uint64_t> available(num_words_);
+    int uncolored_start_word = 0;
+    for (int color = 1;; ++color) {
+      if (FirstSetBit(uncolored, &uncolored_start_word) == -1) break;
+      std::copy(uncolored.begin() + uncolored_start_word, uncolored.end(),
+                available.begin() + uncolored_start_word);
+      int start_word = uncolored_start_word;
+      while (true) {
+        const int node = FirstSetBit(available, &start_word);
+        if (node == -1) break;
+        ClearBit(node, uncolored.data());
+        ClearBit(node, available.data());
+        // Remove the neighbors of 'node' from the nodes that can get 'color'.
+        const uint64_t* const neighbors = Neighbors(node);
+        for (int w = start_word; w < num_words_; ++w) {
+          available[w] &= ~neighbors[w];
+        }
+        if (color >= min_useful_color) {
+          nodes->push_back(node);
+          colors->push_back(color);
+        }
+      }
+      time_limit_work_ += num_words_ - uncolored_start_word;
+    }
+  }
+
+  void Expand(std::vector<uint64_t> candidates) {
+    if (time_limit_ != nullptr) {
+      time_limit_->AdvanceDeterministicTime(
+          time_limit_work_ * kDeterministicTimePerWordOperation,
+          "FindMaximumClique");
+      time_limit_work_ = 0;
+      if (time_limit_->LimitReached()) {
+        interrupted_ = true;
+        return;
+      }
+    }
+    std::vector<int> nodes;
+    std::vector<int> colors;
+    ColorCandidates(candidates, &nodes, &colors);
+    std::vector<uint64_t> new_candidates(num_words_);
+    for (int i = nodes.size() - 1; i >= 0; --i) {
+      if (current_clique_.size() + colors[i] <= best_clique_.size()) return;
+      const int node = nodes[i];
+      current_clique_.push_back(node);
+      const uint64_t* const neighbors = Neighbors(node);
+      bool is_empty = true;
+      for (int w = 0; w < num_words_; ++w) {
+        new_candidates[w] = candidates[w] & neighbors[w];
+        is_empty &= new_candidates[w] == 0;
+      }
+      time_limit_work_ += num_words_;
+      if (is_empty) {
+        if (current_clique_.size() > best_clique_.size()) {
+          best_clique_ = current_clique_;
+        }
+      } else {
+        Expand(new_candidates);
+      }
+      current_clique_.pop_back();
+      if (interrupted_) return;
+      ClearBit(node, candidates.data());
+    }
+  }
+
+  const int num_nodes_;
+  const int num_words_;
+  TimeLimit* const time_limit_;
+  // The adjacency matrix, one bitset of num_words_ words per node.
+  std::vector<uint64_t> adjacency_;
+  // original_node_[i] is the node of the input graph with internal index i.
+  std::vector<int> original_node_;
+  std::vector<int> current_clique_;
+  std::vector<int> best_clique_;
+  int64_t time_limit_work_ = 0;
+  bool interrupted_ = false;
+};
+
+}  // namespace
+
+BronKerboschAlgorithmStatus FindMaximumClique(
+    const std::function<bool(int, int)>& graph, int num_nodes,
+    TimeLimit* time_limit, std::vector<int>* clique) {
+  CHECK(clique != nullptr);
+  MaximumCliqueFinder finder(graph, num_nodes, time_limit);
+  return finder.Run(clique);
+}
+
 }  // namespace operations_research
@@ -77,6 +77,25 @@ enum class BronKerboschAlgorithmStatus {
   INTERRUPTED
 };
 
+// Finds a maximum clique of the graph described by the graph callback, where
+// graph(i, j) indicates if there is an arc between i and j, i != j. The clique
+// is returned in 'clique', with its nodes in increasing order.
+//
+// This is a bit-parallel branch and bound (BBMC, see San Segundo, Rodriguez-
+// Losada and Jimenez, "An exact bit-parallel algorithm for the maximum clique
+// problem", Computers & Operations Research 38 (2011) 571-581): the adjacency
+// matrix is stored as bitsets, and the search is pruned with the bound given
+// by a greedy coloring of the candidates. It uses num_nodes^2 / 8 bytes of
+// memory, and is much faster than enumerating all the maximal cliques with
+// the Bron-Kerbosch algorithm when only the largest one is needed.
+//
+// Returns COMPLETED if the clique is proven to be maximum, and INTERRUPTED if
+// the time limit (which can be nullptr) was reached, in which case 'clique' is
+// the largest clique found so far.
+BronKerboschAlgorithmStatus FindMaximumClique(
+    const std::function<bool(int, int)>& graph, int num_nodes,
+    TimeLimit* time_limit, std::vector<int>* clique);
+
 // Implements the Bron-Kerbosch algorithm for finding maximal cliques.
 // The graph is represented as a callback that gets two nodes as its arguments
 // and it returns true if and only if there is an arc between the two nodes. The
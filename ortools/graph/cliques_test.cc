@@ -528,6 +528,80 @@ TEST(BronKerboschAlgorithmTest, DeterministicTimeLimit) {
   EXPECT_TRUE(time_limit->LimitReached());
 }
 
+bool IsClique(const std::function<bool(int, int)>& graph,
+              const std::vector<int>& clique) {
+  for (int i = 0; i < clique.size(); ++i) {
+    for (int j = i + 1; j < clique.size(); ++j) {
+      if (!graph(clique[i], clique[j])) return false;
+    }
+  }
+  return true;
+}
+
+TEST(FindMaximumCliqueTest, SmallGraphs) {
+  std::vector<int> clique;
+  EXPECT_EQ(BronKerboschAlgorithmStatus::COMPLETED,
+            FindMaximumClique(FullGraph, 10, nullptr, &clique));
+  EXPECT_EQ(clique, std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+  EXPECT_EQ(BronKerboschAlgorithmStatus::COMPLETED,
+            FindMaximumClique(EmptyGraph, 10, nullptr, &clique));
+  EXPECT_EQ(clique.size(), 1);
+  EXPECT_EQ(BronKerboschAlgorithmStatus::COMPLETED,
+            FindMaximumClique(EmptyGraph, 0, nullptr, &clique));
+  EXPECT_TRUE(clique.empty());
+  const auto graph = [](int index1, int index2) {
+    return FullKPartiteGraph(7, index1, index2);
+  };
+  EXPECT_EQ(BronKerboschAlgorithmStatus::COMPLETED,
+            FindMaximumClique(graph, 7 * 5, nullptr, &clique));
+  EXPECT_EQ(clique.size(), 7);
+  EXPECT_TRUE(IsClique(graph, clique));
+}
+
+TEST(FindMaximumCliqueTest, RandomGraphsMatchBronKerbosch) {
+  constexpr int kNumNodes = 60;
+  for (const double arc_probability : {0.1, 0.5, 0.9}) {
+    for (int seed = 0; seed < 5; ++seed) {
+      const absl::flat_hash_set<std::pair<int, int>> adjacency_matrix =
+          MakeRandomGraphAdjacencyMatrix(kNumNodes, arc_probability, seed);
+      const auto graph = [&adjacency_matrix](int index1, int index2) {
+        return BitmapGraph(adjacency_matrix, index1, index2);
+      };
+      int max_clique_size = 0;
+      BronKerboschAlgorithm<int> bron_kerbosch(
+          graph, kNumNodes,
+          [&max_clique_size](const std::vector<int>& clique) {
+            max_clique_size =
+                std::max(max_clique_size, static_cast<int>(clique.size()));
+            return CliqueResponse::CONTINUE;
+          });
+      bron_kerbosch.Run();
+
+      std::vector<int> clique;
+      EXPECT_EQ(BronKerboschAlgorithmStatus::COMPLETED,
+                FindMaximumClique(graph, kNumNodes, nullptr, &clique));
+      EXPECT_EQ(clique.size(), max_clique_size);
+      EXPECT_TRUE(IsClique(graph, clique));
+      EXPECT_TRUE(std::is_sorted(clique.begin(), clique.end()));
+    }
+  }
+}
+
+TEST(FindMaximumCliqueTest, DeterministicTimeLimit) {
+  const absl::flat_hash_set<std::pair<int, int>> adjacency_matrix =
+      MakeRandomGraphAdjacencyMatrix(500, 0.9, 1);
+  const auto graph = [&adjacency_matrix](int index1, int index2) {
+    return BitmapGraph(adjacency_matrix, index1, index2);
+  };
+  std::unique_ptr<TimeLimit> time_limit =
+      TimeLimit::FromDeterministicTime(0.01);
+  std::vector<int> clique;
+  EXPECT_EQ(BronKerboschAlgorithmStatus::INTERRUPTED,
+            FindMaximumClique(graph, 500, time_limit.get(), &clique));
+  EXPECT_TRUE(time_limit->LimitReached());
+  EXPECT_TRUE(IsClique(graph, clique));
+}
+
 // A benchmark that finds all maximal cliques in a modulo graph of the given
 // size.
 void BM_FindCliquesInModuloGraph(benchmark::State& state) {
@@ -673,5 +747,29 @@ BENCHMARK(BM_FindCliquesInRandomGraphWithBronKerboschAlgorithm)
     ->ArgPair(1000, 100)
     ->ArgPair(10000, 1);
 
+void BM_FindMaximumCliqueInRandomGraph(benchmark::State& state) {
+  int num_nodes = state.range(0);
+  int arc_probability_permille = state.range(1);
+  const double arc_probability = arc_probability_permille / 1000.0;
+  const absl::flat_hash_set<std::pair<int, int>> adjacency_matrix =
+      MakeRandomGraphAdjacencyMatrix(num_nodes, arc_probability,
+                                     absl::GetFlag(FLAGS_test_random_seed));
+  const auto graph = [&adjacency_matrix](int index1, int index2) {
+    return BitmapGraph(adjacency_matrix, index1, index2);
+  };
+  std::vector<int> clique;
+  for (auto _ : state) {
+    FindMaximumClique(graph, num_nodes, nullptr, &clique);
+  }
+}
+
+BENCHMARK(BM_FindMaximumCliqueInRandomGraph)
+    ->ArgPair(50, 800)
+    ->ArgPair(100, 500)
+    ->ArgPair(200, 100)
+    ->ArgPair(1000, 10)
+    ->ArgPair(1000, 100)
+    ->ArgPair(200, 900);
+
 }  // namespace
 }  // namespace operations_research
@@ -30,7 +30,9 @@
 #include "ortools/graph/connected_components.h"
 
 #include <algorithm>
+#include <atomic>
 #include <numeric>
+#include <utility>
 #include <vector>
 
 #include "ortools/base/stl_util.h"
@@ -162,3 +164,81 @@ std::vector<int> DenseConnectedComponentsFinder::GetComponentIds() {
   }
   return component_ids;
 }
+
+ConcurrentDenseConnectedComponentsFinder::
+    ConcurrentDenseConnectedComponentsFinder(int num_nodes)
+    : num_nodes_(num_nodes),
+      parent_(new std::atomic<int>[num_nodes]),
+      num_components_(num_nodes) {
+  for (int node = 0; node < num_nodes; ++node) {
+    parent_[node].store(node, std::memory_order_relaxed);
+  }
+}
+
+int ConcurrentDenseConnectedComponentsFinder::FindRoot(int node) {
+  DCHECK_GE(node, 0);
+  DCHECK_LT(node, num_nodes_);
+  while (true) {
+    int parent = parent_[node].load(std::memory_order_acquire);
+    if (parent == node) return node;
+    const int grandparent = parent_[parent].load(std::memory_order_acquire);
+    if (grandparent != parent) {
+      // Path halving. Failing is fine: someone else shortened the path.
+      parent_[node].compare_exchange_weak(parent, grandparent,
+                                          std::memory_order_release,
+                                          std::memory_order_relaxed);
+    }
+    node = grandparent;
+  }
+}
+
+bool ConcurrentDenseConnectedComponentsFinder::AddEdge(int node1, int node2) {
+  while (true) {
+    int root1 = FindRoot(node1);
+    int root2 = FindRoot(node2);
+    if (root1 == root2) return false;
+    if (root1 < root2) std::swap(root1, root2);
+    // Link root1 under root2 < root1. This only succeeds if root1 is still a
+    // root, otherwise we retry from the new roots.
+    int expected = root1;
+    if (parent_[root1].compare_exchange_strong(expected, root2,
+                                               std::memory_order_acq_rel)) {
+      num_components_.fetch_sub(1, std::memory_order_relaxed);
+      return true;
+    }
+    node1 = root1;
+    node2 = root2;
+  }
+}
+
+bool ConcurrentDenseConnectedComponentsFinder::Connected(int node1,
+                                                         int node2) {
+  if (node1 < 0 || node1 >= num_nodes_ || node2 < 0 || node2 >= num_nodes_) {
+    return false;
+  }
+  while (true) {
+    const int root1 = FindRoot(node1);
+    const int root2 = FindRoot(node2);
+    if (root1 == root2) return true;
+    // If root1 is still a root, the two nodes were not connected at the time
+    // root2 was found.
+    if (parent_[root1].load(std::memory_order_acquire) == root1) return false;
+    node1 = root1;
+    node2 = root2;
+  }
+}
+
+std::vector<int> ConcurrentDenseConnectedComponentsFinder::GetComponentIds() {
+  std::vector<int> component_ids(num_nodes_, -1);
+  int current_component = 0;
+  for (int node = 0; node < num_nodes_; ++node) {
+    // The root of a component is its smallest node, so it was already seen.
+    const int root = FindRoot(node);
+    if (root == node) {
+      component_ids[node] = current_component++;
+    } else {
+      component_ids[node] = component_ids[root];
+    }
+  }
+  return component_ids;
+}
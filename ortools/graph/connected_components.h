@@ -38,6 +38,7 @@
 #ifndef UTIL_GRAPH_CONNECTED_COMPONENTS_H_
 #define UTIL_GRAPH_CONNECTED_COMPONENTS_H_
 
+#include <atomic>
 #include <functional>
 #include <map>
 #include <memory>
@@ -142,6 +143,55 @@ class DenseConnectedComponentsFinder {
   int num_nodes_at_last_get_roots_call_ = 0;
 };
 
+// A union-find on dense ints whose AddEdge() and FindRoot() can be called
+// concurrently from several threads, to find the connected components of huge
+// graphs in parallel: each thread simply adds a slice of the edges.
+//
+// This is a lock-free union-find, see for instance R.J. Anderson, H. Woll,
+// "Wait-free parallel algorithms for the union-find problem", STOC 1991. Roots
+// are linked with a compare-and-swap, always under the root with the smallest
+// index (which keeps the forest acyclic and makes the root of a component its
+// smallest node), and paths are shortened with path halving.
+//
+// The number of nodes is fixed at construction. It uses one std::atomic<int>
+// per node, and GetSize() is not supported.
+class ConcurrentDenseConnectedComponentsFinder {
+ public:
+  explicit ConcurrentDenseConnectedComponentsFinder(int num_nodes);
+
+  // This type is neither copyable nor movable.
+  ConcurrentDenseConnectedComponentsFinder(
+      const ConcurrentDenseConnectedComponentsFinder&) = delete;
+  ConcurrentDenseConnectedComponentsFinder& operator=(
+      const ConcurrentDenseConnectedComponentsFinder&) = delete;
+
+  // Thread-safe. Returns true iff this call merged two components.
+  bool AddEdge(int node1, int node2);
+
+  // Thread-safe. Note that while edges are added concurrently, the returned
+  // root may already be outdated when this returns.
+  int FindRoot(int node);
+
+  // Thread-safe, with the same caveat as FindRoot().
+  bool Connected(int node1, int node2);
+
+  int GetNumberOfNodes() const { return num_nodes_; }
+  int GetNumberOfComponents() const {
+    return num_components_.load(std::memory_order_relaxed);
+  }
+
+  // Returns the same as GetConnectedComponents(). This must not be called
+  // while other threads are adding edges.
+  std::vector<int> GetComponentIds();
+
+ private:
+  const int num_nodes_;
+  // parent_[i] is the id of an ancestor of node i, i is a root iff
+  // parent_[i] == i. We always have parent_[i] <= i.
+  std::unique_ptr<std::atomic<int>[]> parent_;
+  std::atomic<int> num_components_;
+};
+
 namespace internal {
 // A helper to deduce the type of map to use depending on whether CompareOrHashT
 // is a comparator or a hasher (prefer the latter).
@@ -0,0 +1,79 @@
+// Copyright 2010-2022 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ortools/graph/connected_components.h"
+
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "absl/random/distributions.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using ::testing::ElementsAre;
+
+TEST(ConcurrentDenseConnectedComponentsFinderTest, Simple) {
+  // 5--3--0--1  2--4
+  ConcurrentDenseConnectedComponentsFinder finder(6);
+  EXPECT_TRUE(finder.AddEdge(5, 3));
+  EXPECT_TRUE(finder.AddEdge(3, 0));
+  EXPECT_TRUE(finder.AddEdge(0, 1));
+  EXPECT_TRUE(finder.AddEdge(2, 4));
+  EXPECT_FALSE(finder.AddEdge(1, 5));
+  EXPECT_EQ(finder.GetNumberOfComponents(), 2);
+  EXPECT_TRUE(finder.Connected(1, 5));
+  EXPECT_FALSE(finder.Connected(1, 4));
+  EXPECT_EQ(finder.FindRoot(5), 0);
+  EXPECT_EQ(finder.FindRoot(4), 2);
+  EXPECT_THAT(finder.GetComponentIds(), ElementsAre(0, 0, 1, 0, 1, 0));
+}
+
+TEST(ConcurrentDenseConnectedComponentsFinderTest,
+     MultiThreadedMatchesSequential) {
+  const int kNumNodes = 20000;
+  const int kNumEdges = 15000;
+  const int kNumThreads = 8;
+  std::mt19937 random(12345);
+  std::vector<std::pair<int, int>> edges(kNumEdges);
+  for (auto& [node1, node2] : edges) {
+    node1 = absl::Uniform(random, 0, kNumNodes);
+    node2 = absl::Uniform(random, 0, kNumNodes);
+  }
+
+  DenseConnectedComponentsFinder sequential_finder;
+  sequential_finder.SetNumberOfNodes(kNumNodes);
+  for (const auto& [node1, node2] : edges) {
+    sequential_finder.AddEdge(node1, node2);
+  }
+
+  ConcurrentDenseConnectedComponentsFinder finder(kNumNodes);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&finder, &edges, t]() {
+      for (int i = t; i < edges.size(); i += kNumThreads) {
+        finder.AddEdge(edges[i].first, edges[i].second);
+      }
+    });
+  }
+  for (std::thread& thread : threads) thread.join();
+
+  EXPECT_EQ(finder.GetNumberOfComponents(),
+            sequential_finder.GetNumberOfComponents());
+  EXPECT_EQ(finder.GetComponentIds(), sequential_finder.GetComponentIds());
+}
+
+}  // namespace
@@ -593,6 +593,12 @@ class HamiltonianPathSolver {
   int best_hamiltonian_path_end_node_;
 
   LatticeMemoryManager<NodeSet, CostType> mem_;
+
+  // Copy of the cost matrix used by the inner loop of Solve(), stored by
+  // destination: incoming_costs_[dest * num_nodes_ + src] = Cost(src, dest).
+  // This makes the accesses contiguous, and avoids calling the cost function
+  // O(2^n * n^2) times when it is not a matrix. It is kept across solves.
+  std::vector<CostType> incoming_costs_;
 };
 
 // Utility function to simplify building a HamiltonianPathSolver from a functor.
@@ -656,6 +662,12 @@ void HamiltonianPathSolver<CostType, CostFunction>::Solve() {
     return;
   }
   mem_.Init(num_nodes_);
+  incoming_costs_.resize(num_nodes_ * num_nodes_);
+  for (int dest = 0; dest < num_nodes_; ++dest) {
+    for (int src = 0; src < num_nodes_; ++src) {
+      incoming_costs_[dest * num_nodes_ + src] = Cost(src, dest);
+    }
+  }
   // Initialize the first layer of the search lattice, taking into account
   // that base_offset_[1] == 0. (This is what the DCHECK_EQ is for).
   for (int dest = 0; dest < num_nodes_; ++dest) {
@@ -686,11 +698,13 @@ void HamiltonianPathSolver<CostType, CostFunction>::Solve() {
         // by taking into account that prev_dest is now in subset, and
         // that dest is now removed from subset.
         subset_offset += mem_.OffsetDelta(card - 1, prev_dest, dest, dest_rank);
+        const CostType* const costs_to_dest =
+            &incoming_costs_[dest * num_nodes_];
         int src_rank = 0;
         for (int src : subset) {
           min_cost = std::min(
               min_cost, Saturated<CostType>::Add(
-                            Cost(src, dest),
+                            costs_to_dest[src],
                             mem_.ValueAtOffset(subset_offset + src_rank)));
           ++src_rank;
         }
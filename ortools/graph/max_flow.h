@@ -365,6 +365,17 @@ class GenericMaxFlow : public MaxFlowStatusClass {
   // Returns the index of the node corresponding to the sink of the network.
   NodeIndex GetSinkNodeIndex() const { return sink_; }
 
+  // Changes the source and sink of the network. The next Solve() starts from
+  // scratch, so this allows to compute many max flows on the same graph and
+  // capacities without rebuilding anything.
+  void SetSourceAndSink(NodeIndex source, NodeIndex sink) {
+    DCHECK(graph_->IsNodeValid(source));
+    DCHECK(graph_->IsNodeValid(sink));
+    source_ = source;
+    sink_ = sink;
+    status_ = NOT_SOLVED;
+  }
+
   // Sets the capacity for arc to new_capacity.
   void SetArcCapacity(ArcIndex arc, FlowQuantity new_capacity);
 
@@ -74,7 +74,9 @@ template <typename Graph, typename ArcFlowType, typename ArcScaledCostType>
 void GenericMinCostFlow<Graph, ArcFlowType, ArcScaledCostType>::SetNodeSupply(
     NodeIndex node, FlowQuantity supply) {
   DCHECK(graph_->IsNodeValid(node));
-  node_excess_[node] = supply;
+  // Only apply the change of supply to the excess, so that the current flow
+  // stays consistent and can be reused by the next Solve().
+  node_excess_[node] += supply - initial_node_excess_[node];
   initial_node_excess_[node] = supply;
   status_ = NOT_SOLVED;
   feasibility_checked_ = false;
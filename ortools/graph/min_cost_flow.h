@@ -407,7 +407,9 @@ class GenericMinCostFlow : public MinCostFlowBase {
   Status status() const { return status_; }
 
   // Sets the supply corresponding to node. A demand is modeled as a negative
-  // supply.
+  // supply. The current flow is kept, so that after a Solve(), changing some
+  // supplies or capacities and calling Solve() again starts from the previous
+  // flow instead of from scratch.
   void SetNodeSupply(NodeIndex node, FlowQuantity supply);
 
   // Sets the unit cost for the given arc.
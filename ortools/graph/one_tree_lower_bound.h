@@ -330,10 +330,14 @@ int GetNodeMinimizingEdgeCostToSource(const GraphType& graph, int source,
 
 // Computes a 1-tree for the given graph, cost function and node weights.
 // Returns the degree of each node in the 1-tree and the un-weighed cost of the
-// 1-tree.
-template <typename CostFunction, typename GraphType, typename CostType>
+// 1-tree. arc_cost(arc) must be equal to
+// cost(graph.Tail(arc), graph.Head(arc)); this allows callers to cache the
+// costs of the arcs of the graph.
+template <typename CostFunction, typename ArcCostFunction, typename GraphType,
+          typename CostType>
 std::vector<int> ComputeOneTree(const GraphType& graph,
                                 const CostFunction& cost,
+                                const ArcCostFunction& arc_cost,
                                 const std::vector<double>& weights,
                                 const std::vector<int>& sorted_arcs,
                                 CostType* one_tree_cost) {
@@ -347,8 +351,9 @@ std::vector<int> ComputeOneTree(const GraphType& graph,
                                                                    sorted_arcs);
   } else {
     mst = BuildPrimMinimumSpanningTree<GraphType>(
-        graph, [&weighed_cost, &graph](int arc) {
-          return weighed_cost(graph.Tail(arc), graph.Head(arc));
+        graph, [&arc_cost, &weights, &graph](int arc) {
+          return arc_cost(arc) + weights[graph.Tail(arc)] +
+                 weights[graph.Head(arc)];
         });
   }
   std::vector<int> degrees(graph.num_nodes() + 1, 0);
@@ -356,7 +361,7 @@ std::vector<int> ComputeOneTree(const GraphType& graph,
   for (int arc : mst) {
     degrees[graph.Head(arc)]++;
     degrees[graph.Tail(arc)]++;
-    *one_tree_cost += cost(graph.Tail(arc), graph.Head(arc));
+    *one_tree_cost += arc_cost(arc);
   }
   // Add 2 cheapest edges from the nodes in the graph to the extra node not in
   // the graph.
@@ -377,6 +382,19 @@ std::vector<int> ComputeOneTree(const GraphType& graph,
   return degrees;
 }
 
+template <typename CostFunction, typename GraphType, typename CostType>
+std::vector<int> ComputeOneTree(const GraphType& graph,
+                                const CostFunction& cost,
+                                const std::vector<double>& weights,
+                                const std::vector<int>& sorted_arcs,
+                                CostType* one_tree_cost) {
+  const auto arc_cost = [&cost, &graph](int arc) {
+    return cost(graph.Tail(arc), graph.Head(arc));
+  };
+  return ComputeOneTree(graph, cost, arc_cost, weights, sorted_arcs,
+                        one_tree_cost);
+}
+
 // Computes the lower bound of a TSP using a given subgradient algorithm.
 template <typename CostFunction, typename Algorithm>
 double ComputeOneTreeLowerBoundWithAlgorithm(int number_of_nodes,
@@ -392,9 +410,16 @@ double ComputeOneTreeLowerBoundWithAlgorithm(int number_of_nodes,
   // 1-tree arcs.
   AddArcsFromMinimumSpanningTree(number_of_nodes - 1, cost, &nearest);
   util::ListGraph<int, int> graph(number_of_nodes - 1, nearest.size());
+  // The costs of the arcs of the partial graph are used at each iteration, and
+  // the cost function may be expensive: cache them. This only takes
+  // O(number_of_nodes * nearest_neighbors) memory.
+  std::vector<CostType> arc_costs;
+  arc_costs.reserve(nearest.size());
   for (const auto& arc : nearest) {
     graph.AddArc(arc.first, arc.second);
+    arc_costs.push_back(cost(arc.first, arc.second));
   }
+  const auto arc_cost = [&arc_costs](int arc) { return arc_costs[arc]; };
   std::vector<double> weights(number_of_nodes, 0);
   std::vector<double> best_weights(number_of_nodes, 0);
   double max_w = -std::numeric_limits<double>::infinity();
@@ -403,7 +428,7 @@ double ComputeOneTreeLowerBoundWithAlgorithm(int number_of_nodes,
   while (algorithm->Next()) {
     CostType one_tree_cost = 0;
     const std::vector<int> degrees =
-        ComputeOneTree(graph, cost, weights, {}, &one_tree_cost);
+        ComputeOneTree(graph, cost, arc_cost, weights, {}, &one_tree_cost);
     algorithm->OnOneTree(one_tree_cost, w, degrees);
     w = one_tree_cost;
     for (int j = 0; j < number_of_nodes; ++j) {
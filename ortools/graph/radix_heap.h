@@ -0,0 +1,125 @@
+// Copyright 2010-2022 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// A radix heap is a monotone priority queue on unsigned integer keys: the keys
+// pushed must never be smaller than the last key popped. This is the case in
+// Dijkstra's algorithm with non-negative integer arc lengths, where it is
+// usually faster than a binary heap, since elements are only moved
+// O(log(max_key)) times in total and the buckets are plain vectors.
+//
+// Decrease-key is not supported: as usual with lazy Dijkstra implementations,
+// push the node again with its new distance and skip the stale entries when
+// they are popped.
+//
+// References:
+// R.K. Ahuja, K. Mehlhorn, J.B. Orlin, R.E. Tarjan, "Faster algorithms for the
+// shortest path problem", Journal of the ACM (1990) 37:213-223.
+//
+// Example:
+//   RadixHeap<uint32_t, int> heap;
+//   heap.Push(distance, node);
+//   while (!heap.IsEmpty()) {
+//     const auto [distance, node] = heap.Pop();
+//     if (distance > distances[node]) continue;  // Stale entry.
+//     ...
+//   }
+
+#ifndef OR_TOOLS_GRAPH_RADIX_HEAP_H_
+#define OR_TOOLS_GRAPH_RADIX_HEAP_H_
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "absl/numeric/bits.h"
+#include "ortools/base/logging.h"
+
+namespace operations_research {
+
+template <typename Key, typename Value>
+class RadixHeap {
+ public:
+  static_assert(std::is_unsigned<Key>::value,
+                "RadixHeap requires an unsigned integer key type.");
+
+  RadixHeap() : size_(0), last_key_(0) {}
+
+  bool IsEmpty() const { return size_ == 0; }
+  int Size() const { return size_; }
+
+  // Removes all the elements, and resets the minimum allowed key to 0.
+  void Clear() {
+    for (std::vector<std::pair<Key, Value>>& bucket : buckets_) {
+      bucket.clear();
+    }
+    size_ = 0;
+    last_key_ = 0;
+  }
+
+  // Adds an element. 'key' must be greater or equal to the key of the last
+  // element returned by Pop().
+  void Push(Key key, Value value) {
+    DCHECK_GE(key, last_key_);
+    buckets_[BucketIndex(key)].push_back({key, value});
+    ++size_;
+  }
+
+  // Removes and returns an element with the smallest key. Among elements with
+  // the same key, the order in which they are returned is unspecified.
+  std::pair<Key, Value> Pop() {
+    DCHECK(!IsEmpty());
+    if (buckets_[0].empty()) Redistribute();
+    const std::pair<Key, Value> top = buckets_[0].back();
+    buckets_[0].pop_back();
+    --size_;
+    return top;
+  }
+
+ private:
+  // Bucket b > 0 contains the keys whose highest bit differing from last_key_
+  // is bit b - 1. Bucket 0 contains the keys equal to last_key_.
+  int BucketIndex(Key key) const { return absl::bit_width(key ^ last_key_); }
+
+  // Moves the content of the first non-empty bucket to lower buckets, using
+  // its minimum key as the new last_key_. At least one element ends up in
+  // bucket 0.
+  void Redistribute() {
+    int index = 1;
+    while (buckets_[index].empty()) ++index;
+    std::vector<std::pair<Key, Value>>& bucket = buckets_[index];
+    Key min_key = bucket[0].first;
+    for (const std::pair<Key, Value>& element : bucket) {
+      min_key = std::min(min_key, element.first);
+    }
+    last_key_ = min_key;
+    for (const std::pair<Key, Value>& element : bucket) {
+      const int new_index = BucketIndex(element.first);
+      DCHECK_LT(new_index, index);
+      buckets_[new_index].push_back(element);
+    }
+    bucket.clear();
+  }
+
+  int size_;
+  Key last_key_;
+  std::array<std::vector<std::pair<Key, Value>>,
+             std::numeric_limits<Key>::digits + 1>
+      buckets_;
+};
+
+}  // namespace operations_research
+
+#endif  // OR_TOOLS_GRAPH_RADIX_HEAP_H_
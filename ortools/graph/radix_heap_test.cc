@@ -0,0 +1,89 @@
+// Copyright 2010-2022 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ortools/graph/radix_heap.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "absl/random/distributions.h"
+#include "gtest/gtest.h"
+
+namespace operations_research {
+namespace {
+
+TEST(RadixHeapTest, Empty) {
+  RadixHeap<uint32_t, int> heap;
+  EXPECT_TRUE(heap.IsEmpty());
+  EXPECT_EQ(heap.Size(), 0);
+}
+
+TEST(RadixHeapTest, PopsInNonDecreasingKeyOrder) {
+  RadixHeap<uint32_t, int> heap;
+  heap.Push(5, 0);
+  heap.Push(3, 1);
+  heap.Push(3, 2);
+  heap.Push(12, 3);
+  heap.Push(0, 4);
+  EXPECT_EQ(heap.Size(), 5);
+  EXPECT_EQ(heap.Pop().second, 4);
+  const int first_at_3 = heap.Pop().second;
+  const int second_at_3 = heap.Pop().second;
+  EXPECT_EQ(first_at_3 + second_at_3, 3);
+  // Keys greater or equal to the last popped key can still be pushed.
+  heap.Push(3, 5);
+  heap.Push(7, 6);
+  EXPECT_EQ(heap.Pop().second, 5);
+  EXPECT_EQ(heap.Pop().second, 0);
+  EXPECT_EQ(heap.Pop().second, 6);
+  EXPECT_EQ(heap.Pop().second, 3);
+  EXPECT_TRUE(heap.IsEmpty());
+}
+
+TEST(RadixHeapTest, ClearResetsMinimumKey) {
+  RadixHeap<uint64_t, int> heap;
+  heap.Push(100, 0);
+  EXPECT_EQ(heap.Pop().first, 100);
+  heap.Clear();
+  heap.Push(1, 1);
+  EXPECT_EQ(heap.Pop().first, 1);
+}
+
+TEST(RadixHeapTest, RandomMonotoneSequenceMatchesSort) {
+  std::mt19937 random(12345);
+  RadixHeap<uint32_t, int> heap;
+  std::vector<uint32_t> reference;
+  uint32_t last_popped = 0;
+  std::vector<uint32_t> popped;
+  for (int step = 0; step < 10000; ++step) {
+    if (heap.IsEmpty() || absl::Bernoulli(random, 0.6)) {
+      const uint32_t key =
+          last_popped + absl::Uniform<uint32_t>(random, 0, 1000);
+      heap.Push(key, step);
+      reference.push_back(key);
+    } else {
+      last_popped = heap.Pop().first;
+      popped.push_back(last_popped);
+      const auto it = std::min_element(reference.begin(), reference.end());
+      EXPECT_EQ(*it, last_popped);
+      reference.erase(it);
+    }
+    EXPECT_EQ(heap.Size(), reference.size());
+  }
+  EXPECT_TRUE(std::is_sorted(popped.begin(), popped.end()));
+}
+
+}  // namespace
+}  // namespace operations_research
@@ -18,11 +18,9 @@
 #include <utility>
 #include <vector>
 
-#include "absl/container/flat_hash_map.h"
 #include "absl/functional/bind_front.h"
 #include "ortools/base/adjustable_priority_queue-inl.h"
 #include "ortools/base/adjustable_priority_queue.h"
-#include "ortools/base/map_util.h"
 #include "ortools/base/stl_util.h"
 #include "ortools/base/threadpool.h"
 #include "ortools/base/timer.h"
@@ -143,29 +141,23 @@ void PathTree::Initialize(const std::vector<NodeIndex>& paths,
   }
   std::sort(tree.begin(), tree.end());
   const int num_nodes = tree.size();
-  {
-    // Using a dense_hash_map gives a huge speedup over hash_map here, mainly
-    // due to better memory management.
-    absl::flat_hash_map<NodeIndex, int> node_indices;
-
-    for (int i = 0; i < num_nodes; ++i) {
-      node_indices[tree[i].first] = i;
-    }
-    parents_.resize(num_nodes, -1);
-    for (int i = 0; i < num_nodes; ++i) {
-      if (tree[i].second == kNilNode) {
-        // dense_hash_map does not allow empty key to be used as a key.
-        parents_[i] = kNilNode;
-      } else {
-        parents_[i] =
-            gtl::FindWithDefault(node_indices, tree[i].second, kNilNode);
-      }
-    }
-  }
   nodes_.resize(num_nodes, kNilNode);
   for (int i = 0; i < num_nodes; ++i) {
     nodes_[i] = tree[i].first;
   }
+  // nodes_ is sorted, so the index of a parent can be found by binary search;
+  // this avoids building a node-to-index hash map for each tree.
+  parents_.resize(num_nodes, -1);
+  for (int i = 0; i < num_nodes; ++i) {
+    const NodeIndex parent = tree[i].second;
+    parents_[i] = kNilNode;
+    if (parent == kNilNode) continue;
+    const auto parent_position =
+        std::lower_bound(nodes_.begin(), nodes_.end(), parent);
+    if (parent_position != nodes_.end() && *parent_position == parent) {
+      parents_[i] = parent_position - nodes_.begin();
+    }
+  }
 }
 
 NodeIndex PathTree::GetParent(NodeIndex node) const {
@@ -467,7 +459,7 @@ void ComputeOneToManyInternalOnGraph(
   // directly which will avoid marking the source.
   for (const typename GraphType::ArcIndex arc : graph->OutgoingArcs(source)) {
     const typename GraphType::NodeIndex next = graph->Head(arc);
-    if (InsertOrUpdateEntry(arc_lengths->at(arc), &entries[next],
+    if (InsertOrUpdateEntry((*arc_lengths)[arc], &entries[next],
                             &priority_queue)) {
       predecessor[next] = source;
     }
@@ -491,7 +483,7 @@ void ComputeOneToManyInternalOnGraph(
       NodeEntry* const entry = &entries[next];
       if (!entry->settled()) {
         DCHECK_GE(current_distance, 0);
-        const PathDistance arc_length = arc_lengths->at(arc);
+        const PathDistance arc_length = (*arc_lengths)[arc];
         DCHECK_LE(current_distance, kDisconnectedPathDistance - arc_length);
         if (InsertOrUpdateEntry(current_distance + arc_length, entry,
                                 &priority_queue)) {
@@ -995,6 +995,7 @@ absl::StatusOr<GScipResult> GScip::Solve(
   // TODO(user): refactor this into a new method.
   stats->set_best_bound(ScipInfUnclamp(SCIPgetDualbound(scip_)));
   stats->set_node_count(SCIPgetNTotalNodes(scip_));
+  stats->set_num_threads(GScipMaxNumThreads(params));
   stats->set_first_lp_relaxation_bound(SCIPgetFirstLPDualboundRoot(scip_));
   stats->set_root_node_bound(SCIPgetDualboundRoot(scip_));
   if (stage != SCIP_STAGE_PRESOLVING) {
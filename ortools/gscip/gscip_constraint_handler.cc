@@ -20,6 +20,7 @@
 
 #include "absl/log/check.h"
 #include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/span.h"
 #include "ortools/base/logging.h"
@@ -249,6 +250,19 @@ double GScipConstraintHandlerContext::VariableValue(SCIP_VAR* variable) const {
   return SCIPgetSolVal(gscip_->scip(), current_solution_, variable);
 }
 
+absl::Status GScipConstraintHandlerContext::VariableValues(
+    absl::Span<SCIP_VAR* const> variables, absl::Span<double> values) const {
+  if (variables.size() != values.size()) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("got ", variables.size(), " variables but ",
+                     values.size(), " values"));
+  }
+  if (variables.empty()) return absl::OkStatus();
+  return SCIP_TO_STATUS(SCIPgetSolVals(
+      gscip_->scip(), current_solution_, static_cast<int>(variables.size()),
+      const_cast<SCIP_VAR**>(variables.data()), values.data()));
+}
+
 absl::StatusOr<GScipCallbackResult> GScipConstraintHandlerContext::AddCut(
     const GScipLinearRange& range, const std::string& name,
     const GScipCutOptions& options) {
@@ -28,6 +28,7 @@
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 #include "ortools/gscip/gscip.h"
 #include "ortools/gscip/gscip_callback_result.h"
 #include "scip/type_cons.h"
@@ -169,6 +170,13 @@ class GScipConstraintHandlerContext {
   // CONS_SEPALP). Equivalent to calling SCIPgetSolVal.
   double VariableValue(SCIP_VAR* variable) const;
 
+  // Fills values[i] with the current solution value of variables[i], with a
+  // single call to SCIPgetSolVals. Prefer this to calling VariableValue() in a
+  // loop when a callback reads many variables, e.g. to collect them into a
+  // dense vector indexed like `variables`. Both spans must have the same size.
+  absl::Status VariableValues(absl::Span<SCIP_VAR* const> variables,
+                              absl::Span<double> values) const;
+
   // Adds a cut (row) to the SCIP separation storage.
   //
   // If this is called and succeeds, the callback result must be the one
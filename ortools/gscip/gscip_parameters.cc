@@ -26,6 +26,7 @@ namespace operations_research {
 namespace {
 constexpr absl::string_view kLimitsTime = "limits/time";
 constexpr absl::string_view kParallelMaxNThreads = "parallel/maxnthreads";
+constexpr absl::string_view kParallelMode = "parallel/mode";
 constexpr absl::string_view kDisplayVerbLevel = "display/verblevel";
 constexpr absl::string_view kRandomSeedParam = "randomization/randomseedshift";
 constexpr absl::string_view kCatchCtrlCParam = "misc/catchctrlc";
@@ -76,6 +77,24 @@ bool GScipMaxNumThreadsSet(const GScipParameters& parameters) {
   return parameters.int_params().contains(std::string(kParallelMaxNThreads));
 }
 
+void GScipSetDeterministicParallelMode(const bool deterministic,
+                                       GScipParameters* const parameters) {
+  // SCIP encodes the opportunistic mode as 0 and the deterministic one as 1.
+  (*parameters->mutable_int_params())[std::string(kParallelMode)] =
+      deterministic ? 1 : 0;
+}
+
+bool GScipDeterministicParallelMode(const GScipParameters& parameters) {
+  if (GScipDeterministicParallelModeSet(parameters)) {
+    return parameters.int_params().at(std::string(kParallelMode)) != 0;
+  }
+  return true;
+}
+
+bool GScipDeterministicParallelModeSet(const GScipParameters& parameters) {
+  return parameters.int_params().contains(std::string(kParallelMode));
+}
+
 void GScipSetLogLevel(GScipParameters* parameters, int log_level) {
   CHECK_GE(log_level, 0);
   CHECK_LE(log_level, 5);
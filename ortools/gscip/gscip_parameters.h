@@ -30,6 +30,18 @@ void GScipSetMaxNumThreads(int num_threads, GScipParameters* parameters);
 int GScipMaxNumThreads(const GScipParameters& parameters);
 bool GScipMaxNumThreadsSet(const GScipParameters& parameters);
 
+// Sets the parallel/mode property, which is only relevant when SCIP runs
+// concurrently (see GScipSetMaxNumThreads()). In deterministic mode, the
+// concurrent solvers only exchange information at deterministic time
+// checkpoints, so repeated solves give the same result; in opportunistic mode
+// they synchronize as soon as possible, which is usually faster.
+void GScipSetDeterministicParallelMode(bool deterministic,
+                                       GScipParameters* parameters);
+// Returns true if the parallel/mode property is not set (the default SCIP
+// behavior).
+bool GScipDeterministicParallelMode(const GScipParameters& parameters);
+bool GScipDeterministicParallelModeSet(const GScipParameters& parameters);
+
 // log_level must be in [0, 5], where 0 is none, 5 is most verbose, and the
 // default is 4. CHECK fails on bad log_level. Default level displays standard
 // search logs.
@@ -17,9 +17,12 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <thread>  // NOLINT
 #include <vector>
 
 #include "absl/base/attributes.h"
+#include "absl/status/status.h"
+#include "absl/synchronization/mutex.h"
 #include "ortools/base/logging.h"
 #include "ortools/glop/lp_solver.h"
 #include "ortools/glop/parameters.pb.h"
@@ -89,12 +92,24 @@ class GLOPInterface : public MPSolverInterface {
   void SetLpAlgorithm(int value) override;
   bool SetSolverSpecificParametersAsString(
       const std::string& parameters) override;
+  absl::Status SetNumThreads(int num_threads) override;
 
  private:
-  void NonIncrementalChange();
+  // Solves linear_program_ with lp_solver_ and, in another thread, with the
+  // other simplex algorithm (primal vs dual). The first solver to reach a
+  // conclusive status interrupts the other one. Returns the solver whose
+  // solution should be used.
+  const glop::LPSolver& ConcurrentSolve(TimeLimit* time_limit,
+                                        glop::ProblemStatus* status);
 
   glop::LinearProgram linear_program_;
   glop::LPSolver lp_solver_;
+
+  // Only used when num_threads_ > 1, see ConcurrentSolve().
+  int num_threads_ = 1;
+  std::unique_ptr<glop::LPSolver> concurrent_solver_;
+  const glop::LPSolver* last_solver_ = &lp_solver_;
+
   std::vector<MPSolver::BasisStatus> column_status_;
   std::vector<MPSolver::BasisStatus> row_status_;
   glop::GlopParameters parameters_;
@@ -113,10 +128,14 @@ GLOPInterface::GLOPInterface(MPSolver* const solver)
 GLOPInterface::~GLOPInterface() {}
 
 MPSolver::ResultStatus GLOPInterface::Solve(const MPSolverParameters& param) {
-  // Re-extract the problem from scratch. We don't support modifying the
-  // LinearProgram in sync with changes done in the MPSolver.
-  ResetExtractionInformation();
-  linear_program_.Clear();
+  // The changes done to the extracted part of the model are applied directly
+  // to linear_program_, so only the new variables and constraints need to be
+  // extracted here. lp_solver_ keeps its state across calls and can reuse its
+  // last basis when the problem structure did not change.
+  if (param.GetIntegerParam(MPSolverParameters::INCREMENTALITY) ==
+      MPSolverParameters::INCREMENTALITY_OFF) {
+    Reset();
+  }
   interrupt_solver_ = false;
   ExtractModel();
   SetParameters(param);
@@ -137,13 +156,19 @@ MPSolver::ResultStatus GLOPInterface::Solve(const MPSolverParameters& param) {
   std::unique_ptr<TimeLimit> time_limit =
       TimeLimit::FromParameters(lp_solver_.GetParameters());
   time_limit->RegisterExternalBooleanAsLimit(&interrupt_solver_);
-  const glop::ProblemStatus status =
-      lp_solver_.SolveWithTimeLimit(linear_program_, time_limit.get());
+  glop::ProblemStatus status;
+  if (num_threads_ > 1) {
+    last_solver_ = &ConcurrentSolve(time_limit.get(), &status);
+  } else {
+    last_solver_ = &lp_solver_;
+    status = lp_solver_.SolveWithTimeLimit(linear_program_, time_limit.get());
+  }
+  const glop::LPSolver& solution = *last_solver_;
 
   // The solution must be marked as synchronized even when no solution exists.
   sync_status_ = SOLUTION_SYNCHRONIZED;
   result_status_ = GlopToMPSolverResultStatus(status);
-  objective_value_ = lp_solver_.GetObjectiveValue();
+  objective_value_ = solution.GetObjectiveValue();
 
   const size_t num_vars = solver_->variables_.size();
   column_status_.resize(num_vars, MPSolver::FREE);
@@ -152,15 +177,15 @@ MPSolver::ResultStatus GLOPInterface::Solve(const MPSolverParameters& param) {
     const glop::ColIndex lp_solver_var_id(var->index());
 
     const glop::Fractional solution_value =
-        lp_solver_.variable_values()[lp_solver_var_id];
+        solution.variable_values()[lp_solver_var_id];
     var->set_solution_value(static_cast<double>(solution_value));
 
     const glop::Fractional reduced_cost =
-        lp_solver_.reduced_costs()[lp_solver_var_id];
+        solution.reduced_costs()[lp_solver_var_id];
     var->set_reduced_cost(static_cast<double>(reduced_cost));
 
     const glop::VariableStatus variable_status =
-        lp_solver_.variable_statuses()[lp_solver_var_id];
+        solution.variable_statuses()[lp_solver_var_id];
     column_status_.at(var_id) = GlopToMPSolverVariableStatus(variable_status);
   }
 
@@ -171,17 +196,79 @@ MPSolver::ResultStatus GLOPInterface::Solve(const MPSolverParameters& param) {
     const glop::RowIndex lp_solver_ct_id(ct->index());
 
     const glop::Fractional dual_value =
-        lp_solver_.dual_values()[lp_solver_ct_id];
+        solution.dual_values()[lp_solver_ct_id];
     ct->set_dual_value(static_cast<double>(dual_value));
 
     const glop::ConstraintStatus constraint_status =
-        lp_solver_.constraint_statuses()[lp_solver_ct_id];
+        solution.constraint_statuses()[lp_solver_ct_id];
     row_status_.at(ct_id) = GlopToMPSolverConstraintStatus(constraint_status);
   }
 
   return result_status_;
 }
 
+const glop::LPSolver& GLOPInterface::ConcurrentSolve(
+    TimeLimit* time_limit, glop::ProblemStatus* status) {
+  glop::GlopParameters other_parameters = lp_solver_.GetParameters();
+  other_parameters.set_use_dual_simplex(!other_parameters.use_dual_simplex());
+  if (concurrent_solver_ == nullptr) {
+    concurrent_solver_ = std::make_unique<glop::LPSolver>();
+  }
+  concurrent_solver_->SetParameters(other_parameters);
+
+  // Each solver works on its own copy of the problem and shares the stopping
+  // condition through interrupt_solver_.
+  glop::LinearProgram other_program;
+  other_program.PopulateFromLinearProgram(linear_program_);
+  std::unique_ptr<TimeLimit> other_time_limit =
+      TimeLimit::FromParameters(other_parameters);
+  other_time_limit->RegisterExternalBooleanAsLimit(&interrupt_solver_);
+
+  absl::Mutex mutex;
+  const glop::LPSolver* winner = nullptr;
+  glop::ProblemStatus statuses[2] = {glop::ProblemStatus::INIT,
+                                     glop::ProblemStatus::INIT};
+  const auto solve = [&](int i, glop::LPSolver* solver,
+                         const glop::LinearProgram& lp, TimeLimit* limit) {
+    const glop::ProblemStatus solve_status =
+        solver->SolveWithTimeLimit(lp, limit);
+    absl::MutexLock mutex_lock(&mutex);
+    statuses[i] = solve_status;
+    if (winner != nullptr) return;
+    switch (solve_status) {
+      case glop::ProblemStatus::OPTIMAL:
+      case glop::ProblemStatus::PRIMAL_INFEASIBLE:
+      case glop::ProblemStatus::DUAL_INFEASIBLE:
+      case glop::ProblemStatus::INFEASIBLE_OR_UNBOUNDED:
+      case glop::ProblemStatus::PRIMAL_UNBOUNDED:
+      case glop::ProblemStatus::DUAL_UNBOUNDED:
+      case glop::ProblemStatus::INVALID_PROBLEM:
+        winner = solver;
+        interrupt_solver_ = true;
+        break;
+      default:
+        break;
+    }
+  };
+  std::thread other_thread([&]() {
+    solve(1, concurrent_solver_.get(), other_program, other_time_limit.get());
+  });
+  solve(0, &lp_solver_, linear_program_, time_limit);
+  other_thread.join();
+
+  if (winner == concurrent_solver_.get()) {
+    *status = statuses[1];
+    return *concurrent_solver_;
+  }
+  *status = statuses[0];
+  return lp_solver_;
+}
+
+absl::Status GLOPInterface::SetNumThreads(int num_threads) {
+  num_threads_ = num_threads;
+  return absl::OkStatus();
+}
+
 bool GLOPInterface::InterruptSolve() {
   interrupt_solver_ = true;
   return true;
@@ -191,14 +278,24 @@ void GLOPInterface::Reset() {
   // Ignore any incremental info for the next solve. Note that the parameters
   // will not be reset as we re-read them on each Solve().
   lp_solver_.Clear();
+  concurrent_solver_.reset();
+  last_solver_ = &lp_solver_;
+  linear_program_.Clear();
+  ResetExtractionInformation();
 }
 
 void GLOPInterface::SetOptimizationDirection(bool maximize) {
-  NonIncrementalChange();
+  InvalidateSolutionSynchronization();
+  linear_program_.SetMaximizationProblem(maximize);
 }
 
 void GLOPInterface::SetVariableBounds(int index, double lb, double ub) {
-  NonIncrementalChange();
+  InvalidateSolutionSynchronization();
+  if (variable_is_extracted(index)) {
+    linear_program_.SetVariableBounds(glop::ColIndex(index), lb, ub);
+  } else {
+    sync_status_ = MUST_RELOAD;
+  }
 }
 
 void GLOPInterface::SetVariableInteger(int index, bool integer) {
@@ -206,38 +303,81 @@ void GLOPInterface::SetVariableInteger(int index, bool integer) {
 }
 
 void GLOPInterface::SetConstraintBounds(int index, double lb, double ub) {
-  NonIncrementalChange();
+  InvalidateSolutionSynchronization();
+  if (constraint_is_extracted(index)) {
+    linear_program_.SetConstraintBounds(glop::RowIndex(index), lb, ub);
+  } else {
+    sync_status_ = MUST_RELOAD;
+  }
 }
 
 void GLOPInterface::AddRowConstraint(MPConstraint* const ct) {
-  NonIncrementalChange();
+  sync_status_ = MUST_RELOAD;
 }
 
 void GLOPInterface::AddVariable(MPVariable* const var) {
-  NonIncrementalChange();
+  sync_status_ = MUST_RELOAD;
 }
 
 void GLOPInterface::SetCoefficient(MPConstraint* const constraint,
                                    const MPVariable* const variable,
                                    double new_value, double old_value) {
-  NonIncrementalChange();
+  InvalidateSolutionSynchronization();
+  if (constraint_is_extracted(constraint->index()) &&
+      variable_is_extracted(variable->index())) {
+    // The last coefficient set wins (and zeros are removed) when the matrix is
+    // cleaned up at the beginning of the next Solve().
+    linear_program_.SetCoefficient(glop::RowIndex(constraint->index()),
+                                   glop::ColIndex(variable->index()),
+                                   new_value);
+  } else {
+    // Handled in ExtractNewVariables() or ExtractNewConstraints().
+    sync_status_ = MUST_RELOAD;
+  }
 }
 
 void GLOPInterface::ClearConstraint(MPConstraint* const constraint) {
-  NonIncrementalChange();
+  InvalidateSolutionSynchronization();
+  // The constraint may not have been extracted yet.
+  if (!constraint_is_extracted(constraint->index())) return;
+  const glop::RowIndex row(constraint->index());
+  for (const auto& entry : constraint->coefficients_) {
+    const int var_index = entry.first->index();
+    if (variable_is_extracted(var_index)) {
+      linear_program_.SetCoefficient(row, glop::ColIndex(var_index), 0.0);
+    }
+  }
 }
 
 void GLOPInterface::SetObjectiveCoefficient(const MPVariable* const variable,
                                             double coefficient) {
-  NonIncrementalChange();
+  InvalidateSolutionSynchronization();
+  if (variable_is_extracted(variable->index())) {
+    linear_program_.SetObjectiveCoefficient(glop::ColIndex(variable->index()),
+                                            coefficient);
+  } else {
+    sync_status_ = MUST_RELOAD;
+  }
 }
 
-void GLOPInterface::SetObjectiveOffset(double value) { NonIncrementalChange(); }
+void GLOPInterface::SetObjectiveOffset(double value) {
+  InvalidateSolutionSynchronization();
+  linear_program_.SetObjectiveOffset(value);
+}
 
-void GLOPInterface::ClearObjective() { NonIncrementalChange(); }
+void GLOPInterface::ClearObjective() {
+  InvalidateSolutionSynchronization();
+  for (const auto& entry : solver_->objective_->coefficients_) {
+    const int var_index = entry.first->index();
+    if (variable_is_extracted(var_index)) {
+      linear_program_.SetObjectiveCoefficient(glop::ColIndex(var_index), 0.0);
+    }
+  }
+  linear_program_.SetObjectiveOffset(0.0);
+}
 
 int64_t GLOPInterface::iterations() const {
-  return lp_solver_.GetNumberOfSimplexIterations();
+  return last_solver_->GetNumberOfSimplexIterations();
 }
 
 int64_t GLOPInterface::nodes() const {
@@ -266,10 +406,8 @@ std::string GLOPInterface::SolverVersion() const {
 void* GLOPInterface::underlying_solver() { return &lp_solver_; }
 
 void GLOPInterface::ExtractNewVariables() {
-  DCHECK_EQ(0, last_variable_index_);
-  DCHECK_EQ(0, last_constraint_index_);
-
   const glop::ColIndex num_cols(solver_->variables_.size());
+  if (num_cols.value() == last_variable_index_) return;
   for (glop::ColIndex col(last_variable_index_); col < num_cols; ++col) {
     MPVariable* const var = solver_->variables_[col.value()];
     const glop::ColIndex new_col = linear_program_.CreateNewVariable();
@@ -277,13 +415,22 @@ void GLOPInterface::ExtractNewVariables() {
     set_variable_as_extracted(col.value(), true);
     linear_program_.SetVariableBounds(col, var->lb(), var->ub());
   }
+
+  // Add the new variables to the constraints that were already extracted.
+  for (int ct_index = 0; ct_index < last_constraint_index_; ++ct_index) {
+    const MPConstraint* const ct = solver_->constraints_[ct_index];
+    for (const auto& entry : ct->coefficients_) {
+      const int var_index = entry.first->index();
+      if (var_index < last_variable_index_) continue;
+      linear_program_.SetCoefficient(glop::RowIndex(ct_index),
+                                     glop::ColIndex(var_index), entry.second);
+    }
+  }
 }
 
 void GLOPInterface::ExtractNewConstraints() {
-  DCHECK_EQ(0, last_constraint_index_);
-
   const glop::RowIndex num_rows(solver_->constraints_.size());
-  for (glop::RowIndex row(0); row < num_rows; ++row) {
+  for (glop::RowIndex row(last_constraint_index_); row < num_rows; ++row) {
     MPConstraint* const ct = solver_->constraints_[row.value()];
     set_constraint_as_extracted(row.value(), true);
 
@@ -419,11 +566,6 @@ bool GLOPInterface::SetSolverSpecificParametersAsString(
   return false;
 }
 
-void GLOPInterface::NonIncrementalChange() {
-  // The current implementation is not incremental.
-  sync_status_ = MUST_RELOAD;
-}
-
 // Register GLOP in the global linear solver factory.
 MPSolverInterface* BuildGLOPInterface(MPSolver* const solver) {
   return new GLOPInterface(solver);
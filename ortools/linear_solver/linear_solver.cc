@@ -46,6 +46,7 @@
 #include "absl/synchronization/notification.h"
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
+#include "absl/types/span.h"
 #include "google/protobuf/text_format.h"
 #include "ortools/base/accurate_sum.h"
 #include "ortools/base/logging.h"
@@ -141,6 +142,15 @@ void MPConstraint::SetCoefficient(const MPVariable* const var, double coeff) {
   interface_->SetCoefficient(this, var, coeff, old_value);
 }
 
+void MPConstraint::SetCoefficients(absl::Span<const MPVariable* const> vars,
+                                   absl::Span<const double> coeffs) {
+  DCHECK_EQ(vars.size(), coeffs.size());
+  coefficients_.reserve(coefficients_.size() + vars.size());
+  for (int i = 0; i < vars.size(); ++i) {
+    SetCoefficient(vars[i], coeffs[i]);
+  }
+}
+
 void MPConstraint::Clear() {
   interface_->ClearConstraint(this);
   coefficients_.clear();
@@ -1199,6 +1209,42 @@ void MPSolver::SolveWithProto(const MPModelRequest& model_request,
   }
 }
 
+// static
+std::vector<MPSolutionResponse> MPSolver::SolveBatchWithProto(
+    absl::Span<const MPModelRequest> model_requests, int num_workers,
+    std::atomic<bool>* interrupt) {
+  std::vector<MPSolutionResponse> responses(model_requests.size());
+  if (model_requests.empty()) return responses;
+  {
+    ThreadPool thread_pool(
+        "MPSolverBatch",
+        std::clamp<int>(num_workers, 1, model_requests.size()));
+    thread_pool.StartWorkers();
+    for (int i = 0; i < model_requests.size(); ++i) {
+      thread_pool.Schedule([&model_requests, &responses, interrupt, i]() {
+        const MPModelRequest& model_request = model_requests[i];
+        MPSolutionResponse* const response = &responses[i];
+        if (interrupt != nullptr && interrupt->load()) {
+          response->set_status(MPSOLVER_CANCELLED_BY_USER);
+          response->set_status_str(
+              "Solve not started, because the user set the atomic<bool> in "
+              "MPSolver::SolveBatchWithProto() to true before solving could "
+              "start.");
+          return;
+        }
+        SolveWithProto(
+            model_request, response,
+            SolverTypeSupportsInterruption(model_request.solver_type())
+                ? interrupt
+                : nullptr);
+      });
+    }
+    // We block until all the requests are solved when thread_pool goes out of
+    // scope.
+  }
+  return responses;
+}
+
 void MPSolver::ExportModelToProto(MPModelProto* output_model) const {
   DCHECK(output_model != nullptr);
   output_model->Clear();
@@ -1443,6 +1489,8 @@ void MPSolver::MakeVarArray(int nb, double lb, double ub, bool integer,
                             std::vector<MPVariable*>* vars) {
   DCHECK_GE(nb, 0);
   if (nb <= 0) return;
+  ReserveVariables(NumVariables() + nb);
+  vars->reserve(vars->size() + nb);
   const int num_digits = NumDigits(nb);
   for (int i = 0; i < nb; ++i) {
     if (name.empty()) {
@@ -1472,6 +1520,22 @@ void MPSolver::MakeBoolVarArray(int nb, const std::string& name,
   MakeVarArray(nb, 0.0, 1.0, true, name, vars);
 }
 
+void MPSolver::ReserveVariables(int num_variables) {
+  variables_.reserve(num_variables);
+  variable_is_extracted_.reserve(num_variables);
+  if (variable_name_to_index_) {
+    variable_name_to_index_->reserve(num_variables);
+  }
+}
+
+void MPSolver::ReserveConstraints(int num_constraints) {
+  constraints_.reserve(num_constraints);
+  constraint_is_extracted_.reserve(num_constraints);
+  if (constraint_name_to_index_) {
+    constraint_name_to_index_->reserve(num_constraints);
+  }
+}
+
 MPConstraint* MPSolver::MakeRowConstraint(double lb, double ub) {
   return MakeRowConstraint(lb, ub, "");
 }
@@ -159,6 +159,7 @@
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include "absl/types/optional.h"
+#include "absl/types/span.h"
 #include "ortools/base/logging.h"
 #include "ortools/linear_solver/linear_expr.h"
 #include "ortools/linear_solver/linear_solver.pb.h"
@@ -390,6 +391,18 @@ class MPSolver {
   void MakeBoolVarArray(int nb, const std::string& name,
                         std::vector<MPVariable*>* vars);
 
+  /**
+   * Reserves memory for `num_variables` variables in total, to avoid repeated
+   * reallocations when building large models. This does not change the model.
+   */
+  void ReserveVariables(int num_variables);
+
+  /**
+   * Reserves memory for `num_constraints` constraints in total, see
+   * ReserveVariables().
+   */
+  void ReserveConstraints(int num_constraints);
+
   /// Returns the number of constraints.
   int NumConstraints() const { return constraints_.size(); }
 
@@ -584,6 +597,20 @@ class MPSolver {
                              // solver may set it to true itself, in some cases.
                              std::atomic<bool>* interrupt = nullptr);
 
+  /**
+   * Solves independent requests with SolveWithProto() on a pool of
+   * num_workers threads, and returns the responses in the order of the
+   * requests. The time limit and the solver specific parameters (e.g. the
+   * number of threads) of each request are honored as usual.
+   *
+   * If interrupt is non-null, setting it to true interrupts the requests
+   * whose solver SolverTypeSupportsInterruption(), and the requests that have
+   * not started yet are returned with the MPSOLVER_CANCELLED_BY_USER status.
+   */
+  static std::vector<MPSolutionResponse> SolveBatchWithProto(
+      absl::Span<const MPModelRequest> model_requests, int num_workers,
+      std::atomic<bool>* interrupt = nullptr);
+
   static bool SolverTypeSupportsInterruption(
       const MPModelRequest::SolverType solver) {
     // Interruption requires that MPSolver::InterruptSolve is supported for the
@@ -1282,6 +1309,20 @@ class MPConstraint {
    */
   void SetCoefficient(const MPVariable* var, double coeff);
 
+  /**
+   * Sets the coefficients of `vars[i]` to `coeffs[i]`, as repeated calls to
+   * SetCoefficient() would, after reserving room for all of them in terms().
+   * `vars` and `coeffs` must have the same size.
+   */
+  void SetCoefficients(absl::Span<const MPVariable* const> vars,
+                       absl::Span<const double> coeffs);
+
+  /**
+   * Reserves room for `num_terms` terms in total in terms(), to avoid
+   * repeated rehashing when setting many coefficients one by one.
+   */
+  void ReserveTerms(int num_terms) { coefficients_.reserve(num_terms); }
+
   /**
    * Gets the coefficient of a given variable on the constraint (which is 0 if
    * the variable does not appear in the constraint).
@@ -15,6 +15,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <limits>
 #include <memory>
 #include <string>
@@ -28,6 +29,7 @@
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
+#include "absl/strings/string_view.h"
 #include "ortools/base/commandlineflags.h"
 #include "ortools/base/logging.h"
 #include "ortools/base/map_util.h"
@@ -50,11 +52,11 @@ class LineBreaker {
   // - Lines are split so that their length doesn't exceed the max length;
   //   unless a single string given to Append() exceeds that length (in which
   //   case it will be put alone on a single unsplit line).
-  void Append(const std::string& s);
+  void Append(absl::string_view s);
 
   // Returns true if string s will fit on the current line without adding a
   // carriage return.
-  bool WillFit(const std::string& s) {
+  bool WillFit(absl::string_view s) {
     return line_size_ + static_cast<int>(s.size()) < max_line_size_;
   }
 
@@ -62,7 +64,7 @@ class LineBreaker {
   // lines.
   void Consume(int size) { line_size_ += size; }
 
-  std::string GetOutput() const { return output_; }
+  const std::string& GetOutput() const { return output_; }
 
  private:
   int max_line_size_;
@@ -70,7 +72,7 @@ class LineBreaker {
   std::string output_;
 };
 
-void LineBreaker::Append(const std::string& s) {
+void LineBreaker::Append(absl::string_view s) {
   line_size_ += s.size();
   if (line_size_ > max_line_size_) {
     line_size_ = s.size();
@@ -174,10 +176,11 @@ class MPModelProtoExporter {
 
   // When 'integrality' is true, appends columns corresponding to integer
   // variables. Appends the columns for non-integer variables otherwise.
-  // The sparse matrix must be passed as a vector of columns ('transpose').
+  // The sparse matrix must be passed by columns ('transpose'), the entries of
+  // column i being transpose_entries[transpose_starts[i]..starts[i + 1]).
   void AppendMpsColumns(
-      bool integrality,
-      const std::vector<std::vector<std::pair<int, double>>>& transpose,
+      bool integrality, const std::vector<int64_t>& transpose_starts,
+      const std::vector<std::pair<int, double>>& transpose_entries,
       std::string* output);
 
   // Appends a line describing the bound of a variablenew-line if two columns
@@ -385,10 +388,10 @@ bool MPModelProtoExporter::AppendConstraint(const MPConstraintProto& ct_proto,
                                             LineBreaker& line_breaker,
                                             std::vector<bool>& show_variable,
                                             std::string* output) {
+  std::string term;
   for (int i = 0; i < ct_proto.var_index_size(); ++i) {
     const int var_index = ct_proto.var_index(i);
     const double coeff = ct_proto.coefficient(i);
-    std::string term;
     if (!WriteLpTerm(var_index, coeff, &term)) {
       return false;
     }
@@ -439,8 +442,10 @@ bool MPModelProtoExporter::WriteLpTerm(int var_index, double coefficient,
     return false;
   }
   if (coefficient != 0.0) {
-    *output = absl::StrCat(DoubleToStringWithForcedSign(coefficient), " ",
-                           exported_variable_names_[var_index], " ");
+    // Appending to the cleared string reuses its buffer, this is called for
+    // each term of the model.
+    absl::StrAppend(output, coefficient < 0 ? "" : "+", coefficient, " ",
+                    exported_variable_names_[var_index], " ");
   }
   return true;
 }
@@ -556,9 +561,9 @@ bool MPModelProtoExporter::ExportModelAsLpFormat(
   }
   std::vector<bool> show_variable(proto_.variable_size(),
                                   options.show_unused_variables);
+  std::string term;
   for (int var_index = 0; var_index < proto_.variable_size(); ++var_index) {
     const double coeff = proto_.variable(var_index).objective_coefficient();
-    std::string term;
     if (!WriteLpTerm(var_index, coeff, &term)) {
       return false;
     }
@@ -714,8 +719,8 @@ void MPModelProtoExporter::AppendNewLineIfTwoColumns(std::string* output) {
 }
 
 void MPModelProtoExporter::AppendMpsColumns(
-    bool integrality,
-    const std::vector<std::vector<std::pair<int, double>>>& transpose,
+    bool integrality, const std::vector<int64_t>& transpose_starts,
+    const std::vector<std::pair<int, double>>& transpose_entries,
     std::string* output) {
   current_mps_column_ = 0;
   for (int var_index = 0; var_index < proto_.variable_size(); ++var_index) {
@@ -727,11 +732,11 @@ void MPModelProtoExporter::AppendMpsColumns(
       AppendMpsTermWithContext(var_name, "COST",
                                var_proto.objective_coefficient(), output);
     }
-    for (const std::pair<int, double>& cst_index_and_coeff :
-         transpose[var_index]) {
+    for (int64_t k = transpose_starts[var_index];
+         k < transpose_starts[var_index + 1]; ++k) {
       const std::string& cst_name =
-          exported_constraint_names_[cst_index_and_coeff.first];
-      AppendMpsTermWithContext(var_name, cst_name, cst_index_and_coeff.second,
+          exported_constraint_names_[transpose_entries[k].first];
+      AppendMpsTermWithContext(var_name, cst_name, transpose_entries[k].second,
                                output);
     }
     AppendNewLineIfTwoColumns(output);
@@ -763,34 +768,44 @@ bool MPModelProtoExporter::ExportModelAsMpsFormat(
     absl::StrAppendFormat(output, "OBJSENSE\n  MAX\n");
   }
 
+  // All the sections are written directly in `output`, MPS files of large
+  // models being several gigabytes. The header of a section is removed if the
+  // section turns out to be empty.
+  const auto begin_section = [output](absl::string_view header) {
+    absl::StrAppend(output, header);
+    return output->size();
+  };
+  const auto end_section = [output](absl::string_view header,
+                                    size_t section_start) {
+    if (output->size() == section_start) {
+      output->resize(section_start - header.size());
+    }
+  };
+
   // ROWS section.
   current_mps_column_ = 0;
-  std::string rows_section;
-  AppendMpsLineHeaderWithNewLine("N", "COST", &rows_section);
+  absl::StrAppend(output, "ROWS\n");
+  AppendMpsLineHeaderWithNewLine("N", "COST", output);
   for (int cst_index = 0; cst_index < proto_.constraint_size(); ++cst_index) {
     const MPConstraintProto& ct_proto = proto_.constraint(cst_index);
     const double lb = ct_proto.lower_bound();
     const double ub = ct_proto.upper_bound();
     const std::string& cst_name = exported_constraint_names_[cst_index];
     if (lb == -kInfinity && ub == kInfinity) {
-      AppendMpsLineHeaderWithNewLine("N", cst_name, &rows_section);
+      AppendMpsLineHeaderWithNewLine("N", cst_name, output);
     } else if (lb == ub) {
-      AppendMpsLineHeaderWithNewLine("E", cst_name, &rows_section);
+      AppendMpsLineHeaderWithNewLine("E", cst_name, output);
     } else if (lb == -kInfinity) {
-      AppendMpsLineHeaderWithNewLine("L", cst_name, &rows_section);
+      AppendMpsLineHeaderWithNewLine("L", cst_name, output);
     } else {
-      AppendMpsLineHeaderWithNewLine("G", cst_name, &rows_section);
+      AppendMpsLineHeaderWithNewLine("G", cst_name, output);
     }
   }
-  if (!rows_section.empty()) {
-    absl::StrAppend(output, "ROWS\n", rows_section);
-  }
 
-  // As the information regarding a column needs to be contiguous, we create
-  // a vector associating a variable index to a vector containing the indices
-  // of the constraints where this variable appears.
-  std::vector<std::vector<std::pair<int, double>>> transpose(
-      proto_.variable_size());
+  // As the information regarding a column needs to be contiguous, we build
+  // the transpose of the constraint matrix, in compressed form to avoid one
+  // allocation per variable.
+  std::vector<int64_t> transpose_starts(proto_.variable_size() + 1, 0);
   for (int cst_index = 0; cst_index < proto_.constraint_size(); ++cst_index) {
     const MPConstraintProto& ct_proto = proto_.constraint(cst_index);
     for (int k = 0; k < ct_proto.var_index_size(); ++k) {
@@ -800,38 +815,65 @@ bool MPModelProtoExporter::ExportModelAsMpsFormat(
                     << " is " << var_index << ", which is out of bounds.";
         return false;
       }
-      const double coeff = ct_proto.coefficient(k);
-      if (coeff != 0.0) {
-        transpose[var_index].push_back(
-            std::pair<int, double>(cst_index, coeff));
+      if (ct_proto.coefficient(k) != 0.0) ++transpose_starts[var_index + 1];
+    }
+  }
+  for (int var_index = 0; var_index < proto_.variable_size(); ++var_index) {
+    transpose_starts[var_index + 1] += transpose_starts[var_index];
+  }
+  std::vector<std::pair<int, double>> transpose_entries(
+      transpose_starts.back());
+  {
+    std::vector<int64_t> next_entry(transpose_starts.begin(),
+                                    transpose_starts.end() - 1);
+    for (int cst_index = 0; cst_index < proto_.constraint_size();
+         ++cst_index) {
+      const MPConstraintProto& ct_proto = proto_.constraint(cst_index);
+      for (int k = 0; k < ct_proto.var_index_size(); ++k) {
+        const double coeff = ct_proto.coefficient(k);
+        if (coeff != 0.0) {
+          transpose_entries[next_entry[ct_proto.var_index(k)]++] = {cst_index,
+                                                                    coeff};
+        }
       }
     }
   }
 
   // COLUMNS section.
-  std::string columns_section;
-  AppendMpsColumns(/*integrality=*/true, transpose, &columns_section);
-  if (!columns_section.empty()) {
+  {
+    constexpr absl::string_view kColumnsHeader = "COLUMNS\n";
+    const size_t columns_start = begin_section(kColumnsHeader);
     constexpr const char kIntMarkerFormat[] = "  %-10s%-36s%-8s\n";
-    columns_section =
-        absl::StrFormat(kIntMarkerFormat, "INTSTART", "'MARKER'", "'INTORG'") +
-        columns_section;
-    absl::StrAppendFormat(&columns_section, kIntMarkerFormat, "INTEND",
-                          "'MARKER'", "'INTEND'");
-  }
-  AppendMpsColumns(/*integrality=*/false, transpose, &columns_section);
-  if (!columns_section.empty()) {
-    absl::StrAppend(output, "COLUMNS\n", columns_section);
+    const size_t int_marker_start = output->size();
+    absl::StrAppendFormat(output, kIntMarkerFormat, "INTSTART", "'MARKER'",
+                          "'INTORG'");
+    const size_t int_columns_start = output->size();
+    AppendMpsColumns(/*integrality=*/true, transpose_starts, transpose_entries,
+                     output);
+    if (output->size() == int_columns_start) {
+      output->resize(int_marker_start);
+    } else {
+      absl::StrAppendFormat(output, kIntMarkerFormat, "INTEND", "'MARKER'",
+                            "'INTEND'");
+    }
+    AppendMpsColumns(/*integrality=*/false, transpose_starts,
+                     transpose_entries, output);
+    end_section(kColumnsHeader, columns_start);
   }
+  transpose_starts.clear();
+  transpose_starts.shrink_to_fit();
+  transpose_entries.clear();
+  transpose_entries.shrink_to_fit();
 
   // RHS (right-hand-side) section.
   current_mps_column_ = 0;
-  std::string rhs_section;
+  constexpr absl::string_view kRhsHeader = "RHS\n";
+  const size_t rhs_start = begin_section(kRhsHeader);
   // Follow Gurobi's MPS format for objective offsets.
   // See https://www.gurobi.com/documentation/9.1/refman/mps_format.html
   if (proto_.objective_offset() != 0) {
     AppendMpsTermWithContext("RHS", "COST", -proto_.objective_offset(),
-                             &rhs_section);
+                             output);
   }
   for (int cst_index = 0; cst_index < proto_.constraint_size(); ++cst_index) {
     const MPConstraintProto& ct_proto = proto_.constraint(cst_index);
@@ -839,35 +881,33 @@ bool MPModelProtoExporter::ExportModelAsMpsFormat(
     const double ub = ct_proto.upper_bound();
     const std::string& cst_name = exported_constraint_names_[cst_index];
     if (lb != -kInfinity) {
-      AppendMpsTermWithContext("RHS", cst_name, lb, &rhs_section);
+      AppendMpsTermWithContext("RHS", cst_name, lb, output);
     } else if (ub != +kInfinity) {
-      AppendMpsTermWithContext("RHS", cst_name, ub, &rhs_section);
+      AppendMpsTermWithContext("RHS", cst_name, ub, output);
     }
   }
-  AppendNewLineIfTwoColumns(&rhs_section);
-  if (!rhs_section.empty()) {
-    absl::StrAppend(output, "RHS\n", rhs_section);
-  }
+  AppendNewLineIfTwoColumns(output);
+  end_section(kRhsHeader, rhs_start);
 
   // RANGES section.
   current_mps_column_ = 0;
-  std::string ranges_section;
+  constexpr absl::string_view kRangesHeader = "RANGES\n";
+  const size_t ranges_start = begin_section(kRangesHeader);
   for (int cst_index = 0; cst_index < proto_.constraint_size(); ++cst_index) {
     const MPConstraintProto& ct_proto = proto_.constraint(cst_index);
     const double range = fabs(ct_proto.upper_bound() - ct_proto.lower_bound());
     if (range != 0.0 && range != +kInfinity) {
       const std::string& cst_name = exported_constraint_names_[cst_index];
-      AppendMpsTermWithContext("RANGE", cst_name, range, &ranges_section);
+      AppendMpsTermWithContext("RANGE", cst_name, range, output);
     }
   }
-  AppendNewLineIfTwoColumns(&ranges_section);
-  if (!ranges_section.empty()) {
-    absl::StrAppend(output, "RANGES\n", ranges_section);
-  }
+  AppendNewLineIfTwoColumns(output);
+  end_section(kRangesHeader, ranges_start);
 
   // BOUNDS section.
   current_mps_column_ = 0;
-  std::string bounds_section;
+  constexpr absl::string_view kBoundsHeader = "BOUNDS\n";
+  const size_t bounds_start = begin_section(kBoundsHeader);
   for (int var_index = 0; var_index < proto_.variable_size(); ++var_index) {
     const MPVariableProto& var_proto = proto_.variable(var_index);
     const double lb = var_proto.lower_bound();
@@ -875,55 +915,53 @@ bool MPModelProtoExporter::ExportModelAsMpsFormat(
     const std::string& var_name = exported_variable_names_[var_index];
 
     if (lb == -kInfinity && ub == +kInfinity) {
-      AppendMpsLineHeader("FR", "BOUND", &bounds_section);
-      absl::StrAppendFormat(&bounds_section, "  %s\n", var_name);
+      AppendMpsLineHeader("FR", "BOUND", output);
+      absl::StrAppendFormat(output, "  %s\n", var_name);
       continue;
     }
 
     if (var_proto.is_integer()) {
       if (IsBoolean(var_proto)) {
-        AppendMpsLineHeader("BV", "BOUND", &bounds_section);
-        absl::StrAppendFormat(&bounds_section, "  %s\n", var_name);
+        AppendMpsLineHeader("BV", "BOUND", output);
+        absl::StrAppendFormat(output, "  %s\n", var_name);
       } else {
         if (lb == ub) {
-          AppendMpsBound("FX", var_name, lb, &bounds_section);
+          AppendMpsBound("FX", var_name, lb, output);
         } else {
           if (lb == -kInfinity) {
-            AppendMpsLineHeader("MI", "BOUND", &bounds_section);
-            absl::StrAppendFormat(&bounds_section, "  %s\n", var_name);
+            AppendMpsLineHeader("MI", "BOUND", output);
+            absl::StrAppendFormat(output, "  %s\n", var_name);
           } else if (lb != 0.0 || ub == kInfinity) {
             // "LI" can be skipped if it's 0.
             // There is one exception to that rule: if UI=+inf, we can't skip
             // LI=0 or the variable will be parsed as binary.
-            AppendMpsBound("LI", var_name, lb, &bounds_section);
+            AppendMpsBound("LI", var_name, lb, output);
           }
           if (ub != kInfinity) {
-            AppendMpsBound("UI", var_name, ub, &bounds_section);
+            AppendMpsBound("UI", var_name, ub, output);
           }
         }
       }
     } else {
       if (lb == ub) {
-        AppendMpsBound("FX", var_name, lb, &bounds_section);
+        AppendMpsBound("FX", var_name, lb, output);
       } else {
         if (lb == -kInfinity) {
-          AppendMpsLineHeader("MI", "BOUND", &bounds_section);
-          absl::StrAppendFormat(&bounds_section, "  %s\n", var_name);
+          AppendMpsLineHeader("MI", "BOUND", output);
+          absl::StrAppendFormat(output, "  %s\n", var_name);
         } else if (lb != 0.0) {
-          AppendMpsBound("LO", var_name, lb, &bounds_section);
+          AppendMpsBound("LO", var_name, lb, output);
         }
         if (lb == 0.0 && ub == +kInfinity) {
-          AppendMpsLineHeader("PL", "BOUND", &bounds_section);
-          absl::StrAppendFormat(&bounds_section, "  %s\n", var_name);
+          AppendMpsLineHeader("PL", "BOUND", output);
+          absl::StrAppendFormat(output, "  %s\n", var_name);
         } else if (ub != +kInfinity) {
-          AppendMpsBound("UP", var_name, ub, &bounds_section);
+          AppendMpsBound("UP", var_name, ub, output);
         }
       }
     }
   }
-  if (!bounds_section.empty()) {
-    absl::StrAppend(output, "BOUNDS\n", bounds_section);
-  }
+  end_section(kBoundsHeader, bounds_start);
 
   absl::StrAppend(output, "ENDATA\n");
   return true;
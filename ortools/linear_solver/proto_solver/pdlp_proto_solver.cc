@@ -59,7 +59,7 @@ absl::StatusOr<MPSolutionResponse> PdlpSolveProto(
         request.solver_time_limit_seconds());
   }
 
-  const absl::optional<LazyMutableCopy<MPModelProto>> optional_model =
+  absl::optional<LazyMutableCopy<MPModelProto>> optional_model =
       ExtractValidMPModelOrPopulateResponseStatus(request, &error_response);
   if (!optional_model) {
     LOG_IF(WARNING, request.enable_internal_solver_output())
@@ -73,6 +73,10 @@ absl::StatusOr<MPSolutionResponse> PdlpSolveProto(
   ASSIGN_OR_RETURN(
       pdlp::QuadraticProgram qp,
       pdlp::QpFromMpModelProto(optional_model->get(), relax_integer_variables));
+  // The model is not needed anymore. This frees it if it was copied, e.g.
+  // because of a model delta, so that it does not add to the peak memory
+  // during the solve.
+  optional_model.reset();
   const double objective_scaling_factor = qp.objective_scaling_factor;
 
   pdlp::SolverResult pdhg_result =
@@ -13,6 +13,7 @@
 
 #include "ortools/linear_solver/proto_solver/sat_solver_utils.h"
 
+#include <cmath>
 #include <memory>
 #include <string>
 #include <utility>
@@ -21,6 +22,7 @@
 #include "absl/memory/memory.h"
 #include "ortools/glop/parameters.pb.h"
 #include "ortools/glop/preprocessor.h"
+#include "ortools/linear_solver/linear_solver.pb.h"
 #include "ortools/lp_data/proto_utils.h"
 
 namespace operations_research {
@@ -110,4 +112,45 @@ glop::ProblemStatus ApplyMipPresolveSteps(
 
 #undef ADD_LP_PREPROCESSOR
 
+int ApplyReducedCostFixing(const MPSolutionResponse& lp_response,
+                           double objective_cutoff, MPModelProto* model) {
+  CHECK(model != nullptr);
+  const int num_vars = model->variable_size();
+  if (lp_response.status() != MPSOLVER_OPTIMAL ||
+      lp_response.reduced_cost_size() != num_vars) {
+    return 0;
+  }
+
+  // We work on the minimization form of the problem.
+  const double sign = model->maximize() ? -1.0 : 1.0;
+  const double gap = sign * (objective_cutoff - lp_response.objective_value());
+  if (!std::isfinite(gap) || gap < 0.0) return 0;
+
+  // The new bounds are relaxed by this amount before rounding, to be robust to
+  // the numerical errors in the LP solution.
+  constexpr double kTolerance = 1e-6;
+  int num_tightened_bounds = 0;
+  for (int j = 0; j < num_vars; ++j) {
+    MPVariableProto* const var = model->mutable_variable(j);
+    if (!var->is_integer()) continue;
+    const double reduced_cost = sign * lp_response.reduced_cost(j);
+    if (reduced_cost > 0.0 && std::isfinite(var->lower_bound())) {
+      const double new_ub =
+          std::floor(var->lower_bound() + gap / reduced_cost + kTolerance);
+      if (new_ub < var->upper_bound() && new_ub >= var->lower_bound()) {
+        var->set_upper_bound(new_ub);
+        ++num_tightened_bounds;
+      }
+    } else if (reduced_cost < 0.0 && std::isfinite(var->upper_bound())) {
+      const double new_lb =
+          std::ceil(var->upper_bound() + gap / reduced_cost - kTolerance);
+      if (new_lb > var->lower_bound() && new_lb <= var->upper_bound()) {
+        var->set_lower_bound(new_lb);
+        ++num_tightened_bounds;
+      }
+    }
+  }
+  return num_tightened_bounds;
+}
+
 }  // namespace operations_research
@@ -39,5 +39,22 @@ glop::ProblemStatus ApplyMipPresolveSteps(
     std::vector<std::unique_ptr<glop::Preprocessor>>* for_postsolve,
     SolverLogger* logger);
 
+// Applies reduced-cost fixing to the integer variables of `model`, and returns
+// the number of bounds that were tightened. This can be used to shrink a MIP
+// with the LP relaxation solved beforehand (e.g. with glop) before handing it
+// to any backend.
+//
+// `lp_response` must be an optimal solution, with its reduced costs, of the LP
+// relaxation of `model` with its current bounds. `objective_cutoff` is the
+// objective value of a known solution, or more generally a value that the
+// caller is not interested to improve upon. Then for a minimization problem,
+// any solution with an objective smaller or equal to `objective_cutoff`
+// satisfies x_j <= lb_j + (objective_cutoff - lp_objective) / d_j for each
+// variable j with a positive reduced cost d_j, and symmetrically for negative
+// reduced costs. Nothing is done if `lp_response` is not OPTIMAL, does not
+// contain the reduced costs, or if the cutoff is better than the LP bound.
+int ApplyReducedCostFixing(const MPSolutionResponse& lp_response,
+                           double objective_cutoff, MPModelProto* model);
+
 }  // namespace operations_research
 #endif  // OR_TOOLS_LINEAR_SOLVER_PROTO_SOLVER_SAT_SOLVER_UTILS_H_
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <complex>
+#include <cstdint>
 #include <cstdlib>
 #include <limits>
 #include <optional>
@@ -31,10 +32,12 @@
 #include "absl/log/check.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 #include "ortools/base/logging.h"
 #include "ortools/linear_solver/linear_solver.pb.h"
 #include "ortools/linear_solver/model_exporter.h"
 #include "pybind11/eigen.h"
+#include "pybind11/numpy.h"
 #include "pybind11/pybind11.h"
 #include "pybind11/pytypes.h"
 #include "pybind11/stl.h"
@@ -100,6 +103,7 @@ void BuildModelFromSparseData(
                      " in constraint_matrix. Expected: ", num_constraints));
   }
 
+  model_proto->mutable_variable()->Reserve(num_variables);
   for (int i = 0; i < num_variables; ++i) {
     MPVariableProto* variable = model_proto->add_variable();
     variable->set_lower_bound(variable_lower_bounds[i]);
@@ -107,10 +111,15 @@ void BuildModelFromSparseData(
     variable->set_objective_coefficient(objective_coefficients[i]);
   }
 
+  model_proto->mutable_constraint()->Reserve(num_constraints);
   for (int row = 0; row < num_constraints; ++row) {
     MPConstraintProto* constraint = model_proto->add_constraint();
     constraint->set_lower_bound(constraint_lower_bounds[row]);
     constraint->set_upper_bound(constraint_upper_bounds[row]);
+    const int row_size = constraint_matrix.outerIndexPtr()[row + 1] -
+                         constraint_matrix.outerIndexPtr()[row];
+    constraint->mutable_coefficient()->Reserve(row_size);
+    constraint->mutable_var_index()->Reserve(row_size);
     for (SparseMatrix<double, Eigen::RowMajor>::InnerIterator it(
              constraint_matrix, row);
          it; ++it) {
@@ -120,6 +129,72 @@ void BuildModelFromSparseData(
   }
 }
 
+// Appends one linear constraint per row of the CSR matrix given by
+// (row_starts, var_indices, coefficients) to the model, and returns the index
+// of the first one. The terms are copied as is, except that zero coefficients
+// are skipped, like in ModelBuilderHelper::AddConstraintTerm().
+int AddLinearConstraintsFromCsr(absl::Span<const double> lower_bounds,
+                                absl::Span<const double> upper_bounds,
+                                absl::Span<const int64_t> row_starts,
+                                absl::Span<const int> var_indices,
+                                absl::Span<const double> coefficients,
+                                MPModelProto* model_proto) {
+  const int num_rows = lower_bounds.size();
+  const int num_variables = model_proto->variable_size();
+  if (upper_bounds.size() != num_rows) {
+    throw std::invalid_argument(
+        absl::StrCat("Invalid size ", upper_bounds.size(),
+                     " for upper_bounds. Expected: ", num_rows));
+  }
+  if (row_starts.size() != num_rows + 1) {
+    throw std::invalid_argument(
+        absl::StrCat("Invalid size ", row_starts.size(),
+                     " for row_starts. Expected: ", num_rows + 1));
+  }
+  if (coefficients.size() != var_indices.size()) {
+    throw std::invalid_argument(
+        absl::StrCat("Invalid size ", coefficients.size(),
+                     " for coefficients. Expected: ", var_indices.size()));
+  }
+  if (row_starts[0] != 0 ||
+      row_starts[num_rows] != static_cast<int64_t>(var_indices.size())) {
+    throw std::invalid_argument(
+        absl::StrCat("row_starts must start at 0 and end at ",
+                     var_indices.size(), " (the number of terms)"));
+  }
+  for (int row = 0; row < num_rows; ++row) {
+    if (row_starts[row] > row_starts[row + 1]) {
+      throw std::invalid_argument(
+          absl::StrCat("row_starts is decreasing at row ", row));
+    }
+  }
+  for (const int var : var_indices) {
+    if (var < 0 || var >= num_variables) {
+      throw std::invalid_argument(absl::StrCat(
+          "Invalid variable index ", var, ". Expected: [0, ", num_variables,
+          ")"));
+    }
+  }
+
+  const int first_index = model_proto->constraint_size();
+  model_proto->mutable_constraint()->Reserve(first_index + num_rows);
+  for (int row = 0; row < num_rows; ++row) {
+    MPConstraintProto* constraint = model_proto->add_constraint();
+    constraint->set_lower_bound(lower_bounds[row]);
+    constraint->set_upper_bound(upper_bounds[row]);
+    const int64_t start = row_starts[row];
+    const int64_t end = row_starts[row + 1];
+    constraint->mutable_var_index()->Reserve(end - start);
+    constraint->mutable_coefficient()->Reserve(end - start);
+    for (int64_t i = start; i < end; ++i) {
+      if (coefficients[i] == 0.0) continue;
+      constraint->add_var_index(var_indices[i]);
+      constraint->add_coefficient(coefficients[i]);
+    }
+  }
+  return first_index;
+}
+
 std::vector<std::pair<int, double>> SortedGroupedTerms(
     absl::Span<const int> indices, absl::Span<const double> coefficients) {
   CHECK_EQ(indices.size(), coefficients.size());
@@ -271,6 +346,34 @@ PYBIND11_MODULE(model_builder_helper, m) {
              }
              return result;
            })
+      .def(
+          "add_linear_constraints",
+          [](ModelBuilderHelper* helper,
+             py::array_t<double, py::array::c_style | py::array::forcecast> lbs,
+             py::array_t<double, py::array::c_style | py::array::forcecast> ubs,
+             py::array_t<int64_t, py::array::c_style | py::array::forcecast>
+                 row_starts,
+             py::array_t<int, py::array::c_style | py::array::forcecast>
+                 var_indices,
+             py::array_t<double, py::array::c_style | py::array::forcecast>
+                 coefficients) {
+            // The input buffers are read in place, without going through
+            // Python objects.
+            const int first_index = AddLinearConstraintsFromCsr(
+                absl::MakeConstSpan(lbs.data(), lbs.size()),
+                absl::MakeConstSpan(ubs.data(), ubs.size()),
+                absl::MakeConstSpan(row_starts.data(), row_starts.size()),
+                absl::MakeConstSpan(var_indices.data(), var_indices.size()),
+                absl::MakeConstSpan(coefficients.data(), coefficients.size()),
+                helper->mutable_model());
+            const int num_rows = lbs.size();
+            py::array_t<int> result(num_rows);
+            int* const ptr = result.mutable_data();
+            for (int i = 0; i < num_rows; ++i) ptr[i] = first_index + i;
+            return result;
+          },
+          arg("lower_bounds"), arg("upper_bounds"), arg("row_starts"),
+          arg("var_indices"), arg("coefficients"))
       .def("set_var_lower_bound", &ModelBuilderHelper::SetVarLowerBound,
            arg("var_index"), arg("lb"))
       .def("set_var_upper_bound", &ModelBuilderHelper::SetVarUpperBound,
@@ -510,6 +613,29 @@ PYBIND11_MODULE(model_builder_helper, m) {
              }
              return constant;
            })
+      .def("variable_values_at",
+           [](const ModelSolverHelper& helper,
+              py::array_t<int, py::array::c_style | py::array::forcecast>
+                  indices) {
+             if (!helper.has_response()) {
+               throw std::logic_error(
+                   "Accessing a solution value when none has been found.");
+             }
+             const MPSolutionResponse& response = helper.response();
+             py::array_t<double> result(indices.request().shape);
+             const int* const index_ptr = indices.data();
+             double* const ptr = result.mutable_data();
+             for (int i = 0; i < indices.size(); ++i) {
+               const int index = index_ptr[i];
+               if (index < 0 || index >= response.variable_value_size()) {
+                 throw std::out_of_range(
+                     absl::StrCat("Invalid variable index ", index));
+               }
+               ptr[i] = response.variable_value(index);
+             }
+             return result;
+           },
+           arg("var_indices"))
       .def("reduced_costs",
            [](const ModelSolverHelper& helper) {
              if (!helper.has_response()) {
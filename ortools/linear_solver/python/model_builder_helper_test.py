@@ -208,6 +208,51 @@ class PywrapModelBuilderHelperTest(absltest.TestCase):
         model.set_constraint_coefficient(0, var_index2, 7.0)
         self.assertEqual([1.0, 3.0, 7.0, 6.0], model.constraint_coefficients(0))
 
+    def test_add_linear_constraints(self):
+        model = model_builder_helper.ModelBuilderHelper()
+        model.add_var_array([3], 0.0, 10.0, False, "x")
+        model.add_linear_constraint()
+        indices = model.add_linear_constraints(
+            np.array([-1.0, 2.0]),
+            np.array([1.0, np.inf]),
+            np.array([0, 2, 5]),
+            np.array([0, 2, 0, 1, 2]),
+            np.array([1.0, -1.0, 2.0, 0.0, 3.0]),
+        )
+        np.testing.assert_array_equal([1, 2], indices)
+        self.assertEqual(3, model.num_constraints())
+        self.assertEqual(-1.0, model.constraint_lower_bound(1))
+        self.assertEqual(np.inf, model.constraint_upper_bound(2))
+        self.assertEqual([0, 2], model.constraint_var_indices(1))
+        self.assertEqual([1.0, -1.0], model.constraint_coefficients(1))
+        # Zero coefficients are skipped.
+        self.assertEqual([0, 2], model.constraint_var_indices(2))
+        self.assertEqual([2.0, 3.0], model.constraint_coefficients(2))
+
+        with self.assertRaises(ValueError):
+            model.add_linear_constraints(
+                np.array([0.0]),
+                np.array([1.0]),
+                np.array([0, 1]),
+                np.array([3]),
+                np.array([1.0]),
+            )
+
+    def test_variable_values_at(self):
+        model = model_builder_helper.ModelBuilderHelper()
+        model.add_var_array_with_bounds(
+            np.array([1.0, 2.0, 3.0]),
+            np.array([1.0, 2.0, 3.0]),
+            np.array([False, False, False]),
+            "x",
+        )
+        solver = model_builder_helper.ModelSolverHelper("glop")
+        solver.solve(model)
+        np.testing.assert_array_almost_equal(
+            [[3.0, 1.0], [2.0, 2.0]],
+            solver.variable_values_at(np.array([[2, 0], [1, 1]])),
+        )
+
 
 if __name__ == "__main__":
     absltest.main()
@@ -34,6 +34,7 @@ void LPDecomposer::Decompose(const LinearProgram* linear_problem) {
   absl::MutexLock mutex_lock(&mutex_);
   original_problem_ = linear_problem;
   clusters_.clear();
+  cluster_constraints_.clear();
 
   const SparseMatrix& transposed_matrix =
       original_problem_->GetTransposeSparseMatrix();
@@ -61,6 +62,22 @@ void LPDecomposer::Decompose(const LinearProgram* linear_problem) {
   for (int i = 0; i < num_classes; ++i) {
     std::sort(clusters_[i].begin(), clusters_[i].end());
   }
+
+  global_to_local_.assign(original_problem_->num_variables(), kInvalidCol);
+  for (const std::vector<ColIndex>& cluster : clusters_) {
+    for (int i = 0; i < cluster.size(); ++i) {
+      global_to_local_[cluster[i]] = ColIndex(i);
+    }
+  }
+
+  // All the variables of a constraint are in the same cluster.
+  cluster_constraints_.resize(num_classes);
+  for (ColIndex ct(0); ct < num_ct; ++ct) {
+    const SparseColumn& sparse_constraint = transposed_matrix.column(ct);
+    if (sparse_constraint.IsEmpty()) continue;
+    const int cluster = classes[sparse_constraint.GetFirstRow().value()];
+    cluster_constraints_[cluster].push_back(ColToRowIndex(ct));
+  }
 }
 
 int LPDecomposer::GetNumberOfProblems() const {
@@ -82,24 +99,16 @@ void LPDecomposer::ExtractLocalProblem(int problem_index, LinearProgram* lp) {
 
   absl::MutexLock mutex_lock(&mutex_);
   const std::vector<ColIndex>& cluster = clusters_[problem_index];
-  StrictITIVector<ColIndex, ColIndex> global_to_local(
-      original_problem_->num_variables(), kInvalidCol);
-  SparseBitset<RowIndex> constraints_to_use(
-      original_problem_->num_constraints());
   lp->SetMaximizationProblem(original_problem_->IsMaximizationProblem());
 
-  // Create variables and get all constraints of the cluster.
-  const SparseMatrix& original_matrix = original_problem_->GetSparseMatrix();
+  // Create the variables.
   const SparseMatrix& transposed_matrix =
       original_problem_->GetTransposeSparseMatrix();
   for (int i = 0; i < cluster.size(); ++i) {
     const ColIndex global_col = cluster[i];
     const ColIndex local_col = lp->CreateNewVariable();
     CHECK_EQ(local_col, ColIndex(i));
-    CHECK(global_to_local[global_col] == kInvalidCol ||
-          global_to_local[global_col] == local_col)
-        << "If the mapping is already assigned it has to be the same.";
-    global_to_local[global_col] = local_col;
+    DCHECK_EQ(global_to_local_[global_col], local_col);
 
     lp->SetVariableName(local_col,
                         original_problem_->GetVariableName(global_col));
@@ -110,14 +119,10 @@ void LPDecomposer::ExtractLocalProblem(int problem_index, LinearProgram* lp) {
         original_problem_->variable_upper_bounds()[global_col]);
     lp->SetObjectiveCoefficient(
         local_col, original_problem_->objective_coefficients()[global_col]);
-
-    for (const SparseColumn::Entry e : original_matrix.column(global_col)) {
-      constraints_to_use.Set(e.row());
-    }
   }
+
   // Create the constraints.
-  for (const RowIndex global_row :
-       constraints_to_use.PositionsSetAtLeastOnce()) {
+  for (const RowIndex global_row : cluster_constraints_[problem_index]) {
     const RowIndex local_row = lp->CreateNewConstraint();
     lp->SetConstraintName(local_row,
                           original_problem_->GetConstraintName(global_row));
@@ -128,7 +133,7 @@ void LPDecomposer::ExtractLocalProblem(int problem_index, LinearProgram* lp) {
     for (const SparseColumn::Entry e :
          transposed_matrix.column(RowToColIndex(global_row))) {
       const ColIndex global_col = RowToColIndex(e.row());
-      const ColIndex local_col = global_to_local[global_col];
+      const ColIndex local_col = global_to_local_[global_col];
       lp->SetCoefficient(local_row, local_col, e.coefficient());
     }
   }
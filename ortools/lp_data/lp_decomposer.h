@@ -69,7 +69,8 @@ class LPDecomposer {
 
   // Fills lp with the problem_index^th independent problem generated by
   // Decompose().
-  // Note that this method runs in O(num-entries-in-generated-problem).
+  // Note that this method runs in O(num-entries-in-generated-problem), and that
+  // the constraints keep their relative order from the original problem.
   void ExtractLocalProblem(int problem_index, LinearProgram* lp)
       ABSL_LOCKS_EXCLUDED(mutex_);
 
@@ -87,6 +88,13 @@ class LPDecomposer {
   const LinearProgram* original_problem_;
   std::vector<std::vector<ColIndex>> clusters_;
 
+  // For each cluster, its constraints in increasing order, and for each
+  // variable, its index in its cluster. These are computed once by
+  // Decompose() so that ExtractLocalProblem() does not need any work or memory
+  // proportional to the size of the original problem.
+  std::vector<std::vector<RowIndex>> cluster_constraints_;
+  StrictITIVector<ColIndex, ColIndex> global_to_local_;
+
   mutable absl::Mutex mutex_;
 };
 
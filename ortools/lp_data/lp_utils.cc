@@ -92,11 +92,25 @@ Fractional PreciseSquaredNorm(const DenseColumn& column) {
 }
 
 Fractional InfinityNorm(const DenseColumn& v) {
-  Fractional infinity_norm = 0.0;
-  for (RowIndex row(0); row < v.size(); ++row) {
-    infinity_norm = std::max(infinity_norm, fabs(v[row]));
-  }
-  return infinity_norm;
+  // We use 4 independent maxima to break the dependency chain between
+  // consecutive iterations. Unlike for a sum, this does not change the result.
+  const Fractional* const values = v.data();
+  const size_t size = v.size().value();
+  Fractional norm0 = 0.0;
+  Fractional norm1 = 0.0;
+  Fractional norm2 = 0.0;
+  Fractional norm3 = 0.0;
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    norm0 = std::max(norm0, fabs(values[i]));
+    norm1 = std::max(norm1, fabs(values[i + 1]));
+    norm2 = std::max(norm2, fabs(values[i + 2]));
+    norm3 = std::max(norm3, fabs(values[i + 3]));
+  }
+  for (; i < size; ++i) {
+    norm0 = std::max(norm0, fabs(values[i]));
+  }
+  return std::max(std::max(norm0, norm1), std::max(norm2, norm3));
 }
 
 template <typename SparseColumnLike>
@@ -124,8 +124,9 @@ void SparseMatrixScaler::Scale(GlopParameters::ScalingAlgorithm method) {
     const Fractional kVarianceThreshold(10.0);
     for (int iteration = 0; iteration < kScalingIterations; ++iteration) {
       const RowIndex num_rows_scaled = ScaleRowsGeometrically();
-      const ColIndex num_cols_scaled = ScaleColumnsGeometrically();
-      const Fractional variance = VarianceOfAbsoluteValueOfNonZeros();
+      Fractional variance;
+      const ColIndex num_cols_scaled =
+          ScaleColumnsGeometricallyAndComputeVariance(&variance);
       VLOG(1) << "Geometric scaling iteration " << iteration
               << ". Rows scaled = " << num_rows_scaled
               << ", columns scaled = " << num_cols_scaled << "\n";
@@ -241,8 +242,17 @@ RowIndex SparseMatrixScaler::ScaleRowsGeometrically() {
 }
 
 ColIndex SparseMatrixScaler::ScaleColumnsGeometrically() {
+  Fractional unused_variance;
+  return ScaleColumnsGeometricallyAndComputeVariance(&unused_variance);
+}
+
+ColIndex SparseMatrixScaler::ScaleColumnsGeometricallyAndComputeVariance(
+    Fractional* variance) {
   DCHECK(matrix_ != nullptr);
   ColIndex num_cols_scaled(0);
+  Fractional sigma_square(0.0);
+  Fractional sigma_abs(0.0);
+  double n = 0.0;
   const ColIndex num_cols = matrix_->num_cols();
   for (ColIndex col(0); col < num_cols; ++col) {
     Fractional max_in_col(0.0);
@@ -254,12 +264,23 @@ ColIndex SparseMatrixScaler::ScaleColumnsGeometrically() {
         min_in_col = std::min(min_in_col, magnitude);
       }
     }
-    if (max_in_col != 0.0) {
-      const Fractional factor(sqrt(ToDouble(max_in_col * min_in_col)));
-      ScaleMatrixColumn(col, factor);
-      num_cols_scaled++;
+    if (max_in_col == 0.0) continue;
+    const Fractional factor(sqrt(ToDouble(max_in_col * min_in_col)));
+    if (factor != 1.0) ScaleMatrixColumn(col, factor);
+    num_cols_scaled++;
+
+    // Same computation as in VarianceOfAbsoluteValueOfNonZeros(), but done
+    // while the column is still in cache.
+    for (const SparseColumn::Entry e : matrix_->column(col)) {
+      const Fractional magnitude = fabs(e.coefficient());
+      if (magnitude != 0.0) {
+        sigma_square += magnitude * magnitude;
+        sigma_abs += magnitude;
+        ++n;
+      }
     }
   }
+  *variance = n == 0.0 ? 0.0 : (sigma_square - sigma_abs * sigma_abs / n) / n;
   return num_cols_scaled;
 }
 
@@ -319,6 +340,9 @@ RowIndex SparseMatrixScaler::ScaleMatrixRows(const DenseColumn& factors) {
     }
   }
 
+  // Nothing to do if all the factors are one.
+  if (num_rows_scaled == 0) return num_rows_scaled;
+
   const ColIndex num_cols = matrix_->num_cols();
   for (ColIndex col(0); col < num_cols; ++col) {
     SparseColumn* const column = matrix_->mutable_column(col);
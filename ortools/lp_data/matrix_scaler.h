@@ -155,6 +155,11 @@ class SparseMatrixScaler {
   // Convert the matrix to be scaled into a linear program.
   void GenerateLinearProgram(LinearProgram*);
 
+  // Same as ScaleColumnsGeometrically() but also returns in `variance` the
+  // value VarianceOfAbsoluteValueOfNonZeros() would return after the scaling.
+  // This saves a full pass over the matrix in Scale().
+  ColIndex ScaleColumnsGeometricallyAndComputeVariance(Fractional* variance);
+
   // Scales the row indexed by row by 1/factor.
   // Used by ScaleMatrixRowsGeometrically and EquilibrateRows.
   RowIndex ScaleMatrixRows(const DenseColumn& factors);
@@ -643,6 +643,13 @@ class MPSReaderTemplate {
   // and INTEND that ends it.
   bool in_integer_section_;
 
+  // The entries of a column are usually given on consecutive lines of the
+  // COLUMNS section, so we cache the last column to avoid looking up its name
+  // and setting its type and default bounds again for each of these lines.
+  std::string last_column_name_;
+  IndexType last_column_index_;
+  bool has_last_column_ = false;
+
   // We keep track of the number of unconstrained rows so we can display it to
   // the user because other solvers usually ignore them and we don't (they will
   // be removed in the preprocessor).
@@ -839,6 +846,7 @@ absl::Status MPSReaderTemplate<DataWrapper>::ProcessColumnsSection(
     const internal::MPSLineInfo& line_info, DataWrapper* data) {
   // Take into account the INTORG and INTEND markers.
   if (absl::StrContains(line_info.GetLine(), "'MARKER'")) {
+    has_last_column_ = false;
     if (absl::StrContains(line_info.GetLine(), "'INTORG'")) {
       VLOG(2) << "Entering integer marker.\n" << line_info.GetLine();
       if (in_integer_section_) {
@@ -864,16 +872,22 @@ absl::Status MPSReaderTemplate<DataWrapper>::ProcessColumnsSection(
   const absl::string_view column_name = line_info.GetField(start_index + 0);
   const absl::string_view row1_name = line_info.GetField(start_index + 1);
   const absl::string_view row1_value = line_info.GetField(start_index + 2);
-  const IndexType col = data->FindOrCreateVariable(column_name);
-  is_binary_by_default_.resize(col + 1, false);
-  if (in_integer_section_) {
-    data->SetVariableTypeToInteger(col);
-    // The default bounds for integer variables are [0, 1].
-    data->SetVariableBounds(col, 0.0, 1.0);
-    is_binary_by_default_[col] = true;
-  } else {
-    data->SetVariableBounds(col, 0.0, kInfinity);
+  if (!has_last_column_ || column_name != last_column_name_) {
+    const IndexType col = data->FindOrCreateVariable(column_name);
+    is_binary_by_default_.resize(col + 1, false);
+    if (in_integer_section_) {
+      data->SetVariableTypeToInteger(col);
+      // The default bounds for integer variables are [0, 1].
+      data->SetVariableBounds(col, 0.0, 1.0);
+      is_binary_by_default_[col] = true;
+    } else {
+      data->SetVariableBounds(col, 0.0, kInfinity);
+    }
+    last_column_name_.assign(column_name.data(), column_name.size());
+    last_column_index_ = col;
+    has_last_column_ = true;
   }
+  const IndexType col = last_column_index_;
   RETURN_IF_ERROR(
       StoreCoefficient(line_info, col, row1_name, row1_value, data));
   if (line_info.GetFieldsSize() == start_index + 4) {
@@ -1187,6 +1201,7 @@ void MPSReaderTemplate<DataWrapper>::Reset() {
   in_integer_section_ = false;
   num_unconstrained_rows_ = 0;
   objective_name_.clear();
+  has_last_column_ = false;
 }
 
 template <class DataWrapper>
@@ -23,6 +23,7 @@ void LinearProgramToMPModelProto(const LinearProgram& input,
   output->set_name(input.name());
   output->set_maximize(input.IsMaximizationProblem());
   output->set_objective_offset(input.objective_offset());
+  output->mutable_variable()->Reserve(input.num_variables().value());
   for (ColIndex col(0); col < input.num_variables(); ++col) {
     MPVariableProto* variable = output->add_variable();
     variable->set_lower_bound(input.variable_lower_bounds()[col]);
@@ -35,12 +36,17 @@ void LinearProgramToMPModelProto(const LinearProgram& input,
   // column-wise but the MPModelProto uses a row-wise format.
   SparseMatrix transpose;
   transpose.PopulateFromTranspose(input.GetSparseMatrix());
+  output->mutable_constraint()->Reserve(input.num_constraints().value());
   for (RowIndex row(0); row < input.num_constraints(); ++row) {
     MPConstraintProto* constraint = output->add_constraint();
     constraint->set_lower_bound(input.constraint_lower_bounds()[row]);
     constraint->set_upper_bound(input.constraint_upper_bounds()[row]);
     constraint->set_name(input.GetConstraintName(row));
-    for (const SparseColumn::Entry e : transpose.column(RowToColIndex(row))) {
+    const SparseColumn& row_entries = transpose.column(RowToColIndex(row));
+    constraint->mutable_var_index()->Reserve(row_entries.num_entries().value());
+    constraint->mutable_coefficient()->Reserve(
+        row_entries.num_entries().value());
+    for (const SparseColumn::Entry e : row_entries) {
       constraint->add_var_index(e.row().value());
       constraint->add_coefficient(e.coefficient());
     }
@@ -65,6 +71,21 @@ void MPModelProtoToLinearProgram(const MPModelProto& input,
       output->SetVariableType(col, LinearProgram::VariableType::INTEGER);
     }
   }
+
+  // Reserve the columns first so that adding the entries row by row does not
+  // reallocate them many times.
+  StrictITIVector<ColIndex, EntryIndex> column_sizes(output->num_variables(),
+                                                     EntryIndex(0));
+  for (const MPConstraintProto& cst : input.constraint()) {
+    for (const int var : cst.var_index()) {
+      if (var < 0 || var >= input.variable_size()) continue;
+      ++column_sizes[ColIndex(var)];
+    }
+  }
+  for (ColIndex col(0); col < output->num_variables(); ++col) {
+    output->GetMutableSparseColumn(col)->Reserve(column_sizes[col]);
+  }
+
   for (int j = 0; j < input.constraint_size(); ++j) {
     const MPConstraintProto& cst = input.constraint(j);
     const RowIndex row = output->CreateNewConstraint();
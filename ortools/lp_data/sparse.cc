@@ -527,6 +527,66 @@ void CompactSparseMatrix::PopulateFromTranspose(
   DCHECK_EQ(starts_.back(), rows_.size());
 }
 
+void CompactSparseMatrix::AddTransposeOfNewRows(
+    const CompactSparseMatrix& input, RowIndex first_new_row) {
+  const ColIndex first_new_col = RowToColIndex(first_new_row);
+  DCHECK_EQ(num_cols_, first_new_col);
+  DCHECK_EQ(starts_.size(), num_cols_ + 1);
+  num_cols_ = RowToColIndex(input.num_rows());
+  num_rows_ = ColToRowIndex(input.num_cols());
+
+  // Because the input columns are sorted, the entries of the new rows are the
+  // last ones of each column. We remember where they start.
+  const auto input_entry_rows = input.rows_.view();
+  const auto num_input_cols = input.num_cols();
+  std::vector<EntryIndex> new_rows_starts(num_input_cols.value());
+  for (ColIndex col(0); col < num_input_cols; ++col) {
+    EntryIndex i = input.starts_[col + 1];
+    const EntryIndex start = input.starts_[col];
+    if (DEBUG_MODE) {
+      for (EntryIndex j = start + 1; j < i; ++j) {
+        DCHECK_LE(input_entry_rows[j - 1], input_entry_rows[j])
+            << "The input columns must be sorted by row.";
+      }
+    }
+    while (i > start && input_entry_rows[i - 1] >= first_new_row) --i;
+    new_rows_starts[col.value()] = i;
+  }
+
+  // Same as in PopulateFromTranspose(), but only for the new columns.
+  starts_.resize(num_cols_ + 2, EntryIndex(0));
+  starts_[first_new_col + 1] = starts_[first_new_col];
+  for (ColIndex col(0); col < num_input_cols; ++col) {
+    for (EntryIndex i = new_rows_starts[col.value()];
+         i < input.starts_[col + 1]; ++i) {
+      ++starts_[RowToColIndex(input_entry_rows[i]) + 2];
+    }
+  }
+  for (ColIndex col = first_new_col + 2; col < starts_.size(); ++col) {
+    starts_[col] += starts_[col - 1];
+  }
+  coefficients_.resize(starts_.back(), 0.0);
+  rows_.resize(starts_.back(), kInvalidRow);
+  starts_.pop_back();
+
+  const auto entry_rows = rows_.view();
+  const auto entry_coefficients = coefficients_.view();
+  const auto input_entry_coefficients = input.coefficients_.view();
+  const auto starts = starts_.view();
+  for (ColIndex col(0); col < num_input_cols; ++col) {
+    const RowIndex transposed_row = ColToRowIndex(col);
+    for (EntryIndex i = new_rows_starts[col.value()];
+         i < input.starts_[col + 1]; ++i) {
+      const ColIndex transposed_col = RowToColIndex(input_entry_rows[i]);
+      const EntryIndex index = starts[transposed_col + 1]++;
+      entry_coefficients[index] = input_entry_coefficients[i];
+      entry_rows[index] = transposed_row;
+    }
+  }
+
+  DCHECK_EQ(starts_.back(), rows_.size());
+}
+
 void TriangularMatrix::PopulateFromTranspose(const TriangularMatrix& input) {
   CompactSparseMatrix::PopulateFromTranspose(input);
 
@@ -1456,10 +1516,10 @@ void TriangularMatrix::ComputeRowsToConsiderInSortedOrder(
   if (non_zero_rows->empty()) return;
 
   // TODO(user): Investigate the best thresholds.
-  const int sparsity_threshold =
-      static_cast<int>(0.025 * static_cast<double>(num_rows_.value()));
-  const int num_ops_threshold =
-      static_cast<int>(0.05 * static_cast<double>(num_rows_.value()));
+  const int sparsity_threshold = static_cast<int>(
+      sparsity_ratio * static_cast<double>(num_rows_.value()));
+  const int num_ops_threshold = static_cast<int>(
+      num_ops_ratio * static_cast<double>(num_rows_.value()));
   int num_ops = non_zero_rows->size();
   if (num_ops > sparsity_threshold) {
     non_zero_rows->clear();
@@ -360,6 +360,16 @@ class CompactSparseMatrix {
   // by row indices.
   void PopulateFromTranspose(const CompactSparseMatrix& input);
 
+  // Assuming this matrix is the transpose of the first `first_new_row` rows
+  // of `input`, appends the transpose of the remaining rows of `input`. The
+  // result is the same as PopulateFromTranspose(input) but the complexity is
+  // only O(input.num_cols() + num_new_entries) instead of O(num_entries).
+  //
+  // Note that this requires the entries of each input column to be sorted by
+  // row, and the columns of `input` that already existed to be unchanged.
+  void AddTransposeOfNewRows(const CompactSparseMatrix& input,
+                             RowIndex first_new_row);
+
   // Clears the matrix and sets its number of rows. If none of the Populate()
   // function has been called, Reset() must be called before calling any of the
   // Add*() functions below.
@@ -255,6 +255,11 @@ class Model {
   inline absl::Status ValidateExistingVariableOfThisModel(
       Variable variable) const;
 
+  // Reserves memory for `num_new_variables` calls to AddVariable(). This is
+  // only a performance hint, which avoids rehashing the internal containers
+  // when building large models.
+  inline void ReserveVariables(int64_t num_new_variables);
+
   std::vector<LinearConstraint> ColumnNonzeros(Variable variable) const;
 
   //////////////////////////////////////////////////////////////////////////////
@@ -299,6 +304,13 @@ class Model {
   // linear constraints deleted.
   inline int num_linear_constraints() const;
 
+  // Reserves memory for `num_new_linear_constraints` calls to
+  // AddLinearConstraint() and for `num_new_terms` new nonzero coefficients in
+  // them. This is only a performance hint, which avoids rehashing the internal
+  // containers when building large models.
+  inline void ReserveLinearConstraints(int64_t num_new_linear_constraints,
+                                       int64_t num_new_terms);
+
   // The returned id of the next call to AddLinearConstraint.
   //
   // Equal to the number of linear constraints created.
@@ -956,6 +968,10 @@ void Model::DeleteVariable(const Variable variable) {
 
 int Model::num_variables() const { return storage()->num_variables(); }
 
+void Model::ReserveVariables(const int64_t num_new_variables) {
+  storage()->ReserveVariables(num_new_variables);
+}
+
 int64_t Model::next_variable_id() const {
   return storage()->next_variable_id().value();
 }
@@ -1057,6 +1073,12 @@ int Model::num_linear_constraints() const {
   return storage()->num_linear_constraints();
 }
 
+void Model::ReserveLinearConstraints(const int64_t num_new_linear_constraints,
+                                     const int64_t num_new_terms) {
+  storage()->ReserveLinearConstraints(num_new_linear_constraints,
+                                      num_new_terms);
+}
+
 int64_t Model::next_linear_constraint_id() const {
   return storage()->next_linear_constraint_id().value();
 }
@@ -13,16 +13,21 @@
 
 #include "ortools/math_opt/cpp/solve.h"
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <optional>
 #include <utility>
+#include <vector>
 
+#include "absl/log/check.h"
 #include "absl/memory/memory.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/synchronization/mutex.h"
+#include "absl/types/span.h"
 #include "ortools/base/status_macros.h"
+#include "ortools/base/threadpool.h"
 #include "ortools/math_opt/callback.pb.h"
 #include "ortools/math_opt/core/solver.h"
 #include "ortools/math_opt/cpp/callback.h"
@@ -117,6 +122,27 @@ absl::StatusOr<SolveResult> Solve(const Model& model,
   return CallSolve(*solver, model.storage(), solve_args);
 }
 
+std::vector<absl::StatusOr<SolveResult>> SolveConcurrently(
+    const absl::Span<const Model* const> models, const SolverType solver_type,
+    const int num_threads, const SolveArguments& solve_args,
+    const SolverInitArguments& init_args) {
+  CHECK_GE(num_threads, 1);
+  std::vector<absl::StatusOr<SolveResult>> results(models.size());
+  if (models.empty()) return results;
+  {
+    ThreadPool pool("SolveConcurrently",
+                    std::min<int>(num_threads, models.size()));
+    pool.StartWorkers();
+    for (int i = 0; i < models.size(); ++i) {
+      CHECK(models[i] != nullptr);
+      pool.Schedule([&, i]() {
+        results[i] = Solve(*models[i], solver_type, solve_args, init_args);
+      });
+    }
+  }  // The ThreadPool destructor waits for all the solves.
+  return results;
+}
+
 absl::StatusOr<ComputeInfeasibleSubsystemResult> ComputeInfeasibleSubsystem(
     const Model& model, const SolverType solver_type,
     const ComputeInfeasibleSubsystemArguments& infeasible_subsystem_args,
@@ -26,8 +26,10 @@
 
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include "absl/status/statusor.h"
+#include "absl/types/span.h"
 #include "ortools/math_opt/core/solver.h"
 #include "ortools/math_opt/cpp/compute_infeasible_subsystem_arguments.h"  // IWYU pragma: export
 #include "ortools/math_opt/cpp/compute_infeasible_subsystem_result.h"  // IWYU pragma: export
@@ -88,6 +90,25 @@ using SolveFunction =
         const operations_research::math_opt::SolveArguments&,
         const operations_research::math_opt::SolverInitArguments&)>;
 
+// Solves the input models concurrently, running at most `num_threads` solves
+// at the same time, and returns their results in the same order as `models`.
+//
+// This is useful to amortize the latency of many small independent solves.
+// Note that each solve still creates and destroys its own solver: solvers are
+// bound to a given model. For a sequence of related models, use one
+// IncrementalSolver per thread instead.
+//
+// The same `solve_args` and `init_args` are used for all the solves, so any
+// callback they contain may be called concurrently from several threads. The
+// `num_threads` budget does not account for the threads used by the solvers
+// themselves (see SolveParameters::threads).
+//
+// Each model must outlive its result, as for Solve().
+std::vector<absl::StatusOr<SolveResult>> SolveConcurrently(
+    absl::Span<const Model* const> models, SolverType solver_type,
+    int num_threads, const SolveArguments& solve_args = {},
+    const SolverInitArguments& init_args = {});
+
 // Computes an infeasible subsystem of the input model.
 //
 // A Status error will be returned if the inputs are invalid or there is an
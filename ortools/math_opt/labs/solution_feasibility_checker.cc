@@ -14,10 +14,13 @@
 #include "ortools/math_opt/labs/solution_feasibility_checker.h"
 
 #include <cmath>
+#include <cstdint>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include "absl/algorithm/container.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
@@ -27,6 +30,7 @@
 #include "ortools/base/status_builder.h"
 #include "ortools/base/status_macros.h"
 #include "ortools/math_opt/cpp/math_opt.h"
+#include "ortools/math_opt/storage/model_storage_types.h"
 #include "ortools/util/fp_roundtrip_conv.h"
 
 namespace operations_research::math_opt {
@@ -100,16 +104,33 @@ ModelSubset::Bounds CheckVariableBounds(
                                 options);
 }
 
-// CHECK-fails if `constraint` and `variable_values` come from different models.
-ModelSubset::Bounds CheckLinearConstraint(
-    const LinearConstraint constraint,
-    const VariableMap<double>& variable_values,
-    const FeasibilityCheckerOptions& options) {
-  const BoundedLinearExpression bounded_expr =
-      constraint.AsBoundedLinearExpression();
-  return CheckBoundedConstraint(
-      bounded_expr.expression.Evaluate(variable_values),
-      bounded_expr.lower_bound, bounded_expr.upper_bound, options);
+// Returns the activities of the linear constraints with at least one nonzero
+// coefficient, computed in a single pass over the constraint matrix instead of
+// building the LinearExpression of each constraint.
+//
+// The terms of each constraint are summed by increasing variable id, as in
+// LinearExpression::Evaluate(), so that the activities are identical to the
+// ones of AsBoundedLinearExpression().
+//
+// CHECK-fails if `model` and `variable_values` come from different models.
+absl::flat_hash_map<LinearConstraintId, double> LinearConstraintActivities(
+    const Model& model, const VariableMap<double>& variable_values) {
+  std::vector<std::tuple<LinearConstraintId, VariableId, double>> terms =
+      model.storage()->linear_constraint_matrix();
+  absl::c_sort(terms);
+  absl::flat_hash_map<LinearConstraintId, double> activities;
+  activities.reserve(model.num_linear_constraints());
+  for (int64_t i = 0; i < terms.size();) {
+    const LinearConstraintId constraint = std::get<0>(terms[i]);
+    double activity = 0.0;
+    for (; i < terms.size() && std::get<0>(terms[i]) == constraint; ++i) {
+      const auto [unused, variable, coefficient] = terms[i];
+      activity +=
+          coefficient * variable_values.at(Variable(model.storage(), variable));
+    }
+    activities[constraint] = activity;
+  }
+  return activities;
 }
 
 // CHECK-fails if `constraint` and `variable_values` come from different models.
@@ -233,9 +254,14 @@ absl::StatusOr<ModelSubset> CheckPrimalSolutionFeasibility(
     }
   }
 
+  const absl::flat_hash_map<LinearConstraintId, double> activities =
+      LinearConstraintActivities(model, variable_values);
   for (const LinearConstraint linear_constraint : model.LinearConstraints()) {
-    const ModelSubset::Bounds violations =
-        CheckLinearConstraint(linear_constraint, variable_values, options);
+    const auto activity = activities.find(linear_constraint.typed_id());
+    const ModelSubset::Bounds violations = CheckBoundedConstraint(
+        activity == activities.end() ? 0.0 : activity->second,
+        linear_constraint.lower_bound(), linear_constraint.upper_bound(),
+        options);
     if (!violations.empty()) {
       violated_constraints.linear_constraints[linear_constraint] = violations;
     }
@@ -13,6 +13,7 @@
 
 #include "ortools/math_opt/solvers/cp_sat_solver.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <functional>
@@ -491,8 +492,25 @@ SparseDoubleVectorProto CpSatSolver::ExtractSolution(
   // solution's variables.
   CHECK_EQ(cp_sat_variable_values.size(), variable_ids_.size());
 
-  SparseVectorFilterPredicate predicate(filter);
   SparseDoubleVectorProto result;
+  if (filter.filter_by_ids()) {
+    // Only visit the requested variables, which matters on large models when
+    // a callback asks for a few values. Both filtered_ids and variable_ids_
+    // are sorted.
+    auto it = variable_ids_.begin();
+    for (const int64_t id : filter.filtered_ids()) {
+      it = std::lower_bound(it, variable_ids_.end(), id);
+      if (it == variable_ids_.end()) break;
+      if (*it != id) continue;
+      const double value = cp_sat_variable_values[it - variable_ids_.begin()];
+      if (filter.skip_zero_values() && value == 0.0) continue;
+      result.add_ids(id);
+      result.add_values(value);
+    }
+    return result;
+  }
+
+  SparseVectorFilterPredicate predicate(filter);
   for (int i = 0; i < variable_ids_.size(); ++i) {
     const int64_t id = variable_ids_[i];
     const double value = cp_sat_variable_values[i];
@@ -0,0 +1,482 @@
+// Copyright 2010-2022 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "ortools/math_opt/solvers/pdlp_solver.h"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Eigen/Core"
+#include "Eigen/SparseCore"
+#include "absl/log/check.h"
+#include "absl/memory/memory.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_format.h"
+#include "absl/strings/str_join.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "ortools/base/protoutil.h"
+#include "ortools/base/status_macros.h"
+#include "ortools/math_opt/callback.pb.h"
+#include "ortools/math_opt/core/math_opt_proto_utils.h"
+#include "ortools/math_opt/core/solve_interrupter.h"
+#include "ortools/math_opt/core/solver_interface.h"
+#include "ortools/math_opt/core/sparse_vector_view.h"
+#include "ortools/math_opt/infeasible_subsystem.pb.h"
+#include "ortools/math_opt/model.pb.h"
+#include "ortools/math_opt/model_parameters.pb.h"
+#include "ortools/math_opt/model_update.pb.h"
+#include "ortools/math_opt/parameters.pb.h"
+#include "ortools/math_opt/result.pb.h"
+#include "ortools/math_opt/solution.pb.h"
+#include "ortools/math_opt/sparse_containers.pb.h"
+#include "ortools/math_opt/validators/callback_validator.h"
+#include "ortools/pdlp/iteration_stats.h"
+#include "ortools/pdlp/primal_dual_hybrid_gradient.h"
+#include "ortools/pdlp/quadratic_program.h"
+#include "ortools/pdlp/solve_log.pb.h"
+#include "ortools/pdlp/solvers.pb.h"
+#include "ortools/port/proto_utils.h"
+
+namespace operations_research {
+namespace math_opt {
+
+namespace {
+
+constexpr SupportedProblemStructures kPdlpSupportedStructures = {
+    .quadratic_objectives = SupportType::kSupported};
+
+// Returns the one line summary of the iteration stats sent to the message
+// callback.
+std::string IterationStatsMessage(const pdlp::IterationCallbackInfo& info) {
+  const pdlp::IterationStats& stats = info.iteration_stats;
+  std::string message = absl::StrFormat(
+      "iteration: %d, kkt_matrix_passes: %g, time: %.3fs",
+      stats.iteration_number(), stats.cumulative_kkt_matrix_passes(),
+      stats.cumulative_time_sec());
+  if (!stats.convergence_information().empty()) {
+    const pdlp::ConvergenceInformation& convergence_information =
+        stats.convergence_information(0);
+    absl::StrAppendFormat(
+        &message,
+        ", primal_objective: %.9g, dual_objective: %.9g, "
+        "l2_primal_residual: %.3g, l2_dual_residual: %.3g",
+        convergence_information.primal_objective(),
+        convergence_information.dual_objective(),
+        convergence_information.l2_primal_residual(),
+        convergence_information.l2_dual_residual());
+  }
+  return message;
+}
+
+// Returns `scale` * `values` as a sparse vector by MathOpt id, keeping only the
+// entries selected by `filter`.
+SparseDoubleVectorProto ToSparseDoubleVector(
+    const std::vector<int64_t>& ids, const Eigen::VectorXd& values,
+    const double scale, const SparseVectorFilterProto& filter) {
+  CHECK_EQ(ids.size(), values.size());
+  SparseVectorFilterPredicate predicate(filter);
+  SparseDoubleVectorProto result;
+  for (int64_t i = 0; i < ids.size(); ++i) {
+    const double value = scale * values[i];
+    if (predicate.AcceptsAndUpdate(ids[i], value)) {
+      result.add_ids(ids[i]);
+      result.add_values(value);
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+absl::Status PdlpSolver::BuildQuadraticProgram(const ModelProto& model) {
+  const int64_t num_variables = model.variables().ids_size();
+  const int64_t num_constraints = model.linear_constraints().ids_size();
+  qp_.ResizeAndInitialize(num_variables, num_constraints);
+  if (!model.name().empty()) {
+    qp_.problem_name = model.name();
+  }
+
+  const VariablesProto& variables = model.variables();
+  variable_ids_.assign(variables.ids().begin(), variables.ids().end());
+  variable_indices_.reserve(num_variables);
+  for (int64_t i = 0; i < num_variables; ++i) {
+    variable_indices_[variable_ids_[i]] = i;
+    qp_.variable_lower_bounds[i] = variables.lower_bounds(i);
+    qp_.variable_upper_bounds[i] = variables.upper_bounds(i);
+  }
+  if (!variables.names().empty()) {
+    qp_.variable_names.emplace(variables.names().begin(),
+                               variables.names().end());
+  }
+
+  const LinearConstraintsProto& linear_constraints =
+      model.linear_constraints();
+  linear_constraint_ids_.assign(linear_constraints.ids().begin(),
+                                linear_constraints.ids().end());
+  linear_constraint_indices_.reserve(num_constraints);
+  for (int64_t i = 0; i < num_constraints; ++i) {
+    linear_constraint_indices_[linear_constraint_ids_[i]] = i;
+    qp_.constraint_lower_bounds[i] = linear_constraints.lower_bounds(i);
+    qp_.constraint_upper_bounds[i] = linear_constraints.upper_bounds(i);
+  }
+  if (!linear_constraints.names().empty()) {
+    qp_.constraint_names.emplace(linear_constraints.names().begin(),
+                                 linear_constraints.names().end());
+  }
+
+  // PDLP minimizes, maximization problems are negated and the objective values
+  // are negated back with the objective_scaling_factor.
+  const ObjectiveProto& objective = model.objective();
+  const double sign = objective.maximize() ? -1.0 : 1.0;
+  qp_.objective_scaling_factor = sign;
+  qp_.objective_offset = sign * objective.offset();
+  for (const auto [id, coefficient] :
+       MakeView(objective.linear_coefficients())) {
+    qp_.objective_vector[variable_indices_.at(id)] = sign * coefficient;
+  }
+  const SparseDoubleMatrixProto& quadratic_coefficients =
+      objective.quadratic_coefficients();
+  if (!quadratic_coefficients.row_ids().empty()) {
+    qp_.objective_matrix.emplace();
+    qp_.objective_matrix->setZero(num_variables);
+    for (int k = 0; k < quadratic_coefficients.row_ids_size(); ++k) {
+      const int64_t row_id = quadratic_coefficients.row_ids(k);
+      const int64_t column_id = quadratic_coefficients.column_ids(k);
+      const double coefficient = quadratic_coefficients.coefficients(k);
+      if (row_id != column_id) {
+        return absl::InvalidArgumentError(absl::StrCat(
+            "PDLP only supports diagonal quadratic objectives, but the "
+            "objective has coefficient ",
+            coefficient, " for the product of variables ", row_id, " and ",
+            column_id));
+      }
+      // The objective of PDLP is 1/2 x'Qx + c'x, hence the factor 2.
+      qp_.objective_matrix->diagonal()[variable_indices_.at(row_id)] =
+          2.0 * sign * coefficient;
+    }
+  }
+
+  const SparseDoubleMatrixProto& matrix = model.linear_constraint_matrix();
+  std::vector<Eigen::Triplet<double, int64_t>> triplets;
+  triplets.reserve(matrix.row_ids_size());
+  for (int k = 0; k < matrix.row_ids_size(); ++k) {
+    triplets.emplace_back(linear_constraint_indices_.at(matrix.row_ids(k)),
+                          variable_indices_.at(matrix.column_ids(k)),
+                          matrix.coefficients(k));
+  }
+  pdlp::SetEigenMatrixFromTriplets(std::move(triplets),
+                                   qp_.constraint_matrix);
+  return absl::OkStatus();
+}
+
+absl::StatusOr<pdlp::PrimalDualHybridGradientParams>
+PdlpSolver::MergeSolveParameters(const SolveParametersProto& solve_parameters,
+                                 const bool has_message_callback) {
+  pdlp::PrimalDualHybridGradientParams result;
+  std::vector<std::string> warnings;
+  if (solve_parameters.enable_output() && !has_message_callback) {
+    result.set_verbosity_level(3);
+  }
+  if (solve_parameters.has_threads()) {
+    result.set_num_threads(solve_parameters.threads());
+  }
+  if (solve_parameters.has_time_limit()) {
+    const absl::Duration time_limit =
+        util_time::DecodeGoogleApiProto(solve_parameters.time_limit()).value();
+    result.mutable_termination_criteria()->set_time_sec_limit(
+        absl::ToDoubleSeconds(time_limit));
+  }
+  if (solve_parameters.has_iteration_limit()) {
+    if (solve_parameters.iteration_limit() >
+        std::numeric_limits<int32_t>::max()) {
+      warnings.push_back(absl::StrCat(
+          "PDLP only supports 'iteration_limit' values that fit in an int32, "
+          "but iteration_limit was set to: ",
+          solve_parameters.iteration_limit()));
+    } else {
+      result.mutable_termination_criteria()->set_iteration_limit(
+          static_cast<int32_t>(solve_parameters.iteration_limit()));
+    }
+  }
+  if (solve_parameters.has_node_limit()) {
+    warnings.push_back("PDLP does not support 'node_limit' parameter");
+  }
+  if (solve_parameters.has_cutoff_limit()) {
+    warnings.push_back("PDLP does not support 'cutoff_limit' parameter");
+  }
+  if (solve_parameters.has_objective_limit()) {
+    warnings.push_back("PDLP does not support 'objective_limit' parameter");
+  }
+  if (solve_parameters.has_best_bound_limit()) {
+    warnings.push_back("PDLP does not support 'best_bound_limit' parameter");
+  }
+  if (solve_parameters.has_solution_limit()) {
+    warnings.push_back("PDLP does not support 'solution_limit' parameter");
+  }
+  if (solve_parameters.has_random_seed()) {
+    warnings.push_back("PDLP does not support 'random_seed' parameter");
+  }
+  if (solve_parameters.lp_algorithm() != LP_ALGORITHM_UNSPECIFIED &&
+      solve_parameters.lp_algorithm() != LP_ALGORITHM_FIRST_ORDER) {
+    warnings.push_back(absl::StrCat(
+        "PDLP only supports 'LP_ALGORITHM_FIRST_ORDER' value for "
+        "'lp_algorithm' parameter, but lp_algorithm was set to: ",
+        ProtoEnumToString(solve_parameters.lp_algorithm())));
+  }
+  if (solve_parameters.presolve() != EMPHASIS_UNSPECIFIED) {
+    warnings.push_back(absl::StrCat(
+        "PDLP does not support 'presolve' parameter, but presolve was set "
+        "to: ",
+        ProtoEnumToString(solve_parameters.presolve())));
+  }
+  if (solve_parameters.cuts() != EMPHASIS_UNSPECIFIED) {
+    warnings.push_back(absl::StrCat(
+        "PDLP does not support 'cuts' parameter, but cuts was set to: ",
+        ProtoEnumToString(solve_parameters.cuts())));
+  }
+  if (solve_parameters.heuristics() != EMPHASIS_UNSPECIFIED) {
+    warnings.push_back(absl::StrCat(
+        "PDLP does not support 'heuristics' parameter, but heuristics was set "
+        "to: ",
+        ProtoEnumToString(solve_parameters.heuristics())));
+  }
+  if (solve_parameters.scaling() != EMPHASIS_UNSPECIFIED) {
+    warnings.push_back(absl::StrCat(
+        "PDLP does not support 'scaling' parameter, but scaling was set to: ",
+        ProtoEnumToString(solve_parameters.scaling())));
+  }
+  if (!warnings.empty()) {
+    return absl::InvalidArgumentError(absl::StrJoin(warnings, "; "));
+  }
+
+  result.MergeFrom(solve_parameters.pdlp());
+  if (has_message_callback) {
+    // The logs of PDLP go to LOG(INFO), the message callback gets the
+    // iteration stats instead. As for Glop, we ignore the user's input here
+    // since they would otherwise be printed twice.
+    result.set_verbosity_level(0);
+  }
+  return result;
+}
+
+absl::StatusOr<SolveResultProto> PdlpSolver::MakeSolveResult(
+    const pdlp::SolverResult& pdlp_result,
+    const ModelSolveParametersProto& model_parameters) {
+  const pdlp::SolveLog& solve_log = pdlp_result.solve_log;
+  const bool is_maximize = qp_.objective_scaling_factor < 0.0;
+  // The dual values and reduced costs of the minimization problem solved by
+  // PDLP differ from the ones of the MathOpt model by the objective scaling.
+  const double dual_scale = qp_.objective_scaling_factor;
+  const std::string& detail = solve_log.termination_string();
+
+  SolveResultProto solve_result;
+  const std::optional<pdlp::ConvergenceInformation> convergence_information =
+      pdlp::GetConvergenceInformation(solve_log.solution_stats(),
+                                      solve_log.solution_type());
+  if (convergence_information.has_value()) {
+    *solve_result.mutable_pdlp_output()->mutable_convergence_information() =
+        *convergence_information;
+  }
+
+  // The feasibility status of the returned solution, if any.
+  std::optional<SolutionStatusProto> solution_status;
+  switch (solve_log.termination_reason()) {
+    case pdlp::TERMINATION_REASON_OPTIMAL:
+      if (!convergence_information.has_value()) {
+        return absl::InternalError(
+            "PDLP returned TERMINATION_REASON_OPTIMAL without convergence "
+            "information for its solution");
+      }
+      *solve_result.mutable_termination() = OptimalTerminationProto(
+          convergence_information->primal_objective(),
+          convergence_information->dual_objective(), detail);
+      solution_status = SOLUTION_STATUS_FEASIBLE;
+      break;
+    case pdlp::TERMINATION_REASON_PRIMAL_INFEASIBLE: {
+      *solve_result.mutable_termination() = InfeasibleTerminationProto(
+          is_maximize,
+          /*dual_feasibility_status=*/FEASIBILITY_STATUS_UNDETERMINED, detail);
+      // PDLP returns the dual ray in the dual solution and reduced costs.
+      DualRayProto* const dual_ray = solve_result.add_dual_rays();
+      *dual_ray->mutable_dual_values() = ToSparseDoubleVector(
+          linear_constraint_ids_, pdlp_result.dual_solution, dual_scale,
+          model_parameters.dual_values_filter());
+      *dual_ray->mutable_reduced_costs() = ToSparseDoubleVector(
+          variable_ids_, pdlp_result.reduced_costs, dual_scale,
+          model_parameters.reduced_costs_filter());
+      break;
+    }
+    case pdlp::TERMINATION_REASON_DUAL_INFEASIBLE:
+      *solve_result.mutable_termination() =
+          InfeasibleOrUnboundedTerminationProto(
+              is_maximize,
+              /*dual_feasibility_status=*/FEASIBILITY_STATUS_INFEASIBLE,
+              detail);
+      // PDLP returns the primal ray in the primal solution.
+      *solve_result.add_primal_rays()->mutable_variable_values() =
+          ToSparseDoubleVector(variable_ids_, pdlp_result.primal_solution,
+                               /*scale=*/1.0,
+                               model_parameters.variable_values_filter());
+      break;
+    case pdlp::TERMINATION_REASON_PRIMAL_OR_DUAL_INFEASIBLE:
+      *solve_result.mutable_termination() =
+          InfeasibleOrUnboundedTerminationProto(
+              is_maximize,
+              /*dual_feasibility_status=*/FEASIBILITY_STATUS_UNDETERMINED,
+              detail);
+      break;
+    case pdlp::TERMINATION_REASON_TIME_LIMIT:
+      *solve_result.mutable_termination() = NoSolutionFoundTerminationProto(
+          is_maximize, LIMIT_TIME, /*optional_dual_objective=*/std::nullopt,
+          detail);
+      solution_status = SOLUTION_STATUS_UNDETERMINED;
+      break;
+    case pdlp::TERMINATION_REASON_ITERATION_LIMIT:
+      *solve_result.mutable_termination() = NoSolutionFoundTerminationProto(
+          is_maximize, LIMIT_ITERATION,
+          /*optional_dual_objective=*/std::nullopt, detail);
+      solution_status = SOLUTION_STATUS_UNDETERMINED;
+      break;
+    case pdlp::TERMINATION_REASON_KKT_MATRIX_PASS_LIMIT:
+      *solve_result.mutable_termination() = NoSolutionFoundTerminationProto(
+          is_maximize, LIMIT_OTHER, /*optional_dual_objective=*/std::nullopt,
+          detail);
+      solution_status = SOLUTION_STATUS_UNDETERMINED;
+      break;
+    case pdlp::TERMINATION_REASON_INTERRUPTED_BY_USER:
+      *solve_result.mutable_termination() = NoSolutionFoundTerminationProto(
+          is_maximize, LIMIT_INTERRUPTED,
+          /*optional_dual_objective=*/std::nullopt, detail);
+      solution_status = SOLUTION_STATUS_UNDETERMINED;
+      break;
+    case pdlp::TERMINATION_REASON_NUMERICAL_ERROR:
+      *solve_result.mutable_termination() = TerminateForReason(
+          is_maximize, TERMINATION_REASON_NUMERICAL_ERROR, detail);
+      break;
+    case pdlp::TERMINATION_REASON_INVALID_PROBLEM:
+    case pdlp::TERMINATION_REASON_INVALID_PARAMETER:
+    case pdlp::TERMINATION_REASON_INVALID_INITIAL_SOLUTION:
+      return absl::InvalidArgumentError(
+          absl::StrCat("PDLP failed with ",
+                       ProtoEnumToString(solve_log.termination_reason()), ": ",
+                       detail));
+    default:
+      return absl::InternalError(
+          absl::StrCat("unexpected PDLP termination reason ",
+                       ProtoEnumToString(solve_log.termination_reason()), ": ",
+                       detail));
+  }
+
+  if (solution_status.has_value()) {
+    SolutionProto* const solution = solve_result.add_solutions();
+    PrimalSolutionProto* const primal_solution =
+        solution->mutable_primal_solution();
+    *primal_solution->mutable_variable_values() = ToSparseDoubleVector(
+        variable_ids_, pdlp_result.primal_solution, /*scale=*/1.0,
+        model_parameters.variable_values_filter());
+    primal_solution->set_feasibility_status(*solution_status);
+    DualSolutionProto* const dual_solution = solution->mutable_dual_solution();
+    *dual_solution->mutable_dual_values() = ToSparseDoubleVector(
+        linear_constraint_ids_, pdlp_result.dual_solution, dual_scale,
+        model_parameters.dual_values_filter());
+    *dual_solution->mutable_reduced_costs() = ToSparseDoubleVector(
+        variable_ids_, pdlp_result.reduced_costs, dual_scale,
+        model_parameters.reduced_costs_filter());
+    dual_solution->set_feasibility_status(*solution_status);
+    if (convergence_information.has_value()) {
+      primal_solution->set_objective_value(
+          convergence_information->primal_objective());
+      dual_solution->set_objective_value(
+          convergence_information->dual_objective());
+    }
+  }
+
+  solve_result.mutable_solve_stats()->set_first_order_iterations(
+      solve_log.iteration_count());
+  return solve_result;
+}
+
+absl::StatusOr<SolveResultProto> PdlpSolver::Solve(
+    const SolveParametersProto& parameters,
+    const ModelSolveParametersProto& model_parameters,
+    const MessageCallback message_cb,
+    const CallbackRegistrationProto& callback_registration, const Callback,
+    SolveInterrupter* const interrupter) {
+  RETURN_IF_ERROR(CheckRegisteredCallbackEvents(callback_registration,
+                                                /*supported_events=*/{}));
+
+  const absl::Time start = absl::Now();
+  ASSIGN_OR_RETURN(const pdlp::PrimalDualHybridGradientParams pdlp_parameters,
+                   MergeSolveParameters(
+                       parameters,
+                       /*has_message_callback=*/message_cb != nullptr));
+
+  std::atomic<bool> interrupt_solve = false;
+  const ScopedSolveInterrupterCallback scoped_interrupt_cb(interrupter, [&]() {
+    CHECK_NE(interrupter, nullptr);
+    interrupt_solve = true;
+  });
+
+  std::function<void(const pdlp::IterationCallbackInfo&)> iteration_stats_cb;
+  if (message_cb != nullptr) {
+    iteration_stats_cb = [&](const pdlp::IterationCallbackInfo& info) {
+      message_cb({IterationStatsMessage(info)});
+    };
+  }
+
+  // PDLP modifies (rescales) its input, hence the copy of qp_ which keeps this
+  // solver reusable for another Solve().
+  const pdlp::SolverResult pdlp_result = pdlp::PrimalDualHybridGradient(
+      qp_, pdlp_parameters, &interrupt_solve, std::move(iteration_stats_cb));
+  ASSIGN_OR_RETURN(SolveResultProto solve_result,
+                   MakeSolveResult(pdlp_result, model_parameters));
+  RETURN_IF_ERROR(util_time::EncodeGoogleApiProto(
+      absl::Now() - start,
+      solve_result.mutable_solve_stats()->mutable_solve_time()));
+  return solve_result;
+}
+
+absl::StatusOr<std::unique_ptr<SolverInterface>> PdlpSolver::New(
+    const ModelProto& model, const InitArgs&) {
+  RETURN_IF_ERROR(ModelIsSupported(model, kPdlpSupportedStructures, "PDLP"));
+  auto solver = absl::WrapUnique(new PdlpSolver);
+  RETURN_IF_ERROR(solver->BuildQuadraticProgram(model));
+  return solver;
+}
+
+absl::StatusOr<bool> PdlpSolver::Update(const ModelUpdateProto&) {
+  return false;
+}
+
+absl::StatusOr<ComputeInfeasibleSubsystemResultProto>
+PdlpSolver::ComputeInfeasibleSubsystem(const SolveParametersProto&,
+                                       MessageCallback, SolveInterrupter*) {
+  return absl::UnimplementedError(
+      "PDLP does not implement a method to compute an infeasible subsystem");
+}
+
+MATH_OPT_REGISTER_SOLVER(SOLVER_TYPE_PDLP, PdlpSolver::New)
+
+}  // namespace math_opt
+}  // namespace operations_research
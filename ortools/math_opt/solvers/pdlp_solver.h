@@ -0,0 +1,100 @@
+// Copyright 2010-2022 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// MathOpt interface to PDLP, Google's first order LP and convex diagonal QP
+// solver.
+//
+// The pdlp::QuadraticProgram is built directly from the ModelProto, without
+// the intermediate MPModelProto of linear_solver/pdlp_interface.cc. Each
+// Solve() gives PDLP its own copy since PDLP rescales its input in place.
+//
+// The model is not updated in place: Update() always returns false so that a
+// new solver is built on each model change.
+#ifndef OR_TOOLS_MATH_OPT_SOLVERS_PDLP_SOLVER_H_
+#define OR_TOOLS_MATH_OPT_SOLVERS_PDLP_SOLVER_H_
+
+#include <stdint.h>
+
+#include <memory>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "ortools/math_opt/callback.pb.h"
+#include "ortools/math_opt/core/solve_interrupter.h"
+#include "ortools/math_opt/core/solver_interface.h"
+#include "ortools/math_opt/infeasible_subsystem.pb.h"
+#include "ortools/math_opt/model.pb.h"
+#include "ortools/math_opt/model_parameters.pb.h"
+#include "ortools/math_opt/model_update.pb.h"
+#include "ortools/math_opt/parameters.pb.h"
+#include "ortools/math_opt/result.pb.h"
+#include "ortools/pdlp/primal_dual_hybrid_gradient.h"
+#include "ortools/pdlp/quadratic_program.h"
+#include "ortools/pdlp/solvers.pb.h"
+
+namespace operations_research {
+namespace math_opt {
+
+class PdlpSolver : public SolverInterface {
+ public:
+  static absl::StatusOr<std::unique_ptr<SolverInterface>> New(
+      const ModelProto& model, const InitArgs& init_args);
+
+  // No callback event is supported. The progress of the solve is reported
+  // through `message_cb` instead, which receives one line of iteration stats
+  // each time PDLP checks its termination criteria.
+  absl::StatusOr<SolveResultProto> Solve(
+      const SolveParametersProto& parameters,
+      const ModelSolveParametersProto& model_parameters,
+      MessageCallback message_cb,
+      const CallbackRegistrationProto& callback_registration, Callback cb,
+      SolveInterrupter* interrupter) override;
+  absl::StatusOr<bool> Update(const ModelUpdateProto& model_update) override;
+  absl::StatusOr<ComputeInfeasibleSubsystemResultProto>
+  ComputeInfeasibleSubsystem(const SolveParametersProto& parameters,
+                             MessageCallback message_cb,
+                             SolveInterrupter* interrupter) override;
+
+  // Returns the merged parameters or an InvalidArgumentError listing the
+  // settings that are invalid for this solver.
+  static absl::StatusOr<pdlp::PrimalDualHybridGradientParams>
+  MergeSolveParameters(const SolveParametersProto& solve_parameters,
+                       bool has_message_callback);
+
+ private:
+  PdlpSolver() = default;
+
+  absl::Status BuildQuadraticProgram(const ModelProto& model);
+
+  absl::StatusOr<SolveResultProto> MakeSolveResult(
+      const pdlp::SolverResult& pdlp_result,
+      const ModelSolveParametersProto& model_parameters);
+
+  // The problem solved by PDLP. Maximization problems are negated, using
+  // objective_scaling_factor = -1.
+  pdlp::QuadraticProgram qp_;
+
+  // The MathOpt ids of the variables and linear constraints, by index in qp_.
+  std::vector<int64_t> variable_ids_;
+  std::vector<int64_t> linear_constraint_ids_;
+  absl::flat_hash_map<int64_t, int64_t> variable_indices_;
+  absl::flat_hash_map<int64_t, int64_t> linear_constraint_indices_;
+};
+
+}  // namespace math_opt
+}  // namespace operations_research
+
+#endif  // OR_TOOLS_MATH_OPT_SOLVERS_PDLP_SOLVER_H_
@@ -112,6 +112,11 @@ class LinearConstraintStorage {
   // Sets the next variable id to be the maximum of next_id() and `minimum`.
   inline void ensure_next_id_at_least(LinearConstraintId minimum);
 
+  // Reserves memory for `num_new_linear_constraints` calls to Add() and for
+  // `num_new_terms` new nonzero coefficients.
+  inline void Reserve(int64_t num_new_linear_constraints,
+                      int64_t num_new_terms);
+
   // Returns true if this id has been created and not yet deleted.
   inline bool contains(LinearConstraintId id) const;
 
@@ -285,6 +290,13 @@ void LinearConstraintStorage::ensure_next_id_at_least(
   next_id_ = std::max(minimum, next_id_);
 }
 
+void LinearConstraintStorage::Reserve(const int64_t num_new_linear_constraints,
+                                      const int64_t num_new_terms) {
+  linear_constraints_.reserve(linear_constraints_.size() +
+                              num_new_linear_constraints);
+  matrix_.Reserve(num_new_terms);
+}
+
 bool LinearConstraintStorage::contains(const LinearConstraintId id) const {
   return linear_constraints_.contains(id);
 }
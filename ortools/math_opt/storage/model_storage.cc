@@ -59,6 +59,7 @@ absl::StatusOr<std::unique_ptr<ModelStorage>> ModelStorage::FromModelProto(
                                                 model_proto.objective().name());
 
   // Add variables.
+  storage->ReserveVariables(model_proto.variables().ids_size());
   storage->AddVariables(model_proto.variables());
 
   // Set the objective.
@@ -75,6 +76,9 @@ absl::StatusOr<std::unique_ptr<ModelStorage>> ModelStorage::FromModelProto(
   storage->AddAuxiliaryObjectives(model_proto.auxiliary_objectives());
 
   // Add linear constraints.
+  storage->ReserveLinearConstraints(
+      model_proto.linear_constraints().ids_size(),
+      model_proto.linear_constraint_matrix().row_ids_size());
   storage->AddLinearConstraints(model_proto.linear_constraints());
 
   // Set the linear constraints coefficients.
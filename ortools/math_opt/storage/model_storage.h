@@ -238,6 +238,10 @@ class ModelStorage {
   // Sets the next variable id to be the maximum of next_variable_id() and id.
   inline void ensure_next_variable_id_at_least(VariableId id);
 
+  // Reserves memory for `num_new_variables` calls to AddVariable(). This is
+  // only a performance hint, useful when building large models.
+  inline void ReserveVariables(int64_t num_new_variables);
+
   // Returns true if this id has been created and not yet deleted.
   inline bool has_variable(VariableId id) const;
 
@@ -299,6 +303,13 @@ class ModelStorage {
   // next_linear_constraint_id() and id.
   inline void ensure_next_linear_constraint_id_at_least(LinearConstraintId id);
 
+  // Reserves memory for `num_new_linear_constraints` calls to
+  // AddLinearConstraint() and `num_new_terms` new nonzero linear constraint
+  // coefficients. This is only a performance hint, useful when building large
+  // models.
+  inline void ReserveLinearConstraints(int64_t num_new_linear_constraints,
+                                       int64_t num_new_terms);
+
   // Returns true if this id has been created and not yet deleted.
   inline bool has_linear_constraint(LinearConstraintId id) const;
 
@@ -830,6 +841,10 @@ void ModelStorage::ensure_next_variable_id_at_least(const VariableId id) {
   variables_.ensure_next_id_at_least(id);
 }
 
+void ModelStorage::ReserveVariables(const int64_t num_new_variables) {
+  variables_.Reserve(num_new_variables);
+}
+
 bool ModelStorage::has_variable(const VariableId id) const {
   return variables_.contains(id);
 }
@@ -883,6 +898,11 @@ void ModelStorage::ensure_next_linear_constraint_id_at_least(
   linear_constraints_.ensure_next_id_at_least(id);
 }
 
+void ModelStorage::ReserveLinearConstraints(
+    const int64_t num_new_linear_constraints, const int64_t num_new_terms) {
+  linear_constraints_.Reserve(num_new_linear_constraints, num_new_terms);
+}
+
 bool ModelStorage::has_linear_constraint(const LinearConstraintId id) const {
   return linear_constraints_.contains(id);
 }
@@ -139,8 +139,14 @@ void SparseSymmetricMatrix::Clear() {
 
 SparseDoubleMatrixProto SparseSymmetricMatrix::Proto() const {
   SparseDoubleMatrixProto result;
+  // Each nonzero of values_ is exported exactly once (for v <= other below).
+  const int num_entries = static_cast<int>(nonzeros_);
+  result.mutable_row_ids()->Reserve(num_entries);
+  result.mutable_column_ids()->Reserve(num_entries);
+  result.mutable_coefficients()->Reserve(num_entries);
 
   std::vector<VariableId> vars_in_order;
+  vars_in_order.reserve(related_variables_.size());
   for (const auto& [v, _] : related_variables_) {
     vars_in_order.push_back(v);
   }
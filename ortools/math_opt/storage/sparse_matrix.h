@@ -222,6 +222,13 @@ class SparseMatrix {
   // Removes all terms from the matrix.
   void Clear();
 
+  // Reserves memory for `num_new_terms` new nonzero terms. Since the row and
+  // column indices are only allocated on demand, this is just a hint for the
+  // hash map of the values.
+  void Reserve(int64_t num_new_terms) {
+    values_.reserve(values_.size() + num_new_terms);
+  }
+
   // The number of (row, column) keys with nonzero value.
   int64_t nonzeros() const;
 
@@ -507,15 +514,9 @@ int64_t SparseMatrix<RowId, ColumnId>::nonzeros() const {
 
 template <typename RowId, typename ColumnId>
 SparseDoubleMatrixProto SparseMatrix<RowId, ColumnId>::Proto() const {
-  SparseDoubleMatrixProto result;
-  std::vector<std::tuple<RowId, ColumnId, double>> terms = Terms();
-  absl::c_sort(terms);
-  for (const auto [r, c, v] : terms) {
-    result.add_row_ids(r.value());
-    result.add_column_ids(c.value());
-    result.add_coefficients(v);
-  }
-  return result;
+  // EntriesToMatrixProto() reserves the repeated fields, which avoids their
+  // repeated reallocations (and the associated peak memory) on large models.
+  return internal::EntriesToMatrixProto(Terms());
 }
 
 template <typename RowId, typename ColumnId>
@@ -526,8 +527,8 @@ SparseDoubleMatrixProto SparseMatrix<RowId, ColumnId>::Update(
     const absl::Span<const ColumnId> new_columns,
     const absl::flat_hash_set<std::pair<RowId, ColumnId>>& dirty) const {
   // Extract changes to the matrix of linear constraint coefficients
-  std::vector<std::tuple<LinearConstraintId, VariableId, double>>
-      matrix_updates;
+  std::vector<std::tuple<RowId, ColumnId, double>> matrix_updates;
+  matrix_updates.reserve(dirty.size());
   for (const auto [row, column] : dirty) {
     // Note: it is important that we check for deleted constraints and variables
     // here. While we generally try to remove elements from matrix_keys_ when
@@ -110,6 +110,9 @@ class VariableStorage {
   // Sets the next variable id to be the maximum of next_id() and `minimum`.
   inline void ensure_next_id_at_least(VariableId minimum);
 
+  // Reserves memory for `num_new_variables` calls to Add().
+  inline void Reserve(int64_t num_new_variables);
+
   // Returns true if this id has been created and not yet deleted.
   inline bool contains(VariableId id) const;
 
@@ -244,6 +247,10 @@ void VariableStorage::ensure_next_id_at_least(VariableId minimum) {
   next_variable_id_ = std::max(minimum, next_variable_id_);
 }
 
+void VariableStorage::Reserve(const int64_t num_new_variables) {
+  variables_.reserve(variables_.size() + num_new_variables);
+}
+
 bool VariableStorage::contains(const VariableId id) const {
   return variables_.contains(id);
 }
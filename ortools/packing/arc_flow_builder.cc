@@ -14,14 +14,17 @@
 #include "ortools/packing/arc_flow_builder.h"
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
-#include <set>
 #include <utility>
 #include <vector>
 
 #include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/hash/hash.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_join.h"
+#include "absl/types/span.h"
 #include "ortools/base/commandlineflags.h"
 #include "ortools/base/map_util.h"
 #include "ortools/base/stl_util.h"
@@ -56,11 +59,13 @@ class ArcFlowBuilder {
     double NormalizedSize(const std::vector<int>& bin_dimensions) const;
   };
 
-  // State of the dynamic programming algorithm.
+  // State of the dynamic programming algorithm. The used dimensions of all the
+  // states are stored contiguously in dp_dimensions_, see DpDimensions(). This
+  // is a lot more compact than one std::vector<int> per state, and there can
+  // be many millions of states.
   struct DpState {
     int cur_item_index;
     int cur_item_quantity;
-    std::vector<int> used_dimensions;
     // DP State indices of the states that can be obtained by moving
     // either "right" to (cur_item_index, cur_item_quantity++) or "up"
     // to (cur_item_index++, cur_item_quantity=0). -1 if impossible.
@@ -68,8 +73,46 @@ class ArcFlowBuilder {
     int up_child;
   };
 
+  absl::Span<int> DpDimensions(int state_index) {
+    const size_t num_dims = bin_dimensions_.size();
+    return absl::MakeSpan(&dp_dimensions_[state_index * num_dims], num_dims);
+  }
+  absl::Span<const int> DpDimensions(int state_index) const {
+    const size_t num_dims = bin_dimensions_.size();
+    return absl::MakeConstSpan(&dp_dimensions_[state_index * num_dims],
+                               num_dims);
+  }
+
+  // Hash and equality of the DP states on their used dimensions, so that
+  // the index of a state can be its own key in dp_state_index_. These also
+  // accept the dimensions of a state that does not exist yet.
+  struct DpStateHash {
+    using is_transparent = void;
+    size_t operator()(int state_index) const {
+      return absl::HashOf(builder->DpDimensions(state_index));
+    }
+    size_t operator()(absl::Span<const int> dimensions) const {
+      return absl::HashOf(dimensions);
+    }
+    const ArcFlowBuilder* builder;
+  };
+  struct DpStateEq {
+    using is_transparent = void;
+    bool operator()(int a, int b) const {
+      return builder->DpDimensions(a) == builder->DpDimensions(b);
+    }
+    bool operator()(int a, absl::Span<const int> b) const {
+      return builder->DpDimensions(a) == b;
+    }
+    bool operator()(absl::Span<const int> a, int b) const {
+      return a == builder->DpDimensions(b);
+    }
+    const ArcFlowBuilder* builder;
+  };
+  typedef absl::flat_hash_set<int, DpStateHash, DpStateEq> DpStateSet;
+
   // Add item iteratively to create all possible nodes in a forward pass.
-  void ForwardCreationPass(DpState* dp_state);
+  void ForwardCreationPass(int state_index);
   // Scan DP-nodes backward to relabels each nodes by increasing them as much
   // as possible.
   void BackwardCompressionPass(int state_index);
@@ -78,9 +121,6 @@ class ArcFlowBuilder {
 
   // Can we fit one more item in the bin?
   bool CanFitNewItem(const std::vector<int>& used_dimensions, int item) const;
-  // Create a new used_dimensions that is used_dimensions + item dimensions.
-  std::vector<int> AddItem(const std::vector<int>& used_dimensions,
-                           int item) const;
 
   // DpState helpers.
   int LookupOrCreateDpState(int item, int quantity,
@@ -90,13 +130,18 @@ class ArcFlowBuilder {
   std::vector<Item> items_;
 
   typedef absl::flat_hash_map<std::vector<int>, int> VectorIntIntMap;
-  int GetOrCreateNode(const std::vector<int>& used_dimensions);
+  int GetOrCreateNode(absl::Span<const int> used_dimensions);
 
   // We store all DP states in a dense vector, and remember their index
-  // in the dp_state_index_ map (we use a tri-dimensional indexing because
+  // in the dp_state_index_ set (we use a tri-dimensional indexing because
   // it's faster for the hash part).
-  std::vector<DpState*> dp_states_;
-  std::vector<std::vector<VectorIntIntMap>> dp_state_index_;
+  std::vector<DpState> dp_states_;
+  std::vector<int> dp_dimensions_;
+  std::vector<std::vector<DpStateSet>> dp_state_index_;
+
+  // Temporary vectors, kept here to avoid allocations.
+  std::vector<int> tmp_dimensions_;
+  std::vector<int> tmp_node_;
 
   // The ArcFlowGraph will have nodes which will correspond to "some"
   // of the vector<int> representing the partial bin usages encountered during
@@ -105,9 +150,17 @@ class ArcFlowBuilder {
   absl::flat_hash_map<std::vector<int>, int> node_indices_;
   std::vector<std::vector<int>> nodes_;
 
-  std::set<ArcFlowGraph::Arc> arcs_;
+  // Arcs may contain duplicates until SortAndRemoveDuplicateArcs() is called.
+  std::vector<ArcFlowGraph::Arc> arcs_;
 };
 
+void SortAndRemoveDuplicateArcs(std::vector<ArcFlowGraph::Arc>* arcs) {
+  gtl::STLSortAndRemoveDuplicates(
+      arcs, [](const ArcFlowGraph::Arc& a, const ArcFlowGraph::Arc& b) {
+        return a < b;
+      });
+}
+
 double ArcFlowBuilder::Item::NormalizedSize(
     const std::vector<int>& bin_dimensions) const {
   double size = 0.0;
@@ -160,77 +213,75 @@ bool ArcFlowBuilder::CanFitNewItem(const std::vector<int>& used_dimensions,
   return true;
 }
 
-std::vector<int> ArcFlowBuilder::AddItem(
-    const std::vector<int>& used_dimensions, int item) const {
-  DCHECK(CanFitNewItem(used_dimensions, item));
-  std::vector<int> result = used_dimensions;
-  for (int d = 0; d < bin_dimensions_.size(); ++d) {
-    result[d] += items_[item].dimensions[d];
-  }
-  return result;
-}
-
-int ArcFlowBuilder::GetOrCreateNode(const std::vector<int>& used_dimensions) {
-  const auto& it = node_indices_.find(used_dimensions);
+int ArcFlowBuilder::GetOrCreateNode(absl::Span<const int> used_dimensions) {
+  tmp_node_.assign(used_dimensions.begin(), used_dimensions.end());
+  const auto& it = node_indices_.find(tmp_node_);
   if (it != node_indices_.end()) {
     return it->second;
   }
   const int index = node_indices_.size();
-  node_indices_[used_dimensions] = index;
-  nodes_.push_back(used_dimensions);
+  node_indices_[tmp_node_] = index;
+  nodes_.push_back(tmp_node_);
   return index;
 }
 
 ArcFlowGraph ArcFlowBuilder::BuildVectorBinPackingGraph() {
   // Initialize the DP states map.
+  const DpStateSet empty_set(0, DpStateHash{this}, DpStateEq{this});
   dp_state_index_.resize(items_.size());
   for (int i = 0; i < items_.size(); ++i) {
-    dp_state_index_[i].resize(items_[i].demand + 1);
+    dp_state_index_[i].resize(items_[i].demand + 1, empty_set);
   }
 
   // Explore all possible DP states (starting from the initial 'empty' state),
   // and remember their ancestry.
-  std::vector<int> zero(bin_dimensions_.size(), 0);
-  dp_states_.push_back(new DpState({0, 0, zero, -1, -1}));
+  dp_states_.push_back({0, 0, -1, -1});
+  dp_dimensions_.assign(bin_dimensions_.size(), 0);
   for (int i = 0; i < dp_states_.size(); ++i) {
-    ForwardCreationPass(dp_states_[i]);
+    ForwardCreationPass(i);
   }
 
   // We can clear the dp_state_index map as it will not be used anymore.
-  // From now on, we will use the dp_states.used_dimensions to store the new
-  // labels in the backward pass.
+  // From now on, we will use the DpDimensions() to store the new labels in
+  // the backward pass.
   const int64_t num_dp_states = NumDpStates();
-  dp_state_index_.clear();
+  gtl::STLClearObject(&dp_state_index_);
 
   // Backwards pass: "push" the bin dimensions as far as possible.
   const int num_states = dp_states_.size();
   std::vector<std::pair<int, int>> flat_deps;
   for (int i = 0; i < dp_states_.size(); ++i) {
-    if (dp_states_[i]->up_child != -1) {
-      flat_deps.push_back(std::make_pair(dp_states_[i]->up_child, i));
+    if (dp_states_[i].up_child != -1) {
+      flat_deps.push_back(std::make_pair(dp_states_[i].up_child, i));
     }
-    if (dp_states_[i]->right_child != -1) {
-      flat_deps.push_back(std::make_pair(dp_states_[i]->right_child, i));
+    if (dp_states_[i].right_child != -1) {
+      flat_deps.push_back(std::make_pair(dp_states_[i].right_child, i));
     }
   }
   const std::vector<int> sorted_work =
       util::graph::DenseIntStableTopologicalSortOrDie(num_states, flat_deps);
+  gtl::STLClearObject(&flat_deps);
   for (const int w : sorted_work) {
     BackwardCompressionPass(w);
   }
+  SortAndRemoveDuplicateArcs(&arcs_);
 
   // ForwardCreationPass again, push the bin dimensions as low as possible.
-  const std::vector<int> source_node = dp_states_[0]->used_dimensions;
-  // We can now delete the states stored in dp_states_.
-  gtl::STLDeleteElements(&dp_states_);
+  const absl::Span<const int> source_dimensions = DpDimensions(0);
+  const std::vector<int> source_node(source_dimensions.begin(),
+                                     source_dimensions.end());
+  // We can now delete the states.
+  gtl::STLClearObject(&dp_states_);
+  gtl::STLClearObject(&dp_dimensions_);
   ForwardCompressionPass(source_node);
 
   // We need to connect all nodes that corresponds to at least one item selected
   // to the sink node.
   const int sink_node_index = nodes_.size() - 1;
   for (int node = 1; node < sink_node_index; ++node) {
-    arcs_.insert({node, sink_node_index, -1});
+    arcs_.push_back({node, sink_node_index, -1});
   }
+  SortAndRemoveDuplicateArcs(&arcs_);
 
   ArcFlowGraph result;
   result.arcs.assign(arcs_.begin(), arcs_.end());
@@ -241,53 +292,59 @@ ArcFlowGraph ArcFlowBuilder::BuildVectorBinPackingGraph() {
 
 int ArcFlowBuilder::LookupOrCreateDpState(
     int item, int quantity, const std::vector<int>& used_dimensions) {
-  VectorIntIntMap& map = dp_state_index_[item][quantity];
-  const int index =
-      map.insert({used_dimensions, dp_states_.size()}).first->second;
-  if (index == dp_states_.size()) {
-    dp_states_.push_back(
-        new DpState({item, quantity, used_dimensions, -1, -1}));
-  }
+  DpStateSet& set = dp_state_index_[item][quantity];
+  const auto it = set.find(absl::MakeConstSpan(used_dimensions));
+  if (it != set.end()) return *it;
+  const int index = dp_states_.size();
+  dp_states_.push_back({item, quantity, -1, -1});
+  dp_dimensions_.insert(dp_dimensions_.end(), used_dimensions.begin(),
+                        used_dimensions.end());
+  set.insert(index);
   return index;
 }
 
-void ArcFlowBuilder::ForwardCreationPass(DpState* dp_state) {
-  const int item = dp_state->cur_item_index;
-  const int quantity = dp_state->cur_item_quantity;
-  const std::vector<int>& used_dimensions = dp_state->used_dimensions;
+void ArcFlowBuilder::ForwardCreationPass(int state_index) {
+  const int item = dp_states_[state_index].cur_item_index;
+  const int quantity = dp_states_[state_index].cur_item_quantity;
+
+  // We need a copy since creating new states may reallocate dp_dimensions_.
+  const absl::Span<const int> used_dimensions = DpDimensions(state_index);
+  tmp_dimensions_.assign(used_dimensions.begin(), used_dimensions.end());
 
   // Explore path up.
+  int up_child = -1;
   if (item < items_.size() - 1) {
-    dp_state->up_child = LookupOrCreateDpState(item + 1, 0, used_dimensions);
-  } else {
-    dp_state->up_child = -1;
+    up_child = LookupOrCreateDpState(item + 1, 0, tmp_dimensions_);
   }
 
   // Explore path right.
-  if (quantity < items_[item].demand && CanFitNewItem(used_dimensions, item)) {
-    const std::vector<int> added = AddItem(used_dimensions, item);
-    dp_state->right_child = LookupOrCreateDpState(item, quantity + 1, added);
-  } else {
-    dp_state->right_child = -1;
+  int right_child = -1;
+  if (quantity < items_[item].demand && CanFitNewItem(tmp_dimensions_, item)) {
+    for (int d = 0; d < bin_dimensions_.size(); ++d) {
+      tmp_dimensions_[d] += items_[item].dimensions[d];
+    }
+    right_child = LookupOrCreateDpState(item, quantity + 1, tmp_dimensions_);
   }
+
+  dp_states_[state_index].up_child = up_child;
+  dp_states_[state_index].right_child = right_child;
 }
 
 void ArcFlowBuilder::BackwardCompressionPass(int state_index) {
   // The goal of this function is to fill this.
-  std::vector<int>& result = dp_states_[state_index]->used_dimensions;
+  const absl::Span<int> result = DpDimensions(state_index);
+  const DpState& state = dp_states_[state_index];
 
   // Inherit our result from the result one step up.
-  const int up_index = dp_states_[state_index]->up_child;
-  const std::vector<int>& result_up =
-      up_index == -1 ? bin_dimensions_ : dp_states_[up_index]->used_dimensions;
-  result = result_up;
+  const absl::Span<const int> result_up =
+      state.up_child == -1 ? absl::MakeConstSpan(bin_dimensions_)
+                           : DpDimensions(state.up_child);
+  std::copy(result_up.begin(), result_up.end(), result.begin());
 
   // Adjust our result from the result one step right.
-  const int right_index = dp_states_[state_index]->right_child;
-  if (right_index == -1) return;  // We're done.
-  const std::vector<int>& result_right =
-      dp_states_[right_index]->used_dimensions;
-  const Item& item = items_[dp_states_[state_index]->cur_item_index];
+  if (state.right_child == -1) return;  // We're done.
+  const absl::Span<const int> result_right = DpDimensions(state.right_child);
+  const Item& item = items_[state.cur_item_index];
   for (int d = 0; d < bin_dimensions_.size(); ++d) {
     result[d] = std::min(result[d], result_right[d] - item.dimensions[d]);
   }
@@ -296,11 +353,11 @@ void ArcFlowBuilder::BackwardCompressionPass(int state_index) {
   const int node = GetOrCreateNode(result);
   const int right_node = GetOrCreateNode(result_right);
   DCHECK_NE(node, right_node);
-  arcs_.insert({node, right_node, item.original_index});
+  arcs_.push_back({node, right_node, item.original_index});
   // Also insert the 'dotted' arc from the node to the "up" node (if different).
-  if (result != result_up) {
+  if (absl::MakeConstSpan(result) != result_up) {
     const int up_node = GetOrCreateNode(result_up);
-    arcs_.insert({node, up_node, -1});
+    arcs_.push_back({node, up_node, -1});
   }
 }
 
@@ -312,7 +369,7 @@ void ArcFlowBuilder::ForwardCompressionPass(
     const std::vector<int>& source_node) {
   const int num_nodes = node_indices_.size();
   const int num_dims = bin_dimensions_.size();
-  std::set<ArcFlowGraph::Arc> new_arcs;
+  std::vector<ArcFlowGraph::Arc> new_arcs;
   std::vector<std::vector<int>> new_nodes;
   VectorIntIntMap new_node_indices;
   std::vector<int> node_remap(num_nodes, -1);
@@ -378,9 +435,10 @@ void ArcFlowBuilder::ForwardCompressionPass(
     if (arc.item_index == -1 &&
         node_remap[arc.source] == node_remap[arc.destination])
       continue;
-    new_arcs.insert(
+    new_arcs.push_back(
         {node_remap[arc.source], node_remap[arc.destination], arc.item_index});
   }
+  SortAndRemoveDuplicateArcs(&new_arcs);
   VLOG(1) << "Reduced nodes from " << num_nodes << " to " << new_nodes.size();
   VLOG(1) << "Reduced arcs from " << arcs_.size() << " to " << new_arcs.size();
   nodes_ = new_nodes;
@@ -59,7 +59,7 @@ struct ArcFlowGraph {
     int destination;
     int item_index;
 
-    // Needed for std::set.
+    // Needed to sort the arcs and remove the duplicates.
     bool operator<(const Arc& other) const;
   };
 
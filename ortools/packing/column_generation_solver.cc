@@ -0,0 +1,334 @@
+// Copyright 2010-2022 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ortools/packing/column_generation_solver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "absl/time/time.h"
+#include "ortools/algorithms/knapsack_solver.h"
+#include "ortools/base/logging.h"
+#include "ortools/base/timer.h"
+#include "ortools/glop/lp_solver.h"
+#include "ortools/glop/parameters.pb.h"
+#include "ortools/lp_data/lp_data.h"
+#include "ortools/lp_data/lp_types.h"
+#include "ortools/packing/vector_bin_packing.pb.h"
+
+namespace operations_research {
+namespace packing {
+
+namespace {
+
+constexpr double kEpsilon = 1e-6;
+
+// A bin pattern, as a number of copies per item type.
+struct Pattern {
+  std::vector<int> item_indices;
+  std::vector<int> item_copies;
+};
+
+// Returns the maximum number of copies of the given item in one bin.
+int64_t MaxCopiesInOneBin(const vbp::VectorBinPackingProblem& problem,
+                          int item_index) {
+  const vbp::Item& item = problem.item(item_index);
+  int64_t result = item.num_copies() + item.num_optional_copies();
+  if (item.max_number_of_copies_per_bin() > 0) {
+    result = std::min<int64_t>(result, item.max_number_of_copies_per_bin());
+  }
+  for (int d = 0; d < problem.resource_capacity_size(); ++d) {
+    const int64_t usage = item.resource_usage(d);
+    if (usage > 0) {
+      result = std::min(result, problem.resource_capacity(d) / usage);
+    }
+  }
+  return result;
+}
+
+// Fills the pattern with the maximum total dual value, and returns this value.
+// The knapsack solver works on integers, so the duals are scaled and rounded
+// down, which can make the returned pattern slightly suboptimal.
+//
+// Sets is_optimal to false if the knapsack solver hit its time limit.
+double SolvePricing(const vbp::VectorBinPackingProblem& problem,
+                    const std::vector<int64_t>& max_copies,
+                    const std::vector<double>& duals, double time_limit,
+                    Pattern* pattern, bool* is_optimal) {
+  pattern->item_indices.clear();
+  pattern->item_copies.clear();
+  *is_optimal = true;
+
+  const double max_dual = *std::max_element(duals.begin(), duals.end());
+  if (max_dual <= kEpsilon) return 0.0;
+  const double scaling = 1e9 / max_dual;
+
+  // Each copy of an item type becomes a 0-1 item of the knapsack.
+  const int num_dims = problem.resource_capacity_size();
+  std::vector<int64_t> profits;
+  std::vector<std::vector<int64_t>> weights(num_dims);
+  std::vector<int> knapsack_item_to_type;
+  for (int i = 0; i < problem.item_size(); ++i) {
+    const int64_t profit = static_cast<int64_t>(duals[i] * scaling);
+    if (profit <= 0) continue;
+    for (int c = 0; c < max_copies[i]; ++c) {
+      profits.push_back(profit);
+      for (int d = 0; d < num_dims; ++d) {
+        weights[d].push_back(problem.item(i).resource_usage(d));
+      }
+      knapsack_item_to_type.push_back(i);
+    }
+  }
+  if (profits.empty()) return 0.0;
+
+  const std::vector<int64_t> capacities(problem.resource_capacity().begin(),
+                                        problem.resource_capacity().end());
+  KnapsackSolver solver(
+      KnapsackSolver::KNAPSACK_MULTIDIMENSION_BRANCH_AND_BOUND_SOLVER,
+      "pricing");
+  solver.set_time_limit(time_limit);
+  solver.Init(profits, weights, capacities);
+  solver.Solve();
+  *is_optimal = solver.IsSolutionOptimal();
+
+  std::vector<int> copies(problem.item_size(), 0);
+  for (int k = 0; k < profits.size(); ++k) {
+    if (solver.BestSolutionContains(k)) ++copies[knapsack_item_to_type[k]];
+  }
+  double value = 0.0;
+  for (int i = 0; i < problem.item_size(); ++i) {
+    if (copies[i] == 0) continue;
+    pattern->item_indices.push_back(i);
+    pattern->item_copies.push_back(copies[i]);
+    value += duals[i] * copies[i];
+  }
+  return value;
+}
+
+}  // namespace
+
+vbp::VectorBinPackingSolution SolveVectorBinPackingWithColumnGeneration(
+    const vbp::VectorBinPackingProblem& problem,
+    MPSolver::OptimizationProblemType solver_type,
+    const std::string& mip_params, double time_limit, int num_threads,
+    int max_bins) {
+  WallTimer timer;
+  timer.Start();
+  vbp::VectorBinPackingSolution solution;
+  const int num_items = problem.item_size();
+  const double bin_cost =
+      problem.has_cost_per_bin() ? problem.cost_per_bin() : 1.0;
+
+  std::vector<int64_t> max_copies(num_items);
+  for (int i = 0; i < num_items; ++i) {
+    max_copies[i] = MaxCopiesInOneBin(problem, i);
+    if (max_copies[i] == 0 && problem.item(i).num_copies() > 0) {
+      VLOG(1) << "Item " << i << " does not fit in an empty bin";
+      solution.set_status(vbp::INFEASIBLE);
+      solution.set_solve_time_in_seconds(timer.Get());
+      return solution;
+    }
+  }
+
+  // The master problem has one row per item type: the copies covered by the
+  // selected patterns must be at least the number of copies we place. The
+  // placed copies are between num_copies and num_copies + num_optional_copies,
+  // and each missing one is penalized.
+  glop::LinearProgram lp;
+  std::vector<glop::RowIndex> item_rows(num_items);
+  double objective_offset = 0.0;
+  for (int i = 0; i < num_items; ++i) {
+    const vbp::Item& item = problem.item(i);
+    const int max_placed = item.num_copies() + item.num_optional_copies();
+    objective_offset += max_placed * item.penalty_per_missing_copy();
+    const glop::ColIndex placed = lp.CreateNewVariable();
+    lp.SetVariableBounds(placed, item.num_copies(),
+                         max_copies[i] == 0 ? 0 : max_placed);
+    lp.SetObjectiveCoefficient(placed, -item.penalty_per_missing_copy());
+    item_rows[i] = lp.CreateNewConstraint();
+    lp.SetConstraintBounds(item_rows[i], 0.0, glop::kInfinity);
+    lp.SetCoefficient(item_rows[i], placed, -1.0);
+  }
+
+  std::vector<Pattern> patterns;
+  const auto add_pattern = [&lp, &item_rows, &patterns,
+                            bin_cost](Pattern pattern) {
+    const glop::ColIndex col = lp.CreateNewVariable();
+    lp.SetVariableBounds(col, 0.0, glop::kInfinity);
+    lp.SetObjectiveCoefficient(col, bin_cost);
+    for (int j = 0; j < pattern.item_indices.size(); ++j) {
+      lp.SetCoefficient(item_rows[pattern.item_indices[j]], col,
+                        pattern.item_copies[j]);
+    }
+    patterns.push_back(std::move(pattern));
+  };
+
+  // Start with the patterns containing only one item type, so that the master
+  // problem is always feasible without max_bins.
+  for (int i = 0; i < num_items; ++i) {
+    if (max_copies[i] == 0) continue;
+    add_pattern({{i}, {static_cast<int>(max_copies[i])}});
+  }
+
+  // Column generation. We keep half of the time for the final MIP.
+  //
+  // Note that we disable the glop preprocessing, this is needed to warm-start
+  // from the previous basis after we add new columns.
+  const double column_generation_time_limit = 0.5 * time_limit;
+  glop::LPSolver lp_solver;
+  glop::GlopParameters lp_params;
+  lp_params.set_use_preprocessing(false);
+  lp_solver.SetParameters(lp_params);
+  bool converged = false;
+  double lp_bound = -std::numeric_limits<double>::infinity();
+  int num_iterations = 0;
+  std::vector<double> duals(num_items);
+  while (timer.Get() < column_generation_time_limit) {
+    lp_solver.GetMutableParameters()->set_max_time_in_seconds(
+        column_generation_time_limit - timer.Get());
+    lp.CleanUp();
+    const glop::ProblemStatus lp_status = lp_solver.Solve(lp);
+    if (lp_status != glop::ProblemStatus::OPTIMAL) {
+      VLOG(1) << "Column generation aborted, the LP status is "
+              << glop::GetProblemStatusString(lp_status);
+      break;
+    }
+    ++num_iterations;
+
+    for (int i = 0; i < num_items; ++i) {
+      duals[i] = std::max(0.0, lp_solver.dual_values()[item_rows[i]]);
+    }
+    Pattern pattern;
+    bool pricing_is_optimal;
+    const double value = SolvePricing(
+        problem, max_copies, duals, column_generation_time_limit - timer.Get(),
+        &pattern, &pricing_is_optimal);
+    if (value <= bin_cost + kEpsilon) {
+      // The LP lower bound is only valid if no pattern was missed.
+      converged = pricing_is_optimal;
+      if (converged) {
+        lp_bound = lp_solver.GetObjectiveValue() + objective_offset;
+      }
+      break;
+    }
+    add_pattern(std::move(pattern));
+  }
+  VLOG(1) << "Column generation: " << num_iterations << " iterations, "
+          << patterns.size() << " patterns, "
+          << (converged ? absl::StrCat("lp bound = ", lp_bound)
+                        : "not converged")
+          << ", time = " << timer.Get() << " s";
+
+  // Solve the master problem as a MIP over the generated patterns.
+  MPSolver solver("VectorBinPackingMaster", solver_type);
+  CHECK_OK(solver.SetNumThreads(num_threads));
+  MPObjective* const objective = solver.MutableObjective();
+  objective->SetOffset(objective_offset);
+  const double infinity = solver.infinity();
+  std::vector<MPVariable*> placed_vars(num_items);
+  std::vector<MPConstraint*> item_cts(num_items);
+  for (int i = 0; i < num_items; ++i) {
+    const vbp::Item& item = problem.item(i);
+    const int max_placed = item.num_copies() + item.num_optional_copies();
+    placed_vars[i] =
+        solver.MakeIntVar(item.num_copies(),
+                          max_copies[i] == 0 ? 0 : max_placed,
+                          absl::StrCat("placed", i));
+    objective->SetCoefficient(placed_vars[i],
+                              -item.penalty_per_missing_copy());
+    item_cts[i] = solver.MakeRowConstraint(0.0, infinity);
+    item_cts[i]->SetCoefficient(placed_vars[i], -1.0);
+  }
+  MPConstraint* const num_bins_ct =
+      max_bins > 0 ? solver.MakeRowConstraint(0.0, max_bins) : nullptr;
+  std::vector<MPVariable*> pattern_vars(patterns.size());
+  for (int k = 0; k < patterns.size(); ++k) {
+    pattern_vars[k] = solver.MakeIntVar(0.0, infinity, absl::StrCat("x", k));
+    objective->SetCoefficient(pattern_vars[k], bin_cost);
+    for (int j = 0; j < patterns[k].item_indices.size(); ++j) {
+      item_cts[patterns[k].item_indices[j]]->SetCoefficient(
+          pattern_vars[k], patterns[k].item_copies[j]);
+    }
+    if (num_bins_ct != nullptr) {
+      num_bins_ct->SetCoefficient(pattern_vars[k], 1.0);
+    }
+  }
+
+  solver.EnableOutput();
+  solver.SetSolverSpecificParametersAsString(mip_params);
+  solver.SetTimeLimit(absl::Seconds(std::max(0.0, time_limit - timer.Get())));
+  const MPSolver::ResultStatus result_status = solver.Solve();
+
+  if (result_status == MPSolver::OPTIMAL ||
+      result_status == MPSolver::FEASIBLE) {
+    // The patterns may cover more copies than we place, so we only fill each
+    // bin with the copies still to be placed, and skip bins that end up empty.
+    std::vector<int> copies_to_place(num_items);
+    double objective_value = 0.0;
+    for (int i = 0; i < num_items; ++i) {
+      const vbp::Item& item = problem.item(i);
+      copies_to_place[i] =
+          static_cast<int>(std::round(placed_vars[i]->solution_value()));
+      objective_value +=
+          (item.num_copies() + item.num_optional_copies() -
+           copies_to_place[i]) *
+          item.penalty_per_missing_copy();
+    }
+    for (int k = 0; k < patterns.size(); ++k) {
+      const int count =
+          static_cast<int>(std::round(pattern_vars[k]->solution_value()));
+      for (int b = 0; b < count; ++b) {
+        vbp::VectorBinPackingOneBinInSolution bin;
+        for (int j = 0; j < patterns[k].item_indices.size(); ++j) {
+          const int item = patterns[k].item_indices[j];
+          const int copies =
+              std::min(patterns[k].item_copies[j], copies_to_place[item]);
+          if (copies == 0) continue;
+          copies_to_place[item] -= copies;
+          bin.add_item_indices(item);
+          bin.add_item_copies(copies);
+        }
+        if (bin.item_indices().empty()) continue;
+        *solution.add_bins() = std::move(bin);
+        objective_value += bin_cost;
+      }
+    }
+    for (int i = 0; i < num_items; ++i) {
+      CHECK_EQ(copies_to_place[i], 0);
+    }
+
+    // With integer costs, the objective is integer and we can round the bound.
+    bool integer_costs = bin_cost == std::round(bin_cost);
+    for (const vbp::Item& item : problem.item()) {
+      const double penalty = item.penalty_per_missing_copy();
+      integer_costs = integer_costs && penalty == std::round(penalty);
+    }
+    const double bound =
+        integer_costs ? std::ceil(lp_bound - kEpsilon) : lp_bound;
+    solution.set_status(converged && objective_value <= bound + kEpsilon
+                            ? vbp::OPTIMAL
+                            : vbp::FEASIBLE);
+    solution.set_objective_value(objective_value);
+  }
+  solution.set_solve_time_in_seconds(timer.Get());
+  return solution;
+}
+
+}  // namespace packing
+}  // namespace operations_research
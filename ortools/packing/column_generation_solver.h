@@ -0,0 +1,58 @@
+// Copyright 2010-2022 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Column generation for the vector bin packing problem.
+//
+// Contrary to the arc-flow model, whose size grows with the number of
+// reachable bin usages, the master problem only contains the bin patterns
+// that were found useful. This scales to many more items, at the price of
+// not always proving optimality.
+//
+// The algorithm is:
+//   - The master problem selects how many bins of each pattern to use so that
+//     all the mandatory copies are covered. Its LP relaxation is solved with
+//     glop, which warm-starts from the previous basis each time new patterns
+//     are added.
+//   - The pricing problem finds the pattern with the most negative reduced
+//     cost. This is a multi-dimensional knapsack on the dual values, solved
+//     with the KnapsackSolver.
+//   - Once no more improving pattern is found, the master problem is solved
+//     as a MIP over the generated patterns (price-and-branch).
+//
+// The solution is reported as OPTIMAL only if the pricing converged and the
+// MIP objective matches the LP lower bound.
+
+#ifndef OR_TOOLS_PACKING_COLUMN_GENERATION_SOLVER_H_
+#define OR_TOOLS_PACKING_COLUMN_GENERATION_SOLVER_H_
+
+#include <string>
+
+#include "ortools/linear_solver/linear_solver.h"
+#include "ortools/packing/vector_bin_packing.pb.h"
+
+namespace operations_research {
+namespace packing {
+
+// Same arguments as SolveVectorBinPackingWithArcFlow(). The solver_type and
+// mip_params are used for the final MIP, the LP master is always solved with
+// glop.
+vbp::VectorBinPackingSolution SolveVectorBinPackingWithColumnGeneration(
+    const vbp::VectorBinPackingProblem& problem,
+    MPSolver::OptimizationProblemType solver_type,
+    const std::string& mip_params, double time_limit, int num_threads,
+    int max_bins);
+
+}  // namespace packing
+}  // namespace operations_research
+
+#endif  // OR_TOOLS_PACKING_COLUMN_GENERATION_SOLVER_H_
@@ -688,6 +688,8 @@ class Solver {
   // computing `cumulative_time_sec` in iteration stats.
   double preprocessing_time_sec_;
   WallTimer timer_;
+  // The part of `timer_` spent in `ChooseRestartToApply()`.
+  double restart_evaluation_time_sec_ = 0.0;
   int iterations_completed_;
   int num_rejected_steps_;
   // A cache of `constraint_matrix.transpose() * current_dual_solution_`.
@@ -1057,8 +1059,12 @@ SolverResult PreprocessSolver::PreprocessAndSolve(
   }
 
   double step_size = 0.0;
-  if (params.linesearch_rule() ==
-      PrimalDualHybridGradientParams::CONSTANT_STEP_SIZE_RULE) {
+  if (params.has_initial_step_size()) {
+    // This also skips the singular value estimation of the constant step size
+    // rule, which can be expensive.
+    step_size = params.initial_step_size();
+  } else if (params.linesearch_rule() ==
+             PrimalDualHybridGradientParams::CONSTANT_STEP_SIZE_RULE) {
     std::mt19937 random(1);
     double inverse_step_size;
     const auto lipschitz_result =
@@ -1090,7 +1096,9 @@ SolverResult PreprocessSolver::PreprocessAndSolve(
             1.0e-20,
             solve_log.preprocessed_problem_stats().constraint_matrix_abs_max());
   }
-  step_size *= params.initial_step_size_scaling();
+  if (!params.has_initial_step_size()) {
+    step_size *= params.initial_step_size_scaling();
+  }
 
   const double primal_weight = InitialPrimalWeight(
       params, solve_log.preprocessed_problem_stats().objective_vector_l2_norm(),
@@ -1689,17 +1697,29 @@ Solver::NextSolutionAndDelta Solver::ComputeNextPrimalSolution(
                   .cwiseQuotient(diagonal_scaling)
                   .cwiseMin(shard(qp.variable_upper_bounds))
                   .cwiseMax(shard(qp.variable_lower_bounds));
+          shard(result.delta) =
+              shard(result.value) - shard(current_primal_solution_);
         } else {
           // The formula in the LP case is simplified for better performance.
-          shard(result.value) =
-              (shard(current_primal_solution_) -
-               primal_step_size *
-                   (shard(qp.objective_vector) - shard(current_dual_product_)))
-                  .cwiseMin(shard(qp.variable_upper_bounds))
-                  .cwiseMax(shard(qp.variable_lower_bounds));
+          // `value` and `delta` are computed in a single pass, so that the
+          // shard of `value` is not read back from memory.
+          auto value = shard(result.value);
+          auto delta = shard(result.delta);
+          const auto current = shard(current_primal_solution_);
+          const auto objective = shard(qp.objective_vector);
+          const auto dual_product = shard(current_dual_product_);
+          const auto lower_bounds = shard(qp.variable_lower_bounds);
+          const auto upper_bounds = shard(qp.variable_upper_bounds);
+          for (int64_t i = 0; i < value.size(); ++i) {
+            const double gradient = objective[i] - dual_product[i];
+            const double next =
+                std::max(std::min(current[i] - primal_step_size * gradient,
+                                  upper_bounds[i]),
+                         lower_bounds[i]);
+            value[i] = next;
+            delta[i] = next - current[i];
+          }
         }
-        shard(result.delta) =
-            shard(result.value) - shard(current_primal_solution_);
       });
   return result;
 }
@@ -1735,14 +1755,22 @@ Solver::NextSolutionAndDelta Solver::ComputeNextDualSolution(
         // of the respective 1D minimization problem if it's negative.
         // Likewise the argument to the `.cwiseMax()` is the critical point if
         // positive.
-        shard(result.value) =
-            VectorXd::Zero(temp.size())
-                .cwiseMin(temp +
-                          dual_step_size * shard(qp.constraint_upper_bounds))
-                .cwiseMax(temp +
-                          dual_step_size * shard(qp.constraint_lower_bounds));
-        shard(result.delta) =
-            (shard(result.value) - shard(current_dual_solution_));
+        // `value` and `delta` are computed in a single pass.
+        auto value = shard(result.value);
+        auto delta = shard(result.delta);
+        const auto current = shard(current_dual_solution_);
+        const auto lower_bounds = shard(qp.constraint_lower_bounds);
+        const auto upper_bounds = shard(qp.constraint_upper_bounds);
+        for (int64_t i = 0; i < value.size(); ++i) {
+          const double upper_critical_point =
+              temp[i] + dual_step_size * upper_bounds[i];
+          const double lower_critical_point =
+              temp[i] + dual_step_size * lower_bounds[i];
+          const double next = std::max(std::min(0.0, upper_critical_point),
+                                       lower_critical_point);
+          value[i] = next;
+          delta[i] = next - current[i];
+        }
       });
   return result;
 }
@@ -1786,6 +1814,8 @@ IterationStats Solver::CreateSimpleIterationStats(
                                          num_kkt_passes_per_rejected_step *
                                              num_rejected_steps_);
   stats.set_cumulative_time_sec(preprocessing_time_sec_ + timer_.Get());
+  stats.set_cumulative_restart_evaluation_time_sec(
+      restart_evaluation_time_sec_);
   stats.set_restart_used(restart_used);
   stats.set_step_size(step_size_);
   stats.set_primal_weight(primal_weight_);
@@ -1816,10 +1846,15 @@ LocalizedLagrangianBounds Solver::ComputeLocalizedBoundsAtCurrent() const {
 }
 
 LocalizedLagrangianBounds Solver::ComputeLocalizedBoundsAtAverage() const {
-  // TODO(user): These vectors are recomputed again for termination checks
-  // and again if we eventually restart to the average.
-  VectorXd average_primal = PrimalAverage();
-  VectorXd average_dual = DualAverage();
+  // Like `PrimalAverage()` and `DualAverage()`, but without copies.
+  // TODO(user): The averages are still copied for termination checks and
+  // again if we eventually restart to the average.
+  const VectorXd& average_primal = primal_average_.HasNonzeroWeight()
+                                       ? primal_average_.average()
+                                       : current_primal_solution_;
+  const VectorXd& average_dual = dual_average_.HasNonzeroWeight()
+                                     ? dual_average_.average()
+                                     : current_dual_solution_;
 
   const double distance_traveled_by_average =
       DistanceTraveledFromLastStart(average_primal, average_dual);
@@ -1875,8 +1910,8 @@ RestartChoice Solver::DetermineDistanceBasedRestartChoice() const {
   }
   const int restart_period_length = primal_average_.NumTerms();
   const double distance_moved_this_restart_period_by_average =
-      DistanceTraveledFromLastStart(primal_average_.ComputeAverage(),
-                                    dual_average_.ComputeAverage());
+      DistanceTraveledFromLastStart(primal_average_.average(),
+                                    dual_average_.average());
   const double distance_moved_last_restart_period =
       distance_based_restart_info_.distance_moved_last_restart_period;
 
@@ -2136,9 +2171,12 @@ std::optional<SolverResult> Solver::MajorIterationAndTerminationCheck(
       major_iteration_cycle == 0 && iterations_completed_ > 0;
   // Just decide what to do for now. The actual restart, if any, is
   // performed after the termination check.
-  const RestartChoice restart = force_numerical_termination
-                                    ? RESTART_CHOICE_NO_RESTART
-                                    : ChooseRestartToApply(is_major_iteration);
+  RestartChoice restart = RESTART_CHOICE_NO_RESTART;
+  if (!force_numerical_termination) {
+    const double start_time_sec = timer_.Get();
+    restart = ChooseRestartToApply(is_major_iteration);
+    restart_evaluation_time_sec_ += timer_.Get() - start_time_sec;
+  }
   IterationStats stats = CreateSimpleIterationStats(restart);
   IterationStats full_work_stats =
       AddWorkStats(stats, work_from_feasibility_polishing);
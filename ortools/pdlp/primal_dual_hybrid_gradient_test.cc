@@ -896,6 +896,27 @@ TEST(PrimalDualHybridGradientTest, StepSizeScaling) {
             initial_step_size * kStepSizeScaling);
 }
 
+TEST(PrimalDualHybridGradientTest, InitialStepSize) {
+  const int iteration_limit = 10;
+  const double kInitialStepSize = 0.25;
+  PrimalDualHybridGradientParams params = ParamsWithNoLimits();
+  params.mutable_termination_criteria()->set_iteration_limit(iteration_limit);
+  params.set_termination_check_frequency(1);
+  params.set_linesearch_rule(
+      PrimalDualHybridGradientParams::CONSTANT_STEP_SIZE_RULE);
+  params.set_initial_step_size(kInitialStepSize);
+  // Ignored since `initial_step_size` is set.
+  params.set_initial_step_size_scaling(0.5);
+
+  SolverResult output = PrimalDualHybridGradient(TestLp(), params);
+
+  ASSERT_FALSE(output.solve_log.iteration_stats().empty());
+  for (const auto& stats : output.solve_log.iteration_stats()) {
+    EXPECT_EQ(stats.step_size(), kInitialStepSize)
+        << "iteration = " << stats.iteration_number();
+  }
+}
+
 // This verifies that `kkt_matrix_pass_limit` is checked every iteration.
 TEST(PrimalDualHybridGradientTest, KktMatrixPassTermination) {
   const int kkt_matrix_pass_limit = 13;
@@ -65,6 +65,10 @@ class ShardedWeightedAverage {
   // zero if `HasNonzeroWeight()` is false.
   Eigen::VectorXd ComputeAverage() const;
 
+  // Like `ComputeAverage()`, but returns a reference to the internal vector
+  // instead of a copy. The reference is invalidated by `Add()` and `Clear()`.
+  const Eigen::VectorXd& average() const { return average_; }
+
   int NumTerms() const { return num_terms_; }
 
  private:
@@ -52,6 +52,7 @@ TEST(ShardedWeightedAverageTest, SimpleAverage) {
   EXPECT_EQ(average.NumTerms(), 2);
 
   EXPECT_THAT(average.ComputeAverage(), ElementsAre(2.0, 5.0));
+  EXPECT_THAT(average.average(), ElementsAre(2.0, 5.0));
 
   average.Clear();
   EXPECT_FALSE(average.HasNonzeroWeight());
@@ -298,13 +298,15 @@ VectorXd ScaledColLInfNorm(
   sharder.ParallelForEachShard([&](const Sharder::Shard& shard) {
     auto matrix_shard = shard(matrix);
     auto col_scaling_shard = shard(col_scaling_vec);
-    for (int64_t col_num = 0; col_num < shard(matrix).outerSize(); ++col_num) {
+    auto answer_shard = shard(answer);
+    const int64_t num_cols = matrix_shard.outerSize();
+    for (int64_t col_num = 0; col_num < num_cols; ++col_num) {
       double max = 0.0;
       for (decltype(matrix_shard)::InnerIterator it(matrix_shard, col_num); it;
            ++it) {
         max = std::max(max, std::abs(it.value() * row_scaling_vec[it.row()]));
       }
-      shard(answer)[col_num] = max * std::abs(col_scaling_shard[col_num]);
+      answer_shard[col_num] = max * std::abs(col_scaling_shard[col_num]);
     }
   });
   return answer;
@@ -320,14 +322,16 @@ VectorXd ScaledColL2Norm(
   sharder.ParallelForEachShard([&](const Sharder::Shard& shard) {
     auto matrix_shard = shard(matrix);
     auto col_scaling_shard = shard(col_scaling_vec);
-    for (int64_t col_num = 0; col_num < shard(matrix).outerSize(); ++col_num) {
+    auto answer_shard = shard(answer);
+    const int64_t num_cols = matrix_shard.outerSize();
+    for (int64_t col_num = 0; col_num < num_cols; ++col_num) {
       double sum_of_squares = 0.0;
       for (decltype(matrix_shard)::InnerIterator it(matrix_shard, col_num); it;
            ++it) {
         sum_of_squares +=
             MathUtil::Square(it.value() * row_scaling_vec[it.row()]);
       }
-      shard(answer)[col_num] =
+      answer_shard[col_num] =
           std::sqrt(sum_of_squares) * std::abs(col_scaling_shard[col_num]);
     }
   });
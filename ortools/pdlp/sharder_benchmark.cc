@@ -0,0 +1,109 @@
+// Copyright 2010-2022 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Micro-benchmarks of the sharded vector and matrix kernels used by PDHG.
+// The first argument is the size, the second one the number of threads. The
+// work is done by the thread pool, so the wall time is reported.
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "Eigen/Core"
+#include "Eigen/SparseCore"
+#include "benchmark/benchmark.h"
+#include "ortools/base/threadpool.h"
+#include "ortools/pdlp/sharder.h"
+
+namespace operations_research::pdlp {
+namespace {
+
+using ::Eigen::VectorXd;
+
+constexpr int kShardsPerThread = 4;
+constexpr int kNonZerosPerColumn = 10;
+
+// Random square matrix with kNonZerosPerColumn entries per column.
+Eigen::SparseMatrix<double, Eigen::ColMajor, int64_t> RandomSparseMatrix(
+    int64_t size) {
+  std::mt19937 random(12345);
+  std::uniform_real_distribution<double> value(-1.0, 1.0);
+  std::vector<Eigen::Triplet<double, int64_t>> triplets;
+  triplets.reserve(size * kNonZerosPerColumn);
+  for (int64_t col = 0; col < size; ++col) {
+    for (int k = 0; k < kNonZerosPerColumn; ++k) {
+      triplets.emplace_back(random() % size, col, value(random));
+    }
+  }
+  Eigen::SparseMatrix<double, Eigen::ColMajor, int64_t> matrix(size, size);
+  matrix.setFromTriplets(triplets.begin(), triplets.end());
+  return matrix;
+}
+
+void BM_ParallelForEachShard(benchmark::State& state) {
+  const int64_t size = state.range(0);
+  const int num_threads = state.range(1);
+  ThreadPool pool("BM_ParallelForEachShard", num_threads);
+  pool.StartWorkers();
+  const Sharder sharder(size, kShardsPerThread * num_threads, &pool);
+  VectorXd vector = VectorXd::Ones(size);
+  for (auto _ : state) {
+    sharder.ParallelForEachShard([&](const Sharder::Shard& shard) {
+      shard(vector) *= 1.000001;
+    });
+    benchmark::DoNotOptimize(vector.data());
+  }
+  state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_ParallelForEachShard)
+    ->ArgsProduct({{1000, 100000, 10000000}, {1, 4}})
+    ->UseRealTime();
+
+void BM_Dot(benchmark::State& state) {
+  const int64_t size = state.range(0);
+  const int num_threads = state.range(1);
+  ThreadPool pool("BM_Dot", num_threads);
+  pool.StartWorkers();
+  const Sharder sharder(size, kShardsPerThread * num_threads, &pool);
+  const VectorXd v1 = VectorXd::Random(size);
+  const VectorXd v2 = VectorXd::Random(size);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Dot(v1, v2, sharder));
+  }
+  state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_Dot)
+    ->ArgsProduct({{1000, 100000, 10000000}, {1, 4}})
+    ->UseRealTime();
+
+void BM_TransposedMatrixVectorProduct(benchmark::State& state) {
+  const int64_t size = state.range(0);
+  const int num_threads = state.range(1);
+  const Eigen::SparseMatrix<double, Eigen::ColMajor, int64_t> matrix =
+      RandomSparseMatrix(size);
+  ThreadPool pool("BM_TransposedMatrixVectorProduct", num_threads);
+  pool.StartWorkers();
+  const Sharder sharder(matrix, kShardsPerThread * num_threads, &pool);
+  const VectorXd vector = VectorXd::Random(size);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        TransposedMatrixVectorProduct(matrix, vector, sharder));
+  }
+  state.SetItemsProcessed(state.iterations() * matrix.nonZeros());
+}
+BENCHMARK(BM_TransposedMatrixVectorProduct)
+    ->ArgsProduct({{1000, 100000, 1000000}, {1, 4}})
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace operations_research::pdlp
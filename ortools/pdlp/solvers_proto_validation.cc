@@ -264,6 +264,16 @@ absl::Status ValidatePrimalDualHybridGradientParams(
         absl::StrCat("initial_step_size_scaling must be between ", kTinyDouble,
                      " and ", kHugeDouble));
   }
+  if (std::isnan(params.initial_step_size())) {
+    return InvalidArgumentError("initial_step_size is NAN");
+  }
+  if (params.has_initial_step_size() &&
+      (params.initial_step_size() <= kTinyDouble ||
+       params.initial_step_size() >= kHugeDouble)) {
+    return InvalidArgumentError(
+        absl::StrCat("initial_step_size must be between ", kTinyDouble, " and ",
+                     kHugeDouble, " if specified"));
+  }
 
   if (std::isnan(params.infinite_constraint_bound_threshold())) {
     return InvalidArgumentError("infinite_constraint_bound_threshold is NAN");
@@ -628,6 +628,29 @@ TEST(ValidatePrimalDualHybridGradientParams, BadInitialStepSizeScaling) {
   EXPECT_THAT(status_huge.message(), HasSubstr("initial_step_size_scaling"));
 }
 
+TEST(ValidatePrimalDualHybridGradientParams, BadInitialStepSize) {
+  PrimalDualHybridGradientParams params_negative;
+  params_negative.set_initial_step_size(-1.0);
+  const absl::Status status_negative =
+      ValidatePrimalDualHybridGradientParams(params_negative);
+  EXPECT_EQ(status_negative.code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_THAT(status_negative.message(), HasSubstr("initial_step_size"));
+
+  PrimalDualHybridGradientParams params_nan;
+  params_nan.set_initial_step_size(std::numeric_limits<double>::quiet_NaN());
+  const absl::Status status_nan =
+      ValidatePrimalDualHybridGradientParams(params_nan);
+  EXPECT_EQ(status_nan.code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_THAT(status_nan.message(), HasSubstr("initial_step_size"));
+
+  PrimalDualHybridGradientParams params_huge;
+  params_huge.set_initial_step_size(1.0e300);
+  const absl::Status status_huge =
+      ValidatePrimalDualHybridGradientParams(params_huge);
+  EXPECT_EQ(status_huge.code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_THAT(status_huge.message(), HasSubstr("initial_step_size"));
+}
+
 TEST(ValidatePrimalDualHybridGradientParams,
      BadInfiniteConstraintBoundThreshold) {
   PrimalDualHybridGradientParams params_negative;
@@ -0,0 +1,211 @@
+// Copyright 2010-2022 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ortools/routing/instance_snapshot.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/status.h"
+#include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "ortools/base/file.h"
+#include "ortools/base/logging.h"
+
+namespace operations_research {
+namespace {
+
+// Layout of a snapshot file:
+//   kMagic
+//   uint64_t number of entries
+//   for each entry: uint64_t name size, name, int64_t rows, int64_t columns
+//   the values of all the entries, in the same order, row by row.
+constexpr absl::string_view kMagic = "ORRSNAP1";
+
+template <typename T>
+void AppendRaw(const T& value, std::string* out) {
+  out->append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+// Reads sizeof(T) bytes at *pos in data, and advances *pos. Returns false if
+// the data is too short.
+template <typename T>
+bool ReadRaw(absl::string_view data, size_t* pos, T* value) {
+  if (data.size() - *pos < sizeof(T)) return false;
+  std::memcpy(value, data.data() + *pos, sizeof(T));
+  *pos += sizeof(T);
+  return true;
+}
+
+}  // namespace
+
+void RoutingInstanceSnapshot::SetMatrix(
+    absl::string_view name, const std::vector<std::vector<int64_t>>& matrix) {
+  const int num_rows = matrix.size();
+  const int num_cols = matrix.empty() ? 0 : matrix[0].size();
+  int64_t* values = AllocateEntry(name, num_rows, num_cols);
+  for (const std::vector<int64_t>& row : matrix) {
+    CHECK_EQ(static_cast<int>(row.size()), num_cols);
+    values = std::copy(row.begin(), row.end(), values);
+  }
+}
+
+void RoutingInstanceSnapshot::SetNodeValues(absl::string_view name,
+                                            absl::Span<const int64_t> values) {
+  std::copy(values.begin(), values.end(),
+            AllocateEntry(name, 1, values.size()));
+}
+
+std::vector<std::vector<int64_t>> RoutingInstanceSnapshot::GetMatrix(
+    absl::string_view name) const {
+  const Entry& entry = GetEntry(name);
+  std::vector<std::vector<int64_t>> matrix(entry.num_rows);
+  const int64_t* values = values_.data() + entry.offset;
+  for (int row = 0; row < entry.num_rows; ++row) {
+    matrix[row].assign(values, values + entry.num_cols);
+    values += entry.num_cols;
+  }
+  return matrix;
+}
+
+absl::Status RoutingInstanceSnapshot::WriteToFile(
+    absl::string_view file_name) const {
+  int64_t num_values = 0;
+  for (const std::string& name : names_) {
+    const Entry& entry = entries_.at(name);
+    num_values += int64_t{entry.num_rows} * entry.num_cols;
+  }
+  std::string data(kMagic);
+  data.reserve(data.size() + 64 * names_.size() +
+               num_values * sizeof(int64_t));
+  AppendRaw(static_cast<uint64_t>(names_.size()), &data);
+  for (const std::string& name : names_) {
+    const Entry& entry = entries_.at(name);
+    AppendRaw(static_cast<uint64_t>(name.size()), &data);
+    data.append(name);
+    AppendRaw(static_cast<int64_t>(entry.num_rows), &data);
+    AppendRaw(static_cast<int64_t>(entry.num_cols), &data);
+  }
+  // Entries that were overwritten by a Set*() call leave holes in values_,
+  // so the values are written entry by entry.
+  for (const std::string& name : names_) {
+    const Entry& entry = entries_.at(name);
+    data.append(reinterpret_cast<const char*>(values_.data() + entry.offset),
+                int64_t{entry.num_rows} * entry.num_cols * sizeof(int64_t));
+  }
+  return file::SetContents(file_name, data, file::Defaults());
+}
+
+absl::Status RoutingInstanceSnapshot::LoadFromFile(
+    absl::string_view file_name) {
+  Clear();
+  std::string data;
+  const absl::Status status =
+      file::GetContents(file_name, &data, file::Defaults());
+  if (!status.ok()) return status;
+
+  const auto corrupted = [file_name](absl::string_view reason) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Invalid routing snapshot ", file_name, ": ", reason));
+  };
+  if (!absl::StartsWith(data, kMagic)) return corrupted("wrong header");
+  size_t pos = kMagic.size();
+  uint64_t num_entries = 0;
+  if (!ReadRaw(data, &pos, &num_entries)) return corrupted("truncated");
+  // No valid file can have more values than this, which also guarantees that
+  // the computations below do not overflow.
+  const int64_t max_num_values = data.size() / sizeof(int64_t);
+  int64_t num_values = 0;
+  for (uint64_t e = 0; e < num_entries; ++e) {
+    uint64_t name_size = 0;
+    if (!ReadRaw(data, &pos, &name_size) || data.size() - pos < name_size) {
+      Clear();
+      return corrupted("truncated");
+    }
+    std::string name(data.data() + pos, name_size);
+    pos += name_size;
+    int64_t num_rows = 0;
+    int64_t num_cols = 0;
+    if (!ReadRaw(data, &pos, &num_rows) || !ReadRaw(data, &pos, &num_cols)) {
+      Clear();
+      return corrupted("truncated");
+    }
+    constexpr int64_t kMaxSize = std::numeric_limits<int>::max();
+    if (num_rows < 0 || num_cols < 0 || num_rows > kMaxSize ||
+        num_cols > kMaxSize || entries_.contains(name)) {
+      Clear();
+      return corrupted(absl::StrCat("invalid entry '", name, "'"));
+    }
+    if (num_cols > 0 && num_rows > (max_num_values - num_values) / num_cols) {
+      Clear();
+      return corrupted("wrong number of values");
+    }
+    entries_[name] = {num_values, static_cast<int>(num_rows),
+                      static_cast<int>(num_cols)};
+    names_.push_back(std::move(name));
+    num_values += num_rows * num_cols;
+  }
+  if ((data.size() - pos) != num_values * sizeof(int64_t)) {
+    Clear();
+    return corrupted("wrong number of values");
+  }
+  values_.resize(num_values);
+  std::memcpy(values_.data(), data.data() + pos,
+              num_values * sizeof(int64_t));
+  return absl::OkStatus();
+}
+
+void RoutingInstanceSnapshot::Clear() {
+  values_.clear();
+  names_.clear();
+  entries_.clear();
+}
+
+int64_t* RoutingInstanceSnapshot::AllocateEntry(absl::string_view name,
+                                                int num_rows, int num_cols) {
+  CHECK_GE(num_rows, 0);
+  CHECK_GE(num_cols, 0);
+  const int64_t size = int64_t{num_rows} * num_cols;
+  auto [it, inserted] = entries_.try_emplace(name);
+  Entry& entry = it->second;
+  if (inserted) {
+    names_.push_back(std::string(name));
+  } else if (int64_t{entry.num_rows} * entry.num_cols == size) {
+    // Reuse the storage of the previous entry.
+    entry.num_rows = num_rows;
+    entry.num_cols = num_cols;
+    return values_.data() + entry.offset;
+  }
+  entry.offset = values_.size();
+  entry.num_rows = num_rows;
+  entry.num_cols = num_cols;
+  values_.resize(values_.size() + size);
+  return values_.data() + entry.offset;
+}
+
+const RoutingInstanceSnapshot::Entry& RoutingInstanceSnapshot::GetEntry(
+    absl::string_view name) const {
+  const auto it = entries_.find(name);
+  CHECK(it != entries_.end()) << "Unknown snapshot entry: " << name;
+  return it->second;
+}
+
+}  // namespace operations_research
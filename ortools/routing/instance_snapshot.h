@@ -0,0 +1,135 @@
+// Copyright 2010-2022 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Binary snapshot of a parsed routing instance.
+//
+// The text parsers (TSPLIB, Solomon, CARP, ...) and the distance computations
+// from coordinates are slow to repeat when the same instances are reloaded
+// many times, e.g. by a benchmarking harness. A snapshot stores the integer
+// data of an instance once it has been parsed and precomputed: named dense
+// matrices (distances, travel times, ...) and named per-node vectors
+// (demands, time windows, service times, ...). Reloading it is a single file
+// read followed by a copy into a flat buffer.
+//
+// Typical usage:
+//   TspLibParser parser;
+//   parser.LoadFile(file_name);
+//   RoutingInstanceSnapshot snapshot;
+//   snapshot.SetMatrix("distance", parser.size(), parser.GetEdgeWeights());
+//   snapshot.SetNodeValues("demand", parser.demands());
+//   CHECK_OK(snapshot.WriteToFile(snapshot_name));
+//
+//   // Later, possibly in another process:
+//   RoutingInstanceSnapshot snapshot;
+//   CHECK_OK(snapshot.LoadFromFile(snapshot_name));
+//   const int distance =
+//       routing.RegisterTransitMatrix(snapshot.GetMatrix("distance"));
+//
+// The file stores integers in the native byte order; snapshots are meant to
+// be cached on the machine that created them, not exchanged.
+
+#ifndef OR_TOOLS_ROUTING_INSTANCE_SNAPSHOT_H_
+#define OR_TOOLS_ROUTING_INSTANCE_SNAPSHOT_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "ortools/base/logging.h"
+
+namespace operations_research {
+
+class RoutingInstanceSnapshot {
+ public:
+  RoutingInstanceSnapshot() = default;
+
+  // Stores the num_nodes x num_nodes matrix evaluator(i, j), replacing any
+  // previous entry with the same name. The evaluator is called once per pair,
+  // which is where the time is saved when it computes distances from
+  // coordinates.
+  template <typename Evaluator>
+  void SetMatrix(absl::string_view name, int num_nodes,
+                 const Evaluator& evaluator) {
+    int64_t* values = AllocateEntry(name, num_nodes, num_nodes);
+    for (int i = 0; i < num_nodes; ++i) {
+      for (int j = 0; j < num_nodes; ++j) {
+        *values++ = evaluator(i, j);
+      }
+    }
+  }
+  void SetMatrix(absl::string_view name,
+                 const std::vector<std::vector<int64_t>>& matrix);
+
+  // Stores one value per node, replacing any previous entry with the same
+  // name.
+  void SetNodeValues(absl::string_view name, absl::Span<const int64_t> values);
+
+  bool HasEntry(absl::string_view name) const {
+    return entries_.contains(name);
+  }
+  // Number of rows/columns of the matrix 'name'. Node values have one row.
+  int NumRows(absl::string_view name) const { return GetEntry(name).num_rows; }
+  int NumCols(absl::string_view name) const { return GetEntry(name).num_cols; }
+
+  // Returns a row of the matrix 'name', or the node values when 'name' was
+  // set with SetNodeValues() and row is 0. The span is invalidated by any
+  // call to a Set*() or Load*() method.
+  absl::Span<const int64_t> Row(absl::string_view name, int row) const {
+    const Entry& entry = GetEntry(name);
+    DCHECK_GE(row, 0);
+    DCHECK_LT(row, entry.num_rows);
+    return absl::MakeConstSpan(
+        values_.data() + entry.offset + int64_t{row} * entry.num_cols,
+        entry.num_cols);
+  }
+  absl::Span<const int64_t> NodeValues(absl::string_view name) const {
+    return Row(name, 0);
+  }
+
+  // Returns the matrix 'name' in the format expected by
+  // RoutingModel::RegisterTransitMatrix().
+  std::vector<std::vector<int64_t>> GetMatrix(absl::string_view name) const;
+
+  absl::Status WriteToFile(absl::string_view file_name) const;
+  // Replaces the content of the snapshot by the one of the file.
+  absl::Status LoadFromFile(absl::string_view file_name);
+
+  void Clear();
+
+ private:
+  struct Entry {
+    int64_t offset = 0;
+    int num_rows = 0;
+    int num_cols = 0;
+  };
+
+  // Reserves the storage of a num_rows x num_cols entry and returns a pointer
+  // to it. The content of an existing entry with the same name is discarded.
+  int64_t* AllocateEntry(absl::string_view name, int num_rows, int num_cols);
+  const Entry& GetEntry(absl::string_view name) const;
+
+  // All the values are stored contiguously, entry after entry, so that a
+  // snapshot can be saved and reloaded with a single copy.
+  std::vector<int64_t> values_;
+  // Names are kept in insertion order so that the file is deterministic.
+  std::vector<std::string> names_;
+  absl::flat_hash_map<std::string, Entry> entries_;
+};
+
+}  // namespace operations_research
+
+#endif  // OR_TOOLS_ROUTING_INSTANCE_SNAPSHOT_H_
@@ -0,0 +1,130 @@
+// Copyright 2010-2022 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ortools/routing/instance_snapshot.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "gtest/gtest.h"
+#include "ortools/base/file.h"
+#include "ortools/base/path.h"
+
+namespace operations_research {
+namespace {
+
+TEST(RoutingInstanceSnapshotTest, SetAndGet) {
+  RoutingInstanceSnapshot snapshot;
+  snapshot.SetMatrix("distance", 3, [](int i, int j) { return 10 * i + j; });
+  snapshot.SetNodeValues("demand", {0, 5, 7});
+  EXPECT_TRUE(snapshot.HasEntry("distance"));
+  EXPECT_TRUE(snapshot.HasEntry("demand"));
+  EXPECT_FALSE(snapshot.HasEntry("time"));
+  EXPECT_EQ(3, snapshot.NumRows("distance"));
+  EXPECT_EQ(3, snapshot.NumCols("distance"));
+  EXPECT_EQ(1, snapshot.NumRows("demand"));
+  EXPECT_EQ(3, snapshot.NumCols("demand"));
+  const std::vector<std::vector<int64_t>> expected = {
+      {0, 1, 2}, {10, 11, 12}, {20, 21, 22}};
+  EXPECT_EQ(expected, snapshot.GetMatrix("distance"));
+  EXPECT_EQ(12, snapshot.Row("distance", 1)[2]);
+  EXPECT_EQ(std::vector<int64_t>({0, 5, 7}),
+            std::vector<int64_t>(snapshot.NodeValues("demand").begin(),
+                                 snapshot.NodeValues("demand").end()));
+}
+
+TEST(RoutingInstanceSnapshotTest, OverwriteEntry) {
+  RoutingInstanceSnapshot snapshot;
+  snapshot.SetNodeValues("demand", {1, 2, 3});
+  snapshot.SetNodeValues("demand", {4, 5, 6});
+  EXPECT_EQ(4, snapshot.NodeValues("demand")[0]);
+  snapshot.SetNodeValues("demand", {7, 8});
+  EXPECT_EQ(2, snapshot.NumCols("demand"));
+  EXPECT_EQ(8, snapshot.NodeValues("demand")[1]);
+}
+
+TEST(RoutingInstanceSnapshotTest, WriteAndLoad) {
+  const std::string file_name =
+      file::JoinPath(::testing::TempDir(), "routing_snapshot.bin");
+  RoutingInstanceSnapshot snapshot;
+  snapshot.SetMatrix("distance", 4, [](int i, int j) { return i * j - 3; });
+  snapshot.SetMatrix("time", {{0, 1}, {2, 0}});
+  snapshot.SetNodeValues("demand", {0, 1, 2, 3});
+  // Overwritten entries must not be written.
+  snapshot.SetNodeValues("demand", {3, 2, 1});
+  ASSERT_TRUE(snapshot.WriteToFile(file_name).ok());
+
+  RoutingInstanceSnapshot loaded;
+  loaded.SetNodeValues("stale", {42});
+  ASSERT_TRUE(loaded.LoadFromFile(file_name).ok());
+  EXPECT_FALSE(loaded.HasEntry("stale"));
+  EXPECT_EQ(snapshot.GetMatrix("distance"), loaded.GetMatrix("distance"));
+  EXPECT_EQ(snapshot.GetMatrix("time"), loaded.GetMatrix("time"));
+  EXPECT_EQ(snapshot.GetMatrix("demand"), loaded.GetMatrix("demand"));
+}
+
+TEST(RoutingInstanceSnapshotTest, LoadInvalidFile) {
+  const std::string file_name =
+      file::JoinPath(::testing::TempDir(), "routing_snapshot_invalid.bin");
+  RoutingInstanceSnapshot snapshot;
+  snapshot.SetNodeValues("demand", {0, 1, 2, 3});
+  ASSERT_TRUE(snapshot.WriteToFile(file_name).ok());
+  std::string data;
+  ASSERT_TRUE(file::GetContents(file_name, &data, file::Defaults()).ok());
+
+  // Truncated values.
+  ASSERT_TRUE(file::SetContents(file_name, data.substr(0, data.size() - 1),
+                                file::Defaults())
+                  .ok());
+  RoutingInstanceSnapshot loaded;
+  EXPECT_EQ(absl::StatusCode::kInvalidArgument,
+            loaded.LoadFromFile(file_name).code());
+  EXPECT_FALSE(loaded.HasEntry("demand"));
+
+  // Wrong header.
+  ASSERT_TRUE(
+      file::SetContents(file_name, "not a snapshot", file::Defaults()).ok());
+  EXPECT_EQ(absl::StatusCode::kInvalidArgument,
+            loaded.LoadFromFile(file_name).code());
+}
+
+TEST(RoutingInstanceSnapshotTest, LoadFileWithHugeEntries) {
+  const std::string file_name =
+      file::JoinPath(::testing::TempDir(), "routing_snapshot_huge.bin");
+  // The total number of values of these entries overflows an int64_t.
+  const auto append = [](auto value, std::string* out) {
+    out->append(reinterpret_cast<const char*>(&value), sizeof(value));
+  };
+  std::string data = "ORRSNAP1";
+  const int num_entries = 5;
+  append(uint64_t{num_entries}, &data);
+  for (int e = 0; e < num_entries; ++e) {
+    const std::string name(1, 'a' + e);
+    append(uint64_t{name.size()}, &data);
+    data.append(name);
+    append(int64_t{std::numeric_limits<int>::max()}, &data);
+    append(int64_t{std::numeric_limits<int>::max()}, &data);
+  }
+  ASSERT_TRUE(file::SetContents(file_name, data, file::Defaults()).ok());
+  RoutingInstanceSnapshot loaded;
+  EXPECT_EQ(absl::StatusCode::kInvalidArgument,
+            loaded.LoadFromFile(file_name).code());
+  EXPECT_FALSE(loaded.HasEntry("a"));
+}
+
+}  // namespace
+}  // namespace operations_research
@@ -162,6 +162,8 @@ AllDifferentConstraint::AllDifferentConstraint(
 
   successor_.resize(num_variables_);
   variable_to_value_.assign(num_variables_, -1);
+  value_visited_.ClearAndResize(num_all_values_);
+  variable_visited_.ClearAndResize(num_variables_);
   visiting_.resize(num_variables_);
   variable_visited_from_.resize(num_variables_);
   residual_graph_successors_.resize(num_variables_ + num_all_values_ + 1);
@@ -208,7 +210,7 @@ bool AllDifferentConstraint::MakeAugmentingPath(int start) {
   int num_visited = 0;
   // Enqueue start.
   visiting_[num_to_visit++] = start;
-  variable_visited_[start] = true;
+  variable_visited_.Set(start);
   variable_visited_from_[start] = -1;
 
   while (num_visited < num_to_visit) {
@@ -217,7 +219,7 @@ bool AllDifferentConstraint::MakeAugmentingPath(int start) {
 
     for (const int value : successor_[node]) {
       if (value_visited_[value]) continue;
-      value_visited_[value] = true;
+      value_visited_.Set(value);
       if (value_to_variable_[value] == -1) {
         // value is not matched: change path from node to start, and return.
         int path_node = node;
@@ -233,7 +235,7 @@ bool AllDifferentConstraint::MakeAugmentingPath(int start) {
       } else {
         // Enqueue node matched to value.
         const int next_node = value_to_variable_[value];
-        variable_visited_[next_node] = true;
+        variable_visited_.Set(next_node);
         visiting_[num_to_visit++] = next_node;
         variable_visited_from_[next_node] = node;
       }
@@ -311,8 +313,8 @@ bool AllDifferentConstraint::Propagate() {
   int x = 0;
   for (; x < num_variables_; x++) {
     if (variable_to_value_[x] == -1) {
-      value_visited_.assign(num_all_values_, false);
-      variable_visited_.assign(num_variables_, false);
+      value_visited_.SparseClearAll();
+      variable_visited_.SparseClearAll();
       MakeAugmentingPath(x);
     }
     if (variable_to_value_[x] == -1) break;  // No augmenting path exists.
@@ -399,8 +401,8 @@ bool AllDifferentConstraint::Propagate() {
         // then find another assignment for the variable matched to
         // offset_value. It will fail: explaining why is the same as
         // explaining failure as above, and it is an explanation of x != value.
-        value_visited_.assign(num_all_values_, false);
-        variable_visited_.assign(num_variables_, false);
+        value_visited_.SparseClearAll();
+        variable_visited_.SparseClearAll();
         // Undo x -> old_value and old_variable -> offset_value.
         const int old_variable = value_to_variable_[offset_value];
         variable_to_value_[old_variable] = -1;
@@ -409,7 +411,7 @@ bool AllDifferentConstraint::Propagate() {
         variable_to_value_[x] = offset_value;
         value_to_variable_[offset_value] = x;
 
-        value_visited_[offset_value] = true;
+        value_visited_.Set(offset_value);
         MakeAugmentingPath(old_variable);
         DCHECK_EQ(variable_to_value_[old_variable], -1);  // No reassignment.
 
@@ -426,11 +428,21 @@ bool AllDifferentConstraint::Propagate() {
           }
         }
 
+        // Restore the matching. It is still valid since we never remove a
+        // matched arc, so we can continue and filter all the other arcs
+        // without rebuilding everything on the next call.
+        variable_to_value_[x] = old_value;
+        value_to_variable_[old_value] = x;
+        variable_to_value_[old_variable] = offset_value;
+        value_to_variable_[offset_value] = old_variable;
+
         const LiteralIndex li =
             VariableLiteralIndexOf(x, offset_value + min_all_values_);
         DCHECK_NE(li, kTrueLiteralIndex);
         DCHECK_NE(li, kFalseLiteralIndex);
-        return trail_->EnqueueWithStoredReason(Literal(li).Negated());
+        if (!trail_->EnqueueWithStoredReason(Literal(li).Negated())) {
+          return false;
+        }
       }
     }
   }
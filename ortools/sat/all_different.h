@@ -27,6 +27,7 @@
 #include "ortools/sat/integer.h"
 #include "ortools/sat/model.h"
 #include "ortools/sat/sat_base.h"
+#include "ortools/util/bitset.h"
 #include "ortools/util/strong_integers.h"
 
 namespace operations_research {
@@ -105,9 +106,12 @@ class AllDifferentConstraint : PropagatorInterface {
   // value_to_variable_ and variable_to_value_ represent the current assignment;
   // -1 means not assigned. Otherwise,
   // variable_to_value_[var] = value <=> value_to_variable_[value] = var.
+  //
+  // The visited marks are sparse bitsets since a search usually only visits a
+  // few nodes, and they need to be cleared before each augmenting path.
   std::vector<std::vector<int>> successor_;
-  std::vector<bool> value_visited_;
-  std::vector<bool> variable_visited_;
+  SparseBitset<int> value_visited_;
+  SparseBitset<int> variable_visited_;
   std::vector<int> value_to_variable_;
   std::vector<int> variable_to_value_;
   std::vector<int> prev_matching_;
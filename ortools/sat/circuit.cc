@@ -46,6 +46,7 @@ CircuitPropagator::CircuitPropagator(const int num_nodes,
   prev_.resize(num_nodes_, -1);
   next_literal_.resize(num_nodes_);
   must_be_in_cycle_.resize(num_nodes_);
+  in_current_path_.ClearAndResize(num_nodes_);
   absl::flat_hash_map<LiteralIndex, int> literal_to_watch_index;
 
   const int num_arcs = tails.size();
@@ -210,25 +211,25 @@ bool CircuitPropagator::Propagate() {
     if (next_[n] == n) continue;
     if (next_[n] == -1 && prev_[n] == -1) continue;
 
-    // TODO(user): both this and the loop on must_be_in_cycle_ might take some
-    // time on large graph. Optimize if this become an issue.
-    in_current_path_.assign(num_nodes_, false);
+    // TODO(user): the loop on must_be_in_cycle_ might take some time on large
+    // graph. Optimize if this become an issue.
+    in_current_path_.SparseClearAll();
 
     // Find the start and end of the path containing node n. If this is a
     // circuit, we will have start_node == end_node.
     int start_node = n;
     int end_node = n;
-    in_current_path_[n] = true;
+    in_current_path_.Set(n);
     processed_[n] = true;
     while (next_[end_node] != -1) {
       end_node = next_[end_node];
-      in_current_path_[end_node] = true;
+      in_current_path_.Set(end_node);
       processed_[end_node] = true;
       if (end_node == n) break;
     }
     while (prev_[start_node] != -1) {
       start_node = prev_[start_node];
-      in_current_path_[start_node] = true;
+      in_current_path_.Set(start_node);
       processed_[start_node] = true;
       if (start_node == n) break;
     }
@@ -27,6 +27,7 @@
 #include "ortools/sat/integer.h"
 #include "ortools/sat/model.h"
 #include "ortools/sat/sat_base.h"
+#include "ortools/util/bitset.h"
 #include "ortools/util/rev.h"
 #include "ortools/util/strong_integers.h"
 
@@ -113,9 +114,10 @@ class CircuitPropagator : PropagatorInterface, ReversibleInterface {
   int rev_must_be_in_cycle_size_ = 0;
   std::vector<int> must_be_in_cycle_;
 
-  // Temporary vectors.
+  // Temporary vectors. The nodes of the current path are stored in a sparse
+  // bitset so that clearing it only costs the size of the last path.
   std::vector<bool> processed_;
-  std::vector<bool> in_current_path_;
+  SparseBitset<int> in_current_path_;
 };
 
 // Enforce the fact that there is no cycle in the given directed graph.
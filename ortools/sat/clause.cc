@@ -71,6 +71,7 @@ void RemoveIf(Container c, Predicate p) {
 
 LiteralWatchers::LiteralWatchers(Model* model)
     : SatPropagator("LiteralWatchers"),
+      parameters_(*model->GetOrCreate<SatParameters>()),
       implication_graph_(model->GetOrCreate<BinaryImplicationGraph>()),
       trail_(model->GetOrCreate<Trail>()),
       num_inspected_clauses_(0),
@@ -81,7 +82,8 @@ LiteralWatchers::LiteralWatchers(Model* model)
 }
 
 LiteralWatchers::~LiteralWatchers() {
-  gtl::STLDeleteElements(&clauses_);
+  for (SatClause* clause : clauses_) clause_allocator_.Release(clause);
+  clauses_.clear();
   IF_STATS_ENABLED(LOG(INFO) << stats_.StatString());
 }
 
@@ -102,6 +104,24 @@ void LiteralWatchers::AttachOnFalse(Literal literal, Literal blocking_literal,
   watchers_on_false_[literal].push_back(Watcher(clause, blocking_literal));
 }
 
+void LiteralWatchers::AttachWatchers(SatClause* clause) {
+  const Literal* literals = clause->begin();
+  if (clause->size() == 3 &&
+      parameters_.watch_ternary_clauses_on_all_literals()) {
+    SCOPED_TIME_STAT(&stats_);
+    DCHECK(is_clean_);
+    some_ternary_clauses_are_fully_watched_ = true;
+    for (int i = 0; i < 3; ++i) {
+      DCHECK(!WatcherListContains(watchers_on_false_[literals[i]], *clause));
+      watchers_on_false_[literals[i]].push_back(Watcher::Ternary(
+          clause, literals[(i + 1) % 3], literals[(i + 2) % 3]));
+    }
+    return;
+  }
+  AttachOnFalse(literals[0], literals[1], clause);
+  AttachOnFalse(literals[1], literals[0], clause);
+}
+
 bool LiteralWatchers::PropagateOnFalse(Literal false_literal, Trail* trail) {
   SCOPED_TIME_STAT(&stats_);
   DCHECK(is_clean_);
@@ -124,6 +144,42 @@ bool LiteralWatchers::PropagateOnFalse(Literal false_literal, Trail* trail) {
     }
     ++num_inspected_clauses_;
 
+    if (it->IsTernary()) {
+      // All the literals of this clause are watched, so we never need to move
+      // a watcher and we can decide what to do from the watcher alone.
+      const Literal other = it->TernaryOtherLiteral();
+      if (assignment.LiteralIsTrue(other)) {
+        *new_it++ = Watcher::Ternary(it->clause, other, it->blocking_literal);
+        continue;
+      }
+      const bool blocking_is_false =
+          assignment.LiteralIsFalse(it->blocking_literal);
+      const bool other_is_false = assignment.LiteralIsFalse(other);
+      if (!blocking_is_false && !other_is_false) {
+        *new_it++ = *it;
+        continue;
+      }
+      if (blocking_is_false && other_is_false) {
+        trail->MutableConflict()->assign(it->clause->begin(),
+                                         it->clause->end());
+        trail->SetFailingSatClause(it->clause);
+        num_inspected_clause_literals_ += it - watchers.begin() + 1;
+        watchers.erase(new_it, it);
+        return false;
+      }
+
+      // Propagation. Like for the other clauses, the propagated literal must
+      // be at position 0 so that we can recover the reason.
+      Literal* literals = it->clause->literals();
+      literals[0] = blocking_is_false ? other : it->blocking_literal;
+      literals[1] = false_literal;
+      literals[2] = blocking_is_false ? it->blocking_literal : other;
+      reasons_[trail->Index()] = it->clause;
+      trail->Enqueue(literals[0], propagator_id_);
+      *new_it++ = *it;
+      continue;
+    }
+
     // If the other watched literal is true, just change the blocking literal.
     // Note that we use the fact that the first two literals of the clause are
     // the ones currently watched.
@@ -216,20 +272,30 @@ SatClause* LiteralWatchers::ReasonClause(int trail_index) const {
   return reasons_[trail_index];
 }
 
+void LiteralWatchers::EnqueueWithClauseReason(SatClause* clause, Trail* trail) {
+  DCHECK(clause->IsAttached());
+  DCHECK(!trail->Assignment().LiteralIsAssigned(clause->FirstLiteral()));
+  DCHECK(std::all_of(clause->begin() + 1, clause->end(), [&](Literal l) {
+    return trail->Assignment().LiteralIsFalse(l);
+  }));
+  reasons_[trail->Index()] = clause;
+  trail->Enqueue(clause->FirstLiteral(), propagator_id_);
+}
+
 bool LiteralWatchers::AddClause(absl::Span<const Literal> literals) {
   return AddClause(literals, trail_);
 }
 
 bool LiteralWatchers::AddClause(absl::Span<const Literal> literals,
                                 Trail* trail) {
-  SatClause* clause = SatClause::Create(literals);
+  SatClause* clause = clause_allocator_.Allocate(literals);
   clauses_.push_back(clause);
   return AttachAndPropagate(clause, trail);
 }
 
 SatClause* LiteralWatchers::AddRemovableClause(
     const std::vector<Literal>& literals, Trail* trail) {
-  SatClause* clause = SatClause::Create(literals);
+  SatClause* clause = clause_allocator_.Allocate(literals);
   clauses_.push_back(clause);
   CHECK(AttachAndPropagate(clause, trail));
   return clause;
@@ -284,8 +350,7 @@ bool LiteralWatchers::AttachAndPropagate(SatClause* clause, Trail* trail) {
   }
 
   ++num_watched_clauses_;
-  AttachOnFalse(literals[0], literals[1], clause);
-  AttachOnFalse(literals[1], literals[0], clause);
+  AttachWatchers(clause);
   return true;
 }
 
@@ -295,8 +360,7 @@ void LiteralWatchers::Attach(SatClause* clause, Trail* trail) {
   CHECK(!trail->Assignment().LiteralIsAssigned(literals[1]));
 
   ++num_watched_clauses_;
-  AttachOnFalse(literals[0], literals[1], clause);
-  AttachOnFalse(literals[1], literals[0], clause);
+  AttachWatchers(clause);
 }
 
 void LiteralWatchers::InternalDetach(SatClause* clause) {
@@ -312,13 +376,14 @@ void LiteralWatchers::InternalDetach(SatClause* clause) {
 void LiteralWatchers::LazyDetach(SatClause* clause) {
   InternalDetach(clause);
   is_clean_ = false;
-  needs_cleaning_.Set(clause->FirstLiteral());
-  needs_cleaning_.Set(clause->SecondLiteral());
+  for (const Literal l : PotentiallyWatchedLiterals(clause)) {
+    needs_cleaning_.Set(l);
+  }
 }
 
 void LiteralWatchers::Detach(SatClause* clause) {
   InternalDetach(clause);
-  for (const Literal l : {clause->FirstLiteral(), clause->SecondLiteral()}) {
+  for (const Literal l : PotentiallyWatchedLiterals(clause)) {
     needs_cleaning_.Clear(l);
     RemoveIf(&(watchers_on_false_[l]), [](const Watcher& watcher) {
       return !watcher.clause->IsAttached();
@@ -348,8 +413,7 @@ void LiteralWatchers::AttachAllClauses() {
   for (SatClause* clause : clauses_) {
     ++num_watched_clauses_;
     CHECK_GE(clause->size(), 2);
-    AttachOnFalse(clause->FirstLiteral(), clause->SecondLiteral(), clause);
-    AttachOnFalse(clause->SecondLiteral(), clause->FirstLiteral(), clause);
+    AttachWatchers(clause);
   }
 }
 
@@ -415,7 +479,7 @@ bool LiteralWatchers::InprocessingRewriteClause(
     // detach it in a non-lazy way.
     --num_watched_clauses_;
     clause->Clear();
-    for (const Literal l : {clause->FirstLiteral(), clause->SecondLiteral()}) {
+    for (const Literal l : PotentiallyWatchedLiterals(clause)) {
       needs_cleaning_.Clear(l);
       RemoveIf(&(watchers_on_false_[l]), [](const Watcher& watcher) {
         return !watcher.clause->IsAttached();
@@ -451,7 +515,7 @@ SatClause* LiteralWatchers::InprocessingAddClause(
     return nullptr;
   }
 
-  SatClause* clause = SatClause::Create(new_clause);
+  SatClause* clause = clause_allocator_.Allocate(new_clause);
   clauses_.push_back(clause);
   return clause;
 }
@@ -486,7 +550,9 @@ void LiteralWatchers::DeleteRemovedClauses() {
   std::vector<SatClause*>::iterator iter =
       std::stable_partition(clauses_.begin(), clauses_.end(),
                             [](SatClause* a) { return a->IsAttached(); });
-  gtl::STLDeleteContainerPointers(iter, clauses_.end());
+  for (auto it = iter; it != clauses_.end(); ++it) {
+    clause_allocator_.Release(*it);
+  }
   clauses_.erase(iter, clauses_.end());
 }
 
@@ -2332,23 +2398,72 @@ SatClause* SatClause::Create(absl::Span<const Literal> literals) {
   SatClause* clause = reinterpret_cast<SatClause*>(
       ::operator new(sizeof(SatClause) + literals.size() * sizeof(Literal)));
   clause->size_ = literals.size();
+  clause->capacity_ = literals.size();
   for (int i = 0; i < literals.size(); ++i) {
     clause->literals_[i] = literals[i];
   }
   return clause;
 }
 
+// ----- SatClauseAllocator -----
+
+SatClause* SatClauseAllocator::Allocate(absl::Span<const Literal> literals) {
+  const int capacity = literals.size();
+  if (capacity > kMaxPooledCapacity) return SatClause::Create(literals);
+  CHECK_GE(capacity, 2);
+
+  SatClause* clause;
+  std::vector<SatClause*>& free_list = free_lists_[capacity];
+  if (!free_list.empty()) {
+    clause = free_list.back();
+    free_list.pop_back();
+  } else {
+    const size_t num_bytes = NumBytes(capacity);
+    if (num_bytes > block_free_size_) {
+      // Note that the end of the previous block is lost, but this is at most
+      // NumBytes(kMaxPooledCapacity) per block.
+      blocks_.emplace_back(new char[kBlockSizeInBytes]);
+      block_free_begin_ = blocks_.back().get();
+      block_free_size_ = kBlockSizeInBytes;
+    }
+    clause = reinterpret_cast<SatClause*>(block_free_begin_);
+    block_free_begin_ += num_bytes;
+    block_free_size_ -= num_bytes;
+  }
+
+  clause->size_ = capacity;
+  clause->capacity_ = capacity;
+  for (int i = 0; i < capacity; ++i) {
+    clause->literals_[i] = literals[i];
+  }
+  return clause;
+}
+
+void SatClauseAllocator::Release(SatClause* clause) {
+  if (clause->capacity_ > kMaxPooledCapacity) {
+    delete clause;
+    return;
+  }
+  free_lists_[clause->capacity_].push_back(clause);
+}
+
 // Note that for an attached clause, removing fixed literal is okay because if
 // any of the watched literal is assigned, then the clause is necessarily true.
 bool SatClause::RemoveFixedLiteralsAndTestIfTrue(
     const VariablesAssignment& assignment) {
   DCHECK(IsAttached());
+  int j = 2;
   if (assignment.VariableIsAssigned(literals_[0].Variable()) ||
       assignment.VariableIsAssigned(literals_[1].Variable())) {
-    DCHECK(IsSatisfied(assignment));
-    return true;
+    // With the 2-watcher scheme, this means that the clause is satisfied. This
+    // is not the case for a ternary clause watched on all its literals, but
+    // then its literals can be reordered freely.
+    if (size_ != 3 || IsSatisfied(assignment)) {
+      DCHECK(IsSatisfied(assignment));
+      return true;
+    }
+    j = 0;
   }
-  int j = 2;
   while (j < size_ && !assignment.VariableIsAssigned(literals_[j].Variable())) {
     ++j;
   }
@@ -19,6 +19,7 @@
 
 #include <cstdint>
 #include <deque>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -117,6 +118,7 @@ class SatClause {
   // LiteralWatchers needs to permute the order of literals in the clause and
   // call Clear()/Rewrite.
   friend class LiteralWatchers;
+  friend class SatClauseAllocator;
 
   Literal* literals() { return &(literals_[0]); }
 
@@ -134,6 +136,11 @@ class SatClause {
 
   int32_t size_;
 
+  // The number of literals this clause memory can hold. This is the size at
+  // creation and never changes even if the clause is shrunk or cleared. It is
+  // used to recycle the memory of a deleted clause.
+  int32_t capacity_;
+
   // This class store the literals inline, and literals_ mark the starts of the
   // variable length portion.
   Literal literals_[0];
@@ -141,6 +148,47 @@ class SatClause {
   DISALLOW_COPY_AND_ASSIGN(SatClause);
 };
 
+// A simple memory pool for the clauses owned by the LiteralWatchers.
+//
+// Clauses are carved out of large contiguous blocks, so clauses created
+// together (like the problem clauses) are also close in memory and the
+// propagation touches fewer cache lines. The memory of a released clause is
+// kept in a free list indexed by capacity and reused by the next clause of the
+// same size, so the periodic clean up of the learned clause database does not
+// go through the global allocator. The rare very long clauses are directly
+// allocated on the heap.
+class SatClauseAllocator {
+ public:
+  SatClauseAllocator() = default;
+
+  // Returns a new clause containing the given literals. The clause must be
+  // given back with Release(), it must not be deleted.
+  SatClause* Allocate(absl::Span<const Literal> literals);
+
+  // Reclaims the memory of a clause returned by Allocate(). The pointer must
+  // not be used afterwards. Note that the memory of all the pooled clauses is
+  // freed when this class is destroyed.
+  void Release(SatClause* clause);
+
+ private:
+  static constexpr int kMaxPooledCapacity = 64;
+  static constexpr size_t kBlockSizeInBytes = size_t{1} << 20;
+
+  static size_t NumBytes(int capacity) {
+    return sizeof(SatClause) + capacity * sizeof(Literal);
+  }
+
+  // The memory blocks and the unused part of the last one.
+  std::vector<std::unique_ptr<char[]>> blocks_;
+  char* block_free_begin_ = nullptr;
+  size_t block_free_size_ = 0;
+
+  // free_lists_[c] contains released clauses of capacity c.
+  std::vector<SatClause*> free_lists_[kMaxPooledCapacity + 1];
+
+  DISALLOW_COPY_AND_ASSIGN(SatClauseAllocator);
+};
+
 // Clause information used for the clause database management. Note that only
 // the clauses that can be removed have an info. The problem clauses and
 // the learned one that we wants to keep forever do not have one.
@@ -179,6 +227,12 @@ class LiteralWatchers : public SatPropagator {
   // with a different return format.
   SatClause* ReasonClause(int trail_index) const;
 
+  // Enqueues the first literal of the given attached clause with this clause
+  // as a reason. The literal must be unassigned and all the other literals
+  // false. This is used by SatSolver::Backtrack() to restore the propagation
+  // of a learned clause.
+  void EnqueueWithClauseReason(SatClause* clause, Trail* trail);
+
   // Adds a new clause and perform initial propagation for this clause only.
   bool AddClause(absl::Span<const Literal> literals, Trail* trail);
   bool AddClause(absl::Span<const Literal> literals);
@@ -306,9 +360,24 @@ class LiteralWatchers : public SatPropagator {
     // Note that ideally, this should be part of a SatClause, so it can be
     // shared across watchers. However, since we have 32 bits for "free" here
     // because of the struct alignment, we store it here instead.
+    //
+    // For a ternary clause watched on all its literals, this is not needed and
+    // we store there instead the negated index of the second non-watched
+    // literal, see Ternary().
     int32_t start_index;
 
     SatClause* clause;
+
+    // Returns a watcher for a clause of size 3 that is watched on all its
+    // literals. The two given literals are the other literals of the clause.
+    static Watcher Ternary(SatClause* c, Literal b, Literal other) {
+      return Watcher(c, b, ~other.Index().value());
+    }
+    bool IsTernary() const { return start_index < 0; }
+    Literal TernaryOtherLiteral() const {
+      DCHECK(IsTernary());
+      return Literal(LiteralIndex(~start_index));
+    }
   };
 
   // This is exposed since some inprocessing code can heuristically exploit the
@@ -332,6 +401,22 @@ class LiteralWatchers : public SatPropagator {
   void AttachOnFalse(Literal literal, Literal blocking_literal,
                      SatClause* clause);
 
+  // Attaches the watchers of a clause. This uses the first two literals,
+  // except for ternary clauses that are watched on all their literals when
+  // watch_ternary_clauses_on_all_literals() is true.
+  void AttachWatchers(SatClause* clause);
+
+  // Returns the literals that might have a watcher for the given clause. This
+  // still works after the clause was cleared or shrunk since the removed
+  // literals stay in the clause memory.
+  absl::Span<const Literal> PotentiallyWatchedLiterals(
+      const SatClause* clause) const {
+    const int num_watched =
+        some_ternary_clauses_are_fully_watched_ && clause->capacity_ >= 3 ? 3
+                                                                          : 2;
+    return absl::Span<const Literal>(clause->begin(), num_watched);
+  }
+
   // Common code between LazyDetach() and Detach().
   void InternalDetach(SatClause* clause);
 
@@ -345,9 +430,14 @@ class LiteralWatchers : public SatPropagator {
   SparseBitset<LiteralIndex> needs_cleaning_;
   bool is_clean_ = true;
 
+  const SatParameters& parameters_;
   BinaryImplicationGraph* implication_graph_;
   Trail* trail_;
 
+  // True as soon as one ternary clause was attached on all its literals. Until
+  // then, we know that only the first two literals of a clause are watched.
+  bool some_ternary_clauses_are_fully_watched_ = false;
+
   int64_t num_inspected_clauses_;
   int64_t num_inspected_clause_literals_;
   int64_t num_watched_clauses_;
@@ -357,10 +447,12 @@ class LiteralWatchers : public SatPropagator {
   bool all_clauses_are_attached_ = true;
 
   // All the clauses currently in memory. This vector has ownership of the
-  // pointers. We currently do not use std::unique_ptr<SatClause> because it
-  // can't be used with some STL algorithms like std::partition.
+  // pointers, and the memory comes from clause_allocator_. We currently do not
+  // use std::unique_ptr<SatClause> because it can't be used with some STL
+  // algorithms like std::partition.
   //
   // Note that the unit clauses and binary clause are not kept here.
+  SatClauseAllocator clause_allocator_;
   std::vector<SatClause*> clauses_;
 
   int to_minimize_index_ = 0;
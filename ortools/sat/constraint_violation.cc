@@ -85,6 +85,10 @@ bool LiteralValue(int lit, absl::Span<const int64_t> solution) {
 int LinearIncrementalEvaluator::NewConstraint(Domain domain) {
   DCHECK(creation_phase_);
   domains_.push_back(domain);
+  rhs_min_.push_back(0);
+  rhs_max_.push_back(0);
+  rhs_is_interval_.push_back(false);
+  UpdateRhsBounds(num_constraints_);
   offsets_.push_back(0);
   activities_.push_back(0);
   num_false_enforcement_.push_back(0);
@@ -93,6 +97,13 @@ int LinearIncrementalEvaluator::NewConstraint(Domain domain) {
   return num_constraints_++;
 }
 
+void LinearIncrementalEvaluator::UpdateRhsBounds(int c) {
+  const Domain& domain = domains_[c];
+  rhs_is_interval_[c] = domain.NumIntervals() == 1;
+  rhs_min_[c] = domain.IsEmpty() ? 0 : domain.Min();
+  rhs_max_[c] = domain.IsEmpty() ? 0 : domain.Max();
+}
+
 void LinearIncrementalEvaluator::AddEnforcementLiteral(int ct_index, int lit) {
   DCHECK(creation_phase_);
   const int var = PositiveRef(lit);
@@ -195,7 +206,7 @@ void LinearIncrementalEvaluator::ComputeInitialActivities(
 
   // Cache violations (not counting enforcement).
   for (int c = 0; c < num_constraints_; ++c) {
-    distances_[c] = domains_[c].Distance(activities_[c]);
+    distances_[c] = DistanceToRhs(c, activities_[c]);
     is_violated_[c] = Violation(c) > 0;
   }
 }
@@ -246,7 +257,7 @@ void LinearIncrementalEvaluator::Update(
     const int64_t v0 = Violation(c);
     const int64_t coeff = coeff_buffer_[j];
     activities_[c] += coeff * delta;
-    distances_[c] = domains_[c].Distance(activities_[c]);
+    distances_[c] = DistanceToRhs(c, activities_[c]);
     const int64_t v1 = Violation(c);
     is_violated_[c] = v1 > 0;
     if (violation_deltas != nullptr) {
@@ -306,7 +317,7 @@ void LinearIncrementalEvaluator::UpdateScoreOnWeightUpdate(
     const int var = row_var_buffer_[i];
     const int64_t coeff = row_coeff_buffer_[j];
     const int64_t new_distance =
-        domains_[c].Distance(activities_[c] + coeff * jump_deltas[var]);
+        DistanceToRhs(c, activities_[c] + coeff * jump_deltas[var]);
     if (!in_last_affected_variables_[var]) {
       var_to_score_change[var] =
           static_cast<double>(new_distance - old_distance);
@@ -352,7 +363,7 @@ void LinearIncrementalEvaluator::UpdateScoreOnNewlyEnforced(
       const int var = row_var_buffer_[i];
       const int64_t coeff = row_coeff_buffer_[j];
       const int64_t new_distance =
-          domains_[c].Distance(activities_[c] + coeff * jump_deltas[var]);
+          DistanceToRhs(c, activities_[c] + coeff * jump_deltas[var]);
       jump_scores[var] +=
           weight * static_cast<double>(new_distance - old_distance);
       if (!in_last_affected_variables_[var]) {
@@ -393,7 +404,7 @@ void LinearIncrementalEvaluator::UpdateScoreOnNewlyUnenforced(
       const int var = row_var_buffer_[i];
       const int64_t coeff = row_coeff_buffer_[j];
       const int64_t new_distance =
-          domains_[c].Distance(activities_[c] + coeff * jump_deltas[var]);
+          DistanceToRhs(c, activities_[c] + coeff * jump_deltas[var]);
       jump_scores[var] -=
           weight * static_cast<double>(new_distance - old_distance);
       if (!in_last_affected_variables_[var]) {
@@ -465,13 +476,13 @@ void LinearIncrementalEvaluator::UpdateScoreOnActivityChange(
   }
 
   // If the violation delta was zero and will still always be zero, we can skip.
-  if (Domain(min_range, max_range).IsIncludedIn(domains_[c])) return;
+  if (RangeIsIncludedInRhs(c, min_range, max_range)) return;
 
   // Enforcement is always enforced -> un-enforced.
   // So it was -weight_time_distance and is now -weight_time_new_distance.
   const double delta =
       -weight *
-      static_cast<double>(domains_[c].Distance(new_activity) - distances_[c]);
+      static_cast<double>(DistanceToRhs(c, new_activity) - distances_[c]);
   if (delta != 0.0) {
     int i = data.start;
     const int end = data.num_pos_literal + data.num_neg_literal;
@@ -496,14 +507,13 @@ void LinearIncrementalEvaluator::UpdateScoreOnActivityChange(
     int i = data.start + data.num_pos_literal + data.num_neg_literal;
     int j = data.linear_start;
     dtime_ += 2 * data.num_linear_entries;
-    const Domain& rhs = domains_[c];
     const int64_t old_a_minus_new_a =
-        distances_[c] - rhs.Distance(new_activity);
+        distances_[c] - DistanceToRhs(c, new_activity);
     for (int k = 0; k < data.num_linear_entries; ++k, ++i, ++j) {
       const int var = row_var_buffer_[i];
       const int64_t impact = row_coeff_buffer_[j] * jump_deltas[var];
-      const int64_t old_b = rhs.Distance(old_activity + impact);
-      const int64_t new_b = rhs.Distance(new_activity + impact);
+      const int64_t old_b = DistanceToRhs(c, old_activity + impact);
+      const int64_t new_b = DistanceToRhs(c, new_activity + impact);
 
       // The old score was:
       //   weight * static_cast<double>(old_b - old_a);
@@ -606,7 +616,7 @@ void LinearIncrementalEvaluator::UpdateVariableAndScores(
       // This is the same as the 1->2 transition, but the old 1->0 needs to
       // be changed from - weight * distance to - weight * new_distance.
       const int64_t new_distance =
-          domains_[c].Distance(activities_[c] + coeff * delta);
+          DistanceToRhs(c, activities_[c] + coeff * delta);
       if (new_distance != distances_[c]) {
         UpdateScoreOfEnforcementIncrease(
             c, -weights[c] * static_cast<double>(distances_[c] - new_distance),
@@ -618,7 +628,7 @@ void LinearIncrementalEvaluator::UpdateVariableAndScores(
     }
 
     activities_[c] += coeff * delta;
-    distances_[c] = domains_[c].Distance(activities_[c]);
+    distances_[c] = DistanceToRhs(c, activities_[c]);
     const int64_t v1 = Violation(c);
     is_violated_[c] = v1 > 0;
     if (violation_deltas != nullptr) {
@@ -643,7 +653,8 @@ bool LinearIncrementalEvaluator::IsViolated(int c) const {
 bool LinearIncrementalEvaluator::ReduceBounds(int c, int64_t lb, int64_t ub) {
   if (domains_[c].Min() >= lb && domains_[c].Max() <= ub) return false;
   domains_[c] = domains_[c].IntersectionWith(Domain(lb, ub));
-  distances_[c] = domains_[c].Distance(activities_[c]);
+  UpdateRhsBounds(c);
+  distances_[c] = DistanceToRhs(c, activities_[c]);
   return true;
 }
 
@@ -707,7 +718,7 @@ double LinearIncrementalEvaluator::WeightedViolationDelta(
     const int64_t coeff = coeff_buffer_[j];
     const int64_t old_distance = distances_[c];
     const int64_t new_distance =
-        domains_[c].Distance(activities_[c] + coeff * delta);
+        DistanceToRhs(c, activities_[c] + coeff * delta);
     result += weights[c] * static_cast<double>(new_distance - old_distance);
   }
 
@@ -773,6 +784,7 @@ void LinearIncrementalEvaluator::PrecomputeCompactView(
     absl::Span<const int64_t> var_max_variation) {
   creation_phase_ = false;
   if (num_constraints_ == 0) return;
+  auto view = std::make_shared<CompactView>();
 
   // Compute the total size.
   // Note that at this point the constraint indices are not "encoded" yet.
@@ -794,7 +806,7 @@ void LinearIncrementalEvaluator::PrecomputeCompactView(
     }
   }
 
-  row_max_variations_.assign(num_constraints_, 0);
+  view->row_max_variations.assign(num_constraints_, 0);
   for (int var = 0; var < var_entries_.size(); ++var) {
     const int64_t range = var_max_variation[var];
     const auto& column = var_entries_[var];
@@ -803,37 +815,38 @@ void LinearIncrementalEvaluator::PrecomputeCompactView(
     for (const auto [c, coeff] : column) {
       tmp_row_sizes_[c]++;
       tmp_row_num_linear_entries_[c]++;
-      row_max_variations_[c] =
-          std::max(row_max_variations_[c], range * std::abs(coeff));
+      view->row_max_variations[c] =
+          std::max(view->row_max_variations[c], range * std::abs(coeff));
     }
   }
 
   // Compactify for faster WeightedViolationDelta().
-  ct_buffer_.reserve(total_size);
-  coeff_buffer_.reserve(total_linear_size);
-  columns_.resize(std::max(literal_entries_.size(), var_entries_.size()));
-  for (int var = 0; var < columns_.size(); ++var) {
-    columns_[var].start = static_cast<int>(ct_buffer_.size());
-    columns_[var].linear_start = static_cast<int>(coeff_buffer_.size());
+  view->ct_buffer.reserve(total_size);
+  view->coeff_buffer.reserve(total_linear_size);
+  view->columns.resize(std::max(literal_entries_.size(), var_entries_.size()));
+  for (int var = 0; var < view->columns.size(); ++var) {
+    view->columns[var].start = static_cast<int>(view->ct_buffer.size());
+    view->columns[var].linear_start =
+        static_cast<int>(view->coeff_buffer.size());
     if (var < literal_entries_.size()) {
       for (const auto [c, is_positive] : literal_entries_[var]) {
         if (is_positive) {
-          columns_[var].num_pos_literal++;
-          ct_buffer_.push_back(c);
+          view->columns[var].num_pos_literal++;
+          view->ct_buffer.push_back(c);
         }
       }
       for (const auto [c, is_positive] : literal_entries_[var]) {
         if (!is_positive) {
-          columns_[var].num_neg_literal++;
-          ct_buffer_.push_back(c);
+          view->columns[var].num_neg_literal++;
+          view->ct_buffer.push_back(c);
         }
       }
     }
     if (var < var_entries_.size()) {
       for (const auto [c, coeff] : var_entries_[var]) {
-        columns_[var].num_linear_entries++;
-        ct_buffer_.push_back(c);
-        coeff_buffer_.push_back(coeff);
+        view->columns[var].num_linear_entries++;
+        view->ct_buffer.push_back(c);
+        view->coeff_buffer.push_back(coeff);
       }
     }
   }
@@ -846,61 +859,84 @@ void LinearIncrementalEvaluator::PrecomputeCompactView(
   gtl::STLClearObject(&literal_entries_);
 
   // Initialize the SpanData.
-  // Transform tmp_row_sizes_ to starts in the row_var_buffer_.
-  // Transform tmp_row_num_linear_entries_ to starts in the row_coeff_buffer_.
+  // Transform tmp_row_sizes_ to starts in the row_var_buffer.
+  // Transform tmp_row_num_linear_entries_ to starts in the row_coeff_buffer.
   int offset = 0;
   int linear_offset = 0;
-  rows_.resize(num_constraints_);
+  view->rows.resize(num_constraints_);
   for (int c = 0; c < num_constraints_; ++c) {
-    rows_[c].num_pos_literal = tmp_row_num_positive_literals_[c];
-    rows_[c].num_neg_literal = tmp_row_num_negative_literals_[c];
-    rows_[c].num_linear_entries = tmp_row_num_linear_entries_[c];
+    view->rows[c].num_pos_literal = tmp_row_num_positive_literals_[c];
+    view->rows[c].num_neg_literal = tmp_row_num_negative_literals_[c];
+    view->rows[c].num_linear_entries = tmp_row_num_linear_entries_[c];
 
-    rows_[c].start = offset;
+    view->rows[c].start = offset;
     offset += tmp_row_sizes_[c];
-    tmp_row_sizes_[c] = rows_[c].start;
+    tmp_row_sizes_[c] = view->rows[c].start;
 
-    rows_[c].linear_start = linear_offset;
+    view->rows[c].linear_start = linear_offset;
     linear_offset += tmp_row_num_linear_entries_[c];
-    tmp_row_num_linear_entries_[c] = rows_[c].linear_start;
+    tmp_row_num_linear_entries_[c] = view->rows[c].linear_start;
   }
   DCHECK_EQ(offset, total_size);
   DCHECK_EQ(linear_offset, total_linear_size);
 
   // Copy data.
-  row_var_buffer_.resize(total_size);
-  row_coeff_buffer_.resize(total_linear_size);
-  for (int var = 0; var < columns_.size(); ++var) {
-    const SpanData& data = columns_[var];
+  view->row_var_buffer.resize(total_size);
+  view->row_coeff_buffer.resize(total_linear_size);
+  for (int var = 0; var < view->columns.size(); ++var) {
+    const SpanData& data = view->columns[var];
     int i = data.start;
     for (int k = 0; k < data.num_pos_literal; ++i, ++k) {
-      const int c = ct_buffer_[i];
-      row_var_buffer_[tmp_row_sizes_[c]++] = var;
+      const int c = view->ct_buffer[i];
+      view->row_var_buffer[tmp_row_sizes_[c]++] = var;
     }
   }
-  for (int var = 0; var < columns_.size(); ++var) {
-    const SpanData& data = columns_[var];
+  for (int var = 0; var < view->columns.size(); ++var) {
+    const SpanData& data = view->columns[var];
     int i = data.start + data.num_pos_literal;
     for (int k = 0; k < data.num_neg_literal; ++i, ++k) {
-      const int c = ct_buffer_[i];
-      row_var_buffer_[tmp_row_sizes_[c]++] = var;
+      const int c = view->ct_buffer[i];
+      view->row_var_buffer[tmp_row_sizes_[c]++] = var;
     }
   }
-  for (int var = 0; var < columns_.size(); ++var) {
-    const SpanData& data = columns_[var];
+  for (int var = 0; var < view->columns.size(); ++var) {
+    const SpanData& data = view->columns[var];
     int i = data.start + data.num_pos_literal + data.num_neg_literal;
     int j = data.linear_start;
     for (int k = 0; k < data.num_linear_entries; ++i, ++j, ++k) {
-      const int c = ct_buffer_[i];
-      row_var_buffer_[tmp_row_sizes_[c]++] = var;
-      row_coeff_buffer_[tmp_row_num_linear_entries_[c]++] = coeff_buffer_[j];
+      const int c = view->ct_buffer[i];
+      view->row_var_buffer[tmp_row_sizes_[c]++] = var;
+      view->row_coeff_buffer[tmp_row_num_linear_entries_[c]++] =
+          view->coeff_buffer[j];
     }
   }
 
+  SetCompactView(std::move(view));
+}
+
+void LinearIncrementalEvaluator::SetCompactView(
+    std::shared_ptr<const CompactView> view) {
+  view_ = std::move(view);
+  columns_ = view_->columns;
+  ct_buffer_ = view_->ct_buffer;
+  coeff_buffer_ = view_->coeff_buffer;
+  rows_ = view_->rows;
+  row_var_buffer_ = view_->row_var_buffer;
+  row_coeff_buffer_ = view_->row_coeff_buffer;
+  row_max_variations_ = view_->row_max_variations;
   cached_deltas_.assign(columns_.size(), 0);
   cached_scores_.assign(columns_.size(), 0);
 }
 
+bool LinearIncrementalEvaluator::UseCompactView(
+    std::shared_ptr<const CompactView> view) {
+  DCHECK(!creation_phase_);
+  if (view == nullptr || view == view_) return view != nullptr;
+  if (view_ == nullptr || !(*view == *view_)) return false;
+  SetCompactView(std::move(view));
+  return true;
+}
+
 bool LinearIncrementalEvaluator::ViolationChangeIsConvex(int var) const {
   for (const int c : VarToConstraints(var)) {
     if (domains_[c].intervals().size() > 2) return false;
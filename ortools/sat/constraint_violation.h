@@ -57,6 +57,18 @@ class LinearIncrementalEvaluator {
   // and before the class starts to be used. This is DCHECKed.
   void PrecomputeCompactView(absl::Span<const int64_t> var_max_variation);
 
+  // The static data computed by PrecomputeCompactView(). It never changes once
+  // built, so it can be shared between evaluators of the same model.
+  struct CompactView;
+  std::shared_ptr<const CompactView> SharedCompactView() const {
+    return view_;
+  }
+
+  // Replaces our compact view by the given one and frees our own copy. This
+  // must be called after PrecomputeCompactView(), and returns false without
+  // doing anything if the given view does not contain exactly the same data.
+  bool UseCompactView(std::shared_ptr<const CompactView> view);
+
   // Compute activities and update them.
   void ComputeInitialActivities(absl::Span<const int64_t> solution);
   void Update(int var, int64_t delta,
@@ -161,6 +173,13 @@ class LinearIncrementalEvaluator {
     int num_neg_literal = 0;
     int linear_start = 0;
     int num_linear_entries = 0;
+
+    bool operator==(const SpanData& o) const {
+      return start == o.start && num_pos_literal == o.num_pos_literal &&
+             num_neg_literal == o.num_neg_literal &&
+             linear_start == o.linear_start &&
+             num_linear_entries == o.num_linear_entries;
+    }
   };
 
   absl::Span<const int> VarToConstraints(int var) const {
@@ -188,11 +207,37 @@ class LinearIncrementalEvaluator {
                                    absl::Span<const int64_t> jump_deltas,
                                    absl::Span<double> jump_scores);
 
+  // Returns domains_[c].Distance(activity). This is used in all the hot loops
+  // and avoids looking at the Domain when it is a single interval, which is
+  // the common case.
+  int64_t DistanceToRhs(int c, int64_t activity) const {
+    if (!rhs_is_interval_[c]) return domains_[c].Distance(activity);
+    if (activity < rhs_min_[c]) return rhs_min_[c] - activity;
+    if (activity > rhs_max_[c]) return activity - rhs_max_[c];
+    return 0;
+  }
+
+  // Returns true if [min_range, max_range] is included in domains_[c].
+  bool RangeIsIncludedInRhs(int c, int64_t min_range, int64_t max_range) const {
+    if (!rhs_is_interval_[c]) {
+      return Domain(min_range, max_range).IsIncludedIn(domains_[c]);
+    }
+    return min_range >= rhs_min_[c] && max_range <= rhs_max_[c];
+  }
+
+  // Must be called each time domains_[c] changes.
+  void UpdateRhsBounds(int c);
+
   // Constraint indexed data (static).
   int num_constraints_ = 0;
   std::vector<Domain> domains_;
   std::vector<int64_t> offsets_;
 
+  // Flat copy of the bounds of domains_, see DistanceToRhs().
+  std::vector<int64_t> rhs_min_;
+  std::vector<int64_t> rhs_max_;
+  std::vector<bool> rhs_is_interval_;
+
   // Variable indexed data.
   // Note that this is just used at construction and is replaced by a compact
   // view when PrecomputeCompactView() is called.
@@ -200,21 +245,22 @@ class LinearIncrementalEvaluator {
   std::vector<std::vector<Entry>> var_entries_;
   std::vector<std::vector<LiteralEntry>> literal_entries_;
 
+  // Points into *view_, see SetCompactView().
+  void SetCompactView(std::shared_ptr<const CompactView> view);
+  std::shared_ptr<const CompactView> view_;
+
   // Memory efficient column based data (static).
-  std::vector<SpanData> columns_;
-  std::vector<int> ct_buffer_;
-  std::vector<int64_t> coeff_buffer_;
+  absl::Span<const SpanData> columns_;
+  absl::Span<const int> ct_buffer_;
+  absl::Span<const int64_t> coeff_buffer_;
 
   // Memory efficient row based data (static).
-  std::vector<SpanData> rows_;
-  std::vector<int> row_var_buffer_;
-  std::vector<int64_t> row_coeff_buffer_;
+  absl::Span<const SpanData> rows_;
+  absl::Span<const int> row_var_buffer_;
+  absl::Span<const int64_t> row_coeff_buffer_;
 
-  // In order to avoid scanning long constraint we compute for each of them
-  // the maximum activity variation of one variable (max-min) * abs(coeff).
-  // If the current activity plus this is still feasible, then the constraint
-  // do not need to be scanned.
-  std::vector<int64_t> row_max_variations_;
+  // See CompactView::row_max_variations.
+  absl::Span<const int64_t> row_max_variations_;
 
   // Temporary data.
   std::vector<int> tmp_row_sizes_;
@@ -240,6 +286,32 @@ class LinearIncrementalEvaluator {
   mutable size_t dtime_ = 0;
 };
 
+struct LinearIncrementalEvaluator::CompactView {
+  // Memory efficient column based data.
+  std::vector<SpanData> columns;
+  std::vector<int> ct_buffer;
+  std::vector<int64_t> coeff_buffer;
+
+  // Memory efficient row based data.
+  std::vector<SpanData> rows;
+  std::vector<int> row_var_buffer;
+  std::vector<int64_t> row_coeff_buffer;
+
+  // In order to avoid scanning long constraint we compute for each of them
+  // the maximum activity variation of one variable (max-min) * abs(coeff).
+  // If the current activity plus this is still feasible, then the constraint
+  // do not need to be scanned.
+  std::vector<int64_t> row_max_variations;
+
+  bool operator==(const CompactView& o) const {
+    return columns == o.columns && ct_buffer == o.ct_buffer &&
+           coeff_buffer == o.coeff_buffer && rows == o.rows &&
+           row_var_buffer == o.row_var_buffer &&
+           row_coeff_buffer == o.row_coeff_buffer &&
+           row_max_variations == o.row_max_variations;
+  }
+};
+
 // View of a generic (non linear) constraint for the LsEvaluator.
 //
 // TODO(user): Do we add a Update(solution, var, new_value) method ?
@@ -18,6 +18,7 @@
 #include <cstdint>
 #include <limits>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -1306,12 +1307,6 @@ class ConstraintChecker {
     return true;
   }
 
-  bool IntervalsAreDisjoint(const IntervalConstraintProto& interval1,
-                            const IntervalConstraintProto& interval2) {
-    return IntervalEnd(interval1) <= IntervalStart(interval2) ||
-           IntervalEnd(interval2) <= IntervalStart(interval1);
-  }
-
   bool IntervalIsEmpty(const IntervalConstraintProto& interval) {
     return IntervalStart(interval) == IntervalEnd(interval);
   }
@@ -1319,11 +1314,16 @@ class ConstraintChecker {
   bool NoOverlap2DConstraintIsFeasible(const CpModelProto& model,
                                        const ConstraintProto& ct) {
     const auto& arg = ct.no_overlap_2d();
-    // Those intervals from arg.x_intervals and arg.y_intervals where both
-    // the x and y intervals are enforced.
-    std::vector<std::pair<const IntervalConstraintProto* const,
-                          const IntervalConstraintProto* const>>
-        enforced_intervals_xy;
+    // Those boxes from arg.x_intervals and arg.y_intervals where both the x
+    // and y intervals are enforced. We evaluate their bounds only once.
+    struct Box {
+      int index;
+      int64_t x_start;
+      int64_t x_end;
+      int64_t y_start;
+      int64_t y_end;
+    };
+    std::vector<Box> boxes;
     {
       const int num_intervals = arg.x_intervals_size();
       CHECK_EQ(arg.y_intervals_size(), num_intervals);
@@ -1331,26 +1331,34 @@ class ConstraintChecker {
         const ConstraintProto& x = model.constraints(arg.x_intervals(i));
         const ConstraintProto& y = model.constraints(arg.y_intervals(i));
         if (ConstraintIsEnforced(x) && ConstraintIsEnforced(y)) {
-          enforced_intervals_xy.push_back({&x.interval(), &y.interval()});
+          boxes.push_back({static_cast<int>(boxes.size()),
+                           IntervalStart(x.interval()),
+                           IntervalEnd(x.interval()),
+                           IntervalStart(y.interval()),
+                           IntervalEnd(y.interval())});
         }
       }
     }
-    const int num_enforced_intervals = enforced_intervals_xy.size();
-    for (int i = 0; i < num_enforced_intervals; ++i) {
-      for (int j = i + 1; j < num_enforced_intervals; ++j) {
-        const auto& xi = *enforced_intervals_xy[i].first;
-        const auto& yi = *enforced_intervals_xy[i].second;
-        const auto& xj = *enforced_intervals_xy[j].first;
-        const auto& yj = *enforced_intervals_xy[j].second;
-        if (!IntervalsAreDisjoint(xi, xj) && !IntervalsAreDisjoint(yi, yj)) {
-          VLOG(1) << "Interval " << i << "(x=[" << IntervalStart(xi) << ", "
-                  << IntervalEnd(xi) << "], y=[" << IntervalStart(yi) << ", "
-                  << IntervalEnd(yi) << "]) and " << j << "(x=["
-                  << IntervalStart(xj) << ", " << IntervalEnd(xj) << "], y=["
-                  << IntervalStart(yj) << ", " << IntervalEnd(yj)
-                  << "]) are not disjoint.";
-          return false;
-        }
+
+    // Sweep on the x start: once a box starts after the end of box i on the x
+    // axis, so do all the following ones, and none of them can overlap i.
+    std::sort(boxes.begin(), boxes.end(), [](const Box& a, const Box& b) {
+      return std::tie(a.x_start, a.index) < std::tie(b.x_start, b.index);
+    });
+    const int num_boxes = boxes.size();
+    for (int i = 0; i < num_boxes; ++i) {
+      const Box& bi = boxes[i];
+      for (int j = i + 1; j < num_boxes; ++j) {
+        const Box& bj = boxes[j];
+        if (bj.x_start >= bi.x_end) break;
+        if (bj.x_end <= bi.x_start) continue;
+        if (bi.y_end <= bj.y_start || bj.y_end <= bi.y_start) continue;
+        VLOG(1) << "Interval " << bi.index << "(x=[" << bi.x_start << ", "
+                << bi.x_end << "], y=[" << bi.y_start << ", " << bi.y_end
+                << "]) and " << bj.index << "(x=[" << bj.x_start << ", "
+                << bj.x_end << "], y=[" << bj.y_start << ", " << bj.y_end
+                << "]) are not disjoint.";
+        return false;
       }
     }
     return true;
@@ -663,42 +663,56 @@ void LinkLiteralsAndValues(const std::vector<int>& literals,
                            PresolveContext* context) {
   CHECK_EQ(literals.size(), values.size());
 
-  // We use a map to make this method deterministic.
-  //
-  // TODO(user): Make sure this does not appear in the profile.
-  absl::btree_map<int, std::vector<int>> encoding_lit_to_support;
-
   // If a value is false (i.e not possible), then the tuple with this
   // value is false too (i.e not possible). Conversely, if the tuple is
   // selected, the value must be selected.
+  //
+  // We group the (encoding_lit, tuple_lit) pairs by encoding literal with a
+  // stable sort, this is deterministic and a lot faster than a map of vectors.
+  std::vector<std::pair<int, int>> encoding_lit_and_support;
+  encoding_lit_and_support.reserve(values.size());
   for (int i = 0; i < values.size(); ++i) {
-    encoding_lit_to_support[encoding.at(values[i])].push_back(literals[i]);
+    encoding_lit_and_support.push_back({encoding.at(values[i]), literals[i]});
   }
+  std::stable_sort(
+      encoding_lit_and_support.begin(), encoding_lit_and_support.end(),
+      [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+        return a.first < b.first;
+      });
 
   // If all tuples supporting a value are false, then this value must be
   // false.
-  for (const auto& [encoding_lit, support] : encoding_lit_to_support) {
-    CHECK(!support.empty());
-    if (support.size() == 1) {
-      context->StoreBooleanEqualityRelation(encoding_lit, support[0]);
+  const int num_pairs = encoding_lit_and_support.size();
+  for (int start = 0; start < num_pairs;) {
+    const int encoding_lit = encoding_lit_and_support[start].first;
+    int end = start + 1;
+    while (end < num_pairs &&
+           encoding_lit_and_support[end].first == encoding_lit) {
+      ++end;
+    }
+    if (end - start == 1) {
+      context->StoreBooleanEqualityRelation(
+          encoding_lit, encoding_lit_and_support[start].second);
     } else {
       BoolArgumentProto* bool_or =
           context->working_model->add_constraints()->mutable_bool_or();
       bool_or->add_literals(NegatedRef(encoding_lit));
-      for (const int lit : support) {
+      for (int i = start; i < end; ++i) {
+        const int lit = encoding_lit_and_support[i].second;
         bool_or->add_literals(lit);
         context->AddImplication(lit, encoding_lit);
       }
     }
+    start = end;
   }
 }
 
 // Add the constraint literal => one_of(encoding[v]), for v in reachable_values.
 // Note that all possible values are the ones appearing in encoding.
-void AddImplyInReachableValues(int literal,
-                               std::vector<int64_t>& reachable_values,
-                               const absl::flat_hash_map<int64_t, int> encoding,
-                               PresolveContext* context) {
+void AddImplyInReachableValues(
+    int literal, std::vector<int64_t>& reachable_values,
+    const absl::flat_hash_map<int64_t, int>& encoding,
+    PresolveContext* context) {
   gtl::STLSortAndRemoveDuplicates(&reachable_values);
   if (reachable_values.size() == encoding.size()) return;  // No constraint.
   if (reachable_values.size() <= encoding.size() / 2) {
@@ -1021,17 +1021,18 @@ Neighborhood NeighborhoodGeneratorHelper::FixGivenVariables(
       // We only copy the name in debug mode.
       if (DEBUG_MODE) new_var->set_name(current_var.name());
 
-      const Domain domain = ReadDomainFromProto(current_var);
+      // Note that we avoid creating a Domain in the common cases, this loop
+      // is in O(num_variables) for each neighborhood.
       const int64_t base_value = base_solution.solution(i);
-
       if (variables_to_fix.contains(i) && i != unique_objective_variable) {
-        if (domain.Contains(base_value)) {
+        if (DomainInProtoContains(current_var, base_value)) {
           new_var->add_domain(base_value);
           new_var->add_domain(base_value);
         } else {
           // If under the updated domain, the base solution is no longer valid,
           // We should probably regenerate this neighborhood. But for now we
           // just do a best effort and take the closest value.
+          const Domain domain = ReadDomainFromProto(current_var);
           int64_t closest_value = domain.Min();
           int64_t closest_dist = std::abs(closest_value - base_value);
           for (const ClosedInterval interval : domain) {
@@ -1046,7 +1047,7 @@ Neighborhood NeighborhoodGeneratorHelper::FixGivenVariables(
           FillDomainInProto(Domain(closest_value, closest_value), new_var);
         }
       } else {
-        FillDomainInProto(domain, new_var);
+        *new_var->mutable_domain() = current_var.domain();
       }
     }
   }
@@ -1178,6 +1179,40 @@ double NeighborhoodGenerator::GetUCBScore(int64_t total_num_calls) const {
   return current_average_ + sqrt((2 * log(total_num_calls)) / num_calls_);
 }
 
+void NeighborhoodGeneratorSelector::Register(
+    const NeighborhoodGenerator* generator) {
+  num_skips_[generator] = 0;
+}
+
+void NeighborhoodGeneratorSelector::Unregister(
+    const NeighborhoodGenerator* generator) {
+  num_skips_.erase(generator);
+}
+
+bool NeighborhoodGeneratorSelector::ShouldSchedule(
+    const NeighborhoodGenerator* generator) {
+  if (generator->num_calls() < kMinCallsBeforeThrottling) return true;
+
+  // Only the generators that can currently be scheduled are compared, so that
+  // the best of them is never throttled. Otherwise, if the best generator is
+  // not ready, all the others could be throttled and no LNS task would be
+  // available at all.
+  double best_gain = 0.0;
+  for (const auto& [other, unused] : num_skips_) {
+    if (!other->ReadyToGenerate()) continue;
+    best_gain = std::max(best_gain, other->average_gain_per_time_unit());
+  }
+  if (best_gain == 0.0) return true;
+  if (generator->average_gain_per_time_unit() >= kMinRelativeGain * best_gain) {
+    return true;
+  }
+
+  int& num_skips = num_skips_[generator];
+  if (++num_skips < kThrottlingPeriod) return false;
+  num_skips = 0;
+  return true;
+}
+
 double NeighborhoodGenerator::Synchronize() {
   absl::MutexLock mutex_lock(&generator_mutex_);
 
@@ -1236,7 +1271,10 @@ double NeighborhoodGenerator::Synchronize() {
     }
 
     total_dtime += data.deterministic_time;
+    total_objective_gain_ +=
+        std::max(0.0, static_cast<double>(best_objective_improvement.value()));
   }
+  total_deterministic_time_ += total_dtime;
 
   // Update the difficulty.
   difficulty_.Update(/*num_decreases=*/num_not_fully_solved_in_batch,
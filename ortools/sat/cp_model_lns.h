@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/container/flat_hash_set.h"
 #include "absl/log/check.h"
 #include "absl/random/bit_gen_ref.h"
@@ -470,6 +471,24 @@ class NeighborhoodGenerator {
     return deterministic_limit_;
   }
 
+  // The total deterministic time spent solving the neighborhoods of this
+  // generator, and the total improvement of the best objective they produced.
+  double total_deterministic_time() const {
+    absl::MutexLock mutex_lock(&generator_mutex_);
+    return total_deterministic_time_;
+  }
+  double total_objective_gain() const {
+    absl::MutexLock mutex_lock(&generator_mutex_);
+    return total_objective_gain_;
+  }
+
+  // The running average of the objective gain per deterministic time unit.
+  // This is the "reward" used by GetUCBScore().
+  double average_gain_per_time_unit() const {
+    absl::MutexLock mutex_lock(&generator_mutex_);
+    return current_average_;
+  }
+
  protected:
   const std::string name_;
   const NeighborhoodGeneratorHelper& helper_;
@@ -491,6 +510,40 @@ class NeighborhoodGenerator {
   int64_t num_consecutive_non_improving_calls_ = 0;
   int64_t next_time_limit_bump_ = 50;
   double current_average_ = 0.0;
+  double total_deterministic_time_ = 0.0;
+  double total_objective_gain_ = 0.0;
+};
+
+// Shared by all the LNS subsolvers to decide if a generator is worth
+// scheduling. A generator that, after enough calls, brings much less objective
+// improvement per deterministic time than the best one is only scheduled once
+// in a while, so that it can still recover if its neighborhoods become useful
+// again.
+//
+// This is only used by the main thread, so it does not need to be thread-safe.
+class NeighborhoodGeneratorSelector {
+ public:
+  NeighborhoodGeneratorSelector() = default;
+
+  void Register(const NeighborhoodGenerator* generator);
+  void Unregister(const NeighborhoodGenerator* generator);
+
+  // Returns false if the generator is currently throttled. The generator with
+  // the best gain among the ones that are ReadyToGenerate() is never
+  // throttled.
+  bool ShouldSchedule(const NeighborhoodGenerator* generator);
+
+ private:
+  // A generator needs this many calls before we consider throttling it.
+  static constexpr int64_t kMinCallsBeforeThrottling = 100;
+
+  // A throttled generator is scheduled once every kThrottlingPeriod requests.
+  static constexpr int kThrottlingPeriod = 10;
+
+  // Generators with a gain below this ratio of the best gain are throttled.
+  static constexpr double kMinRelativeGain = 0.01;
+
+  absl::flat_hash_map<const NeighborhoodGenerator*, int> num_skips_;
 };
 
 // Pick a random subset of variables.
@@ -46,12 +46,14 @@
 #include "absl/flags/flag.h"
 #include "absl/log/check.h"
 #include "absl/meta/type_traits.h"
+#include "absl/status/status.h"
 #include "absl/strings/escaping.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/str_join.h"
 #include "absl/strings/string_view.h"
 #include "absl/synchronization/mutex.h"
+#include "absl/time/time.h"
 #include "absl/types/span.h"
 #include "google/protobuf/text_format.h"
 #include "ortools/base/cleanup.h"
@@ -59,6 +61,7 @@
 #include "ortools/base/strong_vector.h"
 #include "ortools/graph/connected_components.h"
 #include "ortools/port/proto_utils.h"
+#include "ortools/port/sysinfo.h"
 #include "ortools/sat/clause.h"
 #include "ortools/sat/cp_model.pb.h"
 #include "ortools/sat/cp_model_checker.h"
@@ -90,6 +93,7 @@
 #include "ortools/sat/optimization.h"
 #include "ortools/sat/parameters_validation.h"
 #include "ortools/sat/precedences.h"
+#include "ortools/sat/presolve_cache.h"
 #include "ortools/sat/presolve_context.h"
 #include "ortools/sat/probing.h"
 #include "ortools/sat/rins.h"
@@ -97,6 +101,7 @@
 #include "ortools/sat/sat_inprocessing.h"
 #include "ortools/sat/sat_parameters.pb.h"
 #include "ortools/sat/sat_solver.h"
+#include "ortools/sat/shared_state_exchange.h"
 #include "ortools/sat/simplification.h"
 #include "ortools/sat/stat_tables.h"
 #include "ortools/sat/subsolver.h"
@@ -105,6 +110,7 @@
 #include "ortools/sat/work_assignment.h"
 #include "ortools/util/logging.h"
 #include "ortools/util/random_engine.h"
+#include "ortools/util/saturated_arithmetic.h"
 #if !defined(__PORTABLE_PLATFORM__)
 #include "ortools/util/sigint.h"
 #endif  // __PORTABLE_PLATFORM__
@@ -1736,6 +1742,13 @@ void LoadCpModel(const CpModelProto& model_proto, Model* model) {
   // constraints were added.
   SOLVER_LOG(model->GetOrCreate<SolverLogger>(),
              "Initial num_bool: ", sat_solver->NumVariables());
+  const int64_t num_encoding_bools =
+      model->GetOrCreate<IntegerEncoder>()->NumCreatedVariables();
+  if (num_encoding_bools > 0) {
+    SOLVER_LOG(model->GetOrCreate<SolverLogger>(),
+               "Initial num_bool created by the integer encoding: ",
+               num_encoding_bools);
+  }
   if (!sat_solver->FinishPropagation()) return unsat();
 
   if (model_proto.has_objective()) {
@@ -2454,7 +2467,8 @@ struct SharedClasses {
         logger(global_model->GetOrCreate<SolverLogger>()),
         stats(global_model->GetOrCreate<SharedStatistics>()),
         response(global_model->GetOrCreate<SharedResponseManager>()),
-        shared_tree_manager(global_model->GetOrCreate<SharedTreeManager>()) {}
+        shared_tree_manager(global_model->GetOrCreate<SharedTreeManager>()),
+        memory(global_model->GetOrCreate<SharedMemoryAccountant>()) {}
 
   // These are never nullptr.
   const CpModelProto* const model_proto;
@@ -2464,6 +2478,7 @@ struct SharedClasses {
   SharedStatistics* const stats;
   SharedResponseManager* const response;
   SharedTreeManager* const shared_tree_manager;
+  SharedMemoryAccountant* const memory;
 
   // These can be nullptr depending on the options.
   std::unique_ptr<SharedBoundsManager> bounds;
@@ -2474,6 +2489,12 @@ struct SharedClasses {
   // For displaying summary at the end.
   SharedStatTables stat_tables;
 
+  // Memory shared by all the feasibility jump workers.
+  SharedLinearEvaluatorViews linear_evaluator_views;
+
+  // Only accessed by the main thread.
+  NeighborhoodGeneratorSelector lns_selector;
+
   bool SearchIsDone() {
     if (response->ProblemIsSolved()) {
       // This is for cases where the time limit is checked more often.
@@ -2485,6 +2506,61 @@ struct SharedClasses {
   }
 };
 
+// Returns an estimate of the memory used by the data structures that grow
+// during the search: the clause database and the LP constraint pools.
+int64_t EstimateSearchMemoryUsage(Model* model) {
+  int64_t num_bytes = 0;
+  const auto* clauses = model->Mutable<LiteralWatchers>();
+  if (clauses != nullptr) {
+    for (const SatClause* clause : clauses->AllClausesInCreationOrder()) {
+      num_bytes += sizeof(SatClause) + clause->size() * sizeof(Literal);
+    }
+    num_bytes += 2 * clauses->num_watched_clauses() *
+                 sizeof(LiteralWatchers::Watcher);
+  }
+  const auto* implications = model->Mutable<BinaryImplicationGraph>();
+  if (implications != nullptr) {
+    num_bytes += implications->num_implications() * sizeof(Literal);
+  }
+  const auto* lps = model->Mutable<LinearProgrammingConstraintCollection>();
+  if (lps != nullptr) {
+    for (const LinearProgrammingConstraint* lp : *lps) {
+      for (const auto& info : lp->constraint_manager().AllConstraints()) {
+        num_bytes += info.constraint.vars.size() *
+                     (sizeof(IntegerVariable) + sizeof(IntegerValue));
+      }
+    }
+  }
+  return num_bytes;
+}
+
+// Halves the number of learned clauses kept at each clause database cleanup,
+// and the number of cuts kept in the LP constraint pools. Both read the
+// parameters of the model, so this takes effect at their next cleanup.
+//
+// The pools are never shrunk below some floor (or below their initial size
+// if it is smaller), so that repeated pressure signals do not disable clause
+// learning or cuts. Note that a clause_cleanup_target of zero would also
+// switch the cleanup to the ratio mode.
+void ShrinkSearchMemoryPools(Model* model) {
+  constexpr int kMinClauseCleanupTarget = 1000;
+  constexpr double kMinClauseCleanupRatio = 0.05;
+  constexpr int kMinMaxNumCuts = 100;
+  auto* params = model->GetOrCreate<SatParameters>();
+  if (params->clause_cleanup_target() > 0) {
+    const int target = params->clause_cleanup_target();
+    params->set_clause_cleanup_target(
+        std::max(target / 2, std::min(target, kMinClauseCleanupTarget)));
+  } else {
+    const double ratio = params->clause_cleanup_ratio();
+    params->set_clause_cleanup_ratio(
+        std::max(ratio / 2, std::min(ratio, kMinClauseCleanupRatio)));
+  }
+  const int max_num_cuts = params->max_num_cuts();
+  params->set_max_num_cuts(
+      std::max(max_num_cuts / 2, std::min(max_num_cuts, kMinMaxNumCuts)));
+}
+
 // Encapsulate a full CP-SAT solve without presolve in the SubSolver API.
 class FullProblemSolver : public SubSolver {
  public:
@@ -2537,6 +2613,17 @@ class FullProblemSolver : public SubSolver {
     // TODO(user): For now we do not count LNS statistics. We could easily
     // by registering the SharedStatistics class with LNS local model.
     local_model_.Register<SharedStatistics>(shared_->stats);
+
+    // The first solution solvers already use the secondary limit, and they
+    // will stop soon anyway.
+    memory_id_ = shared_->memory->RegisterNewId(
+        name, /*can_be_stopped=*/!stop_at_first_solution);
+    if (!stop_at_first_solution) {
+      stopped_for_memory_ = shared_->memory->StopBoolean(memory_id_);
+      local_model_.GetOrCreate<TimeLimit>()
+          ->RegisterSecondaryExternalBooleanAsLimit(stopped_for_memory_);
+    }
+    num_memory_pressure_signals_ = shared_->memory->NumMemoryPressureSignals();
   }
 
   ~FullProblemSolver() override {
@@ -2546,9 +2633,13 @@ class FullProblemSolver : public SubSolver {
     shared_->stat_tables.AddTimingStat(*this);
     shared_->stat_tables.AddLpStat(name(), &local_model_);
     shared_->stat_tables.AddSearchStat(name(), &local_model_);
+    shared_->memory->ReportDone(memory_id_);
   }
 
   bool IsDone() override {
+    if (stopped_for_memory_ != nullptr && stopped_for_memory_->load()) {
+      return true;
+    }
     return stop_at_first_solution_ &&
            shared_->response->first_solution_solvers_should_stop()->load();
   }
@@ -2602,6 +2693,13 @@ class FullProblemSolver : public SubSolver {
           RegisterClausesExport(id, shared_->clauses.get(), &local_model_);
         }
 
+        // Note that the level zero callbacks are run by this worker thread.
+        local_model_.GetOrCreate<LevelZeroCallbackHelper>()
+            ->callbacks.push_back([this]() {
+              MaybeReportMemoryUsage();
+              return true;
+            });
+
         if (local_model_.GetOrCreate<SatParameters>()->repair_hint()) {
           MinimizeL1DistanceWithHint(*shared_->model_proto, &local_model_);
         } else {
@@ -2631,6 +2729,7 @@ class FullProblemSolver : public SubSolver {
 
       const double saved_dtime = time_limit->GetElapsedDeterministicTime();
       SolveLoadedCpModel(*shared_->model_proto, &local_model_);
+      MaybeReportMemoryUsage();
 
       absl::MutexLock mutex_lock(&mutex_);
       previous_task_is_completed_ = true;
@@ -2650,11 +2749,35 @@ class FullProblemSolver : public SubSolver {
   }
 
  private:
+  // Reports the memory usage of this worker at most once per unit of
+  // deterministic time, and shrinks its pools if the memory pressure was
+  // signaled since the last time.
+  void MaybeReportMemoryUsage() {
+    const double dtime =
+        local_model_.GetOrCreate<TimeLimit>()->GetElapsedDeterministicTime();
+    if (dtime < next_memory_report_dtime_) return;
+    next_memory_report_dtime_ = dtime + 1.0;
+    shared_->memory->ReportMemoryUsage(
+        memory_id_, EstimateSearchMemoryUsage(&local_model_));
+
+    const int64_t num_signals = shared_->memory->NumMemoryPressureSignals();
+    if (num_signals == num_memory_pressure_signals_) return;
+    num_memory_pressure_signals_ = num_signals;
+    ShrinkSearchMemoryPools(&local_model_);
+  }
+
   SharedClasses* shared_;
   const bool split_in_chunks_;
   const bool stop_at_first_solution_;
   Model local_model_;
 
+  // Only accessed by the thread running the task, except memory_id_ and
+  // stopped_for_memory_ which are constant after the constructor.
+  int memory_id_;
+  std::atomic<bool>* stopped_for_memory_ = nullptr;
+  double next_memory_report_dtime_ = 0.0;
+  int64_t num_memory_pressure_signals_ = 0;
+
   // The first chunk is special. It is the one in which we load the model and
   // try to follow the hint.
   bool solving_first_chunk_ = true;
@@ -2693,6 +2816,14 @@ class ObjectiveShavingSolver : public SubSolver {
       stop_current_chunk_.store(false);
       task_in_flight_ = true;
       objective_lb_ = shared_->response->GetInnerObjectiveLowerBound();
+
+      // The window must not contain the best known solution, otherwise this
+      // task cannot prove anything.
+      current_delta_ = std::max(
+          IntegerValue(0),
+          std::min(delta_,
+                   shared_->response->GetInnerObjectiveUpperBound() -
+                       objective_lb_ - 1));
     }
     return [this]() {
       if (ResetModel()) {
@@ -2716,7 +2847,19 @@ class ObjectiveShavingSolver : public SubSolver {
         } else if (local_response.status() == CpSolverStatus::INFEASIBLE) {
           absl::MutexLock mutex_lock(&mutex_);
           shared_->response->UpdateInnerObjectiveBounds(
-              Info(), objective_lb_ + 1, kMaxIntegerValue);
+              Info(), objective_lb_ + current_delta_ + 1, kMaxIntegerValue);
+
+          GrowWindow();
+          last_proof_dtime_ = local_repo_->GetOrCreate<TimeLimit>()
+                                  ->GetElapsedDeterministicTime();
+        } else {
+          // If we ran out of budget, the window was too large.
+          absl::MutexLock mutex_lock(&mutex_);
+          if (current_delta_ > 0 &&
+              local_repo_->GetOrCreate<TimeLimit>()
+                      ->GetElapsedDeterministicTime() >= WindowBudget()) {
+            delta_ = current_delta_ / 2;
+          }
         }
       }
 
@@ -2755,6 +2898,18 @@ class ObjectiveShavingSolver : public SubSolver {
                         " csts=", local_proto_.constraints().size(), ")");
   }
 
+  // The deterministic time allowed for a task with a non-empty window. There
+  // is no limit when we only probe objective == lb, like before.
+  double WindowBudget() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
+    return std::max(1.0, 2.0 * last_proof_dtime_);
+  }
+
+  // Called when the current window was proven infeasible.
+  void GrowWindow() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
+    delta_ =
+        IntegerValue(CapAdd(CapProd(2, current_delta_.value()), int64_t{1}));
+  }
+
   bool ResetModel() {
     local_repo_ = std::make_unique<Model>(name());
     *local_repo_->GetOrCreate<SatParameters>() = local_params_;
@@ -2762,13 +2917,24 @@ class ObjectiveShavingSolver : public SubSolver {
     auto* time_limit = local_repo_->GetOrCreate<TimeLimit>();
     shared_->time_limit->UpdateLocalLimit(time_limit);
     time_limit->RegisterSecondaryExternalBooleanAsLimit(&stop_current_chunk_);
+    {
+      absl::MutexLock mutex_lock(&mutex_);
+      if (current_delta_ > 0) {
+        time_limit->ChangeDeterministicLimit(
+            std::min(time_limit->GetDeterministicLimit(), WindowBudget()));
+      }
+    }
 
     // We copy the model.
     local_proto_ = *shared_->model_proto;
     *local_proto_.mutable_variables() =
         helper_->FullNeighborhood().delta.variables();
 
-    // We replace the objective by a constraint, objective == lb.
+    // We replace the objective by a constraint, lb <= objective <= lb + delta.
+    // The window starts empty (objective == lb) and grows each time we prove
+    // it infeasible, so that easy gaps are closed in a few tasks. It shrinks
+    // back if we fail to conclude within WindowBudget().
+    //
     // TODO(user): We could use objective <= lb, it might be better or worse
     // depending on the model. It is also a bit tricker to make sure a feasible
     // solution is feasible.
@@ -2781,14 +2947,14 @@ class ObjectiveShavingSolver : public SubSolver {
       obj_var->clear_domain();
       absl::MutexLock mutex_lock(&mutex_);
       obj_var->add_domain(objective_lb_.value());
-      obj_var->add_domain(objective_lb_.value());
+      obj_var->add_domain((objective_lb_ + current_delta_).value());
     } else {
       auto* obj = local_proto_.add_constraints()->mutable_linear();
       *obj->mutable_vars() = local_proto_.objective().vars();
       *obj->mutable_coeffs() = local_proto_.objective().coeffs();
       absl::MutexLock mutex_lock(&mutex_);
       obj->add_domain(objective_lb_.value());
-      obj->add_domain(objective_lb_.value());
+      obj->add_domain((objective_lb_ + current_delta_).value());
     }
 
     // Clear the objective.
@@ -2804,8 +2970,9 @@ class ObjectiveShavingSolver : public SubSolver {
           PresolveCpModel(context.get(), &postsolve_mapping_);
       if (presolve_status == CpSolverStatus::INFEASIBLE) {
         absl::MutexLock mutex_lock(&mutex_);
-        shared_->response->UpdateInnerObjectiveBounds(Info(), objective_lb_ + 1,
-                                                      kMaxIntegerValue);
+        shared_->response->UpdateInnerObjectiveBounds(
+            Info(), objective_lb_ + current_delta_ + 1, kMaxIntegerValue);
+        GrowWindow();
         return false;
       }
     }
@@ -2843,6 +3010,12 @@ class ObjectiveShavingSolver : public SubSolver {
   absl::Mutex mutex_;
   IntegerValue objective_lb_ ABSL_GUARDED_BY(mutex_);
   bool task_in_flight_ ABSL_GUARDED_BY(mutex_) = false;
+
+  // The current task probes [objective_lb_, objective_lb_ + current_delta_].
+  // The next one will use delta_, adjusted from the outcome of this one.
+  IntegerValue delta_ ABSL_GUARDED_BY(mutex_) = 0;
+  IntegerValue current_delta_ ABSL_GUARDED_BY(mutex_) = 0;
+  double last_proof_dtime_ ABSL_GUARDED_BY(mutex_) = 0.0;
 };
 
 class FeasibilityPumpSolver : public SubSolver {
@@ -2963,16 +3136,30 @@ class LnsSolver : public SubSolver {
         generator_(std::move(generator)),
         helper_(helper),
         parameters_(parameters),
-        shared_(shared) {}
+        shared_(shared) {
+    shared_->lns_selector.Register(generator_.get());
+  }
 
   ~LnsSolver() override {
+    shared_->lns_selector.Unregister(generator_.get());
     shared_->stat_tables.AddTimingStat(*this);
     shared_->stat_tables.AddLnsStat(name(), *generator_);
+
+    if (!VLOG_IS_ON(1)) return;
+    shared_->stats->AddStats(
+        {{absl::StrCat(name(), "/num_calls"), generator_->num_calls()},
+         {absl::StrCat(name(), "/num_improving_calls"),
+          generator_->num_improving_calls()},
+         {absl::StrCat(name(), "/total_dtime_ms"),
+          static_cast<int64_t>(1000 * generator_->total_deterministic_time())},
+         {absl::StrCat(name(), "/total_objective_gain"),
+          static_cast<int64_t>(generator_->total_objective_gain())}});
   }
 
   bool TaskIsAvailable() override {
     if (shared_->SearchIsDone()) return false;
-    return generator_->ReadyToGenerate();
+    if (!generator_->ReadyToGenerate()) return false;
+    return shared_->lns_selector.ShouldSchedule(generator_.get());
   }
 
   std::function<void()> GenerateTask(int64_t task_id) override {
@@ -3078,7 +3265,10 @@ class LnsSolver : public SubSolver {
       auto context = std::make_unique<PresolveContext>(
           &local_model, &lns_fragment, &mapping_proto);
 
-      *lns_fragment.mutable_variables() = neighborhood.delta.variables();
+      // The neighborhood is not used after this, so we can steal its
+      // variables and solution hint instead of copying them.
+      lns_fragment.mutable_variables()->Swap(
+          neighborhood.delta.mutable_variables());
       {
         ModelCopy copier(context.get());
 
@@ -3102,8 +3292,8 @@ class LnsSolver : public SubSolver {
 
       // Overwrite solution hinting.
       if (neighborhood.delta.has_solution_hint()) {
-        *lns_fragment.mutable_solution_hint() =
-            neighborhood.delta.solution_hint();
+        lns_fragment.mutable_solution_hint()->Swap(
+            neighborhood.delta.mutable_solution_hint());
       }
       if (generator_->num_consecutive_non_improving_calls() > 10 &&
           absl::Bernoulli(random, 0.5)) {
@@ -3374,6 +3564,20 @@ void SolveCpModelParallel(const CpModelProto& model_proto,
     shared.clauses = std::make_unique<SharedClausesManager>(always_synchronize);
   }
 
+  // Save the shared state to disk periodically, and reload it if asked.
+  std::unique_ptr<SharedStateCheckpointer> checkpointer;
+  if (!params.checkpoint_file().empty()) {
+    checkpointer = std::make_unique<SharedStateCheckpointer>(
+        model_proto, params.checkpoint_file(),
+        absl::Seconds(params.checkpoint_period_in_seconds()), shared.response,
+        shared.bounds.get(), shared.clauses.get());
+    if (params.resume_from_checkpoint()) {
+      const absl::Status status = checkpointer->Resume();
+      SOLVER_LOG(shared.logger, "Resuming from ", params.checkpoint_file(),
+                 ": ", status.ok() ? "done" : status.ToString());
+    }
+  }
+
   // The list of all the SubSolver that will be used in this parallel search.
   std::vector<std::unique_ptr<SubSolver>> subsolvers;
   std::vector<std::unique_ptr<SubSolver>> incomplete_subsolvers;
@@ -3393,6 +3597,51 @@ void SolveCpModelParallel(const CpModelProto& model_proto,
           shared.clauses->Synchronize();
         }
       }));
+  if (checkpointer != nullptr) {
+    subsolvers.push_back(std::make_unique<SynchronizationPoint>(
+        "checkpoint", [&checkpointer]() { checkpointer->MaybeCheckpoint(); }));
+  }
+
+  // Under memory pressure, first ask the workers to shrink their pools. If the
+  // memory is still above the limit at the next check, also stop the worst
+  // worker. The checks are spaced by one second, since the memory is not freed
+  // right away.
+  if (params.memory_shedding_ratio() > 0.0 && !params.interleave_search()) {
+    const int64_t kMegaByte = 1024 * 1024;
+    const double memory_limit = params.memory_shedding_ratio() *
+                                params.max_memory_in_mb() * kMegaByte;
+    subsolvers.push_back(std::make_unique<SynchronizationPoint>(
+        "memory_shedding",
+        [&shared, memory_limit, next_check_time = 0.0,
+         under_pressure = false]() mutable {
+          const double now = shared.wall_timer->Get();
+          if (now < next_check_time) return;
+          next_check_time = now + 1.0;
+          const int64_t memory_usage =
+              ::operations_research::sysinfo::MemoryUsageProcess();
+          if (memory_usage <= memory_limit) {
+            under_pressure = false;
+            return;
+          }
+          shared.memory->SignalMemoryPressure();
+          if (!under_pressure) {
+            under_pressure = true;
+            SOLVER_LOG(shared.logger, "Memory usage of ",
+                       memory_usage / kMegaByte,
+                       " MB is over the limit, shrinking the pools.");
+            return;
+          }
+          const std::string stopped = shared.memory->StopWorstWorker(
+              [&shared](const std::string& name) {
+                return shared.response->NumImprovements(name);
+              });
+          if (!stopped.empty()) {
+            SOLVER_LOG(shared.logger, "Memory usage of ",
+                       memory_usage / kMegaByte,
+                       " MB is over the limit, stopping ", stopped, ".");
+          }
+        }));
+  }
 
   // Add the NeighborhoodGeneratorHelper as a special subsolver so that its
   // Synchronize() is called before any LNS neighborhood solvers.
@@ -3480,7 +3729,7 @@ void SolveCpModelParallel(const CpModelProto& model_proto,
       incomplete_subsolvers.push_back(std::make_unique<FeasibilityJumpSolver>(
           "violation_ls", SubSolver::INCOMPLETE, linear_model, local_params,
           shared.time_limit, shared.response, shared.bounds.get(), shared.stats,
-          &shared.stat_tables));
+          &shared.stat_tables, &shared.linear_evaluator_views));
     }
   }
 
@@ -3567,7 +3816,7 @@ void SolveCpModelParallel(const CpModelProto& model_proto,
       incomplete_subsolvers.push_back(std::make_unique<FeasibilityJumpSolver>(
           name, SubSolver::FIRST_SOLUTION, linear_model, local_params,
           shared.time_limit, shared.response, shared.bounds.get(), shared.stats,
-          &shared.stat_tables));
+          &shared.stat_tables, &shared.linear_evaluator_views));
     }
     for (const SatParameters& local_params : GetFirstSolutionParams(
              params, model_proto, num_first_solution_subsolvers)) {
@@ -3833,6 +4082,8 @@ void SolveCpModelParallel(const CpModelProto& model_proto,
     if (shared.clauses) {
       shared.clauses->LogStatistics(logger);
     }
+
+    shared.memory->LogStatistics(logger);
   }
 }
 
@@ -4117,7 +4368,25 @@ CpSolverResponse SolveCpModel(const CpModelProto& model_proto, Model* model) {
   auto context = std::make_unique<PresolveContext>(model, new_cp_model_proto,
                                                    mapping_proto);
 
-  if (absl::GetFlag(FLAGS_debug_model_copy)) {
+  // If a PresolveCache was registered, we look there first. For simplicity,
+  // we only use it when nothing depends on the hint or on the assumptions
+  // before the presolve.
+  std::vector<int> postsolve_mapping;
+  PresolveCache* presolve_cache = model->Mutable<PresolveCache>();
+  const bool use_presolve_cache =
+      presolve_cache != nullptr && params.cp_model_presolve() &&
+      model_proto.assumptions().empty() &&
+      !params.fix_variables_to_their_hinted_value() &&
+      !absl::GetFlag(FLAGS_debug_model_copy) &&
+      !absl::GetFlag(FLAGS_cp_model_ignore_objective);
+  const bool presolve_cache_hit =
+      use_presolve_cache &&
+      presolve_cache->Lookup(model_proto, params, new_cp_model_proto,
+                             mapping_proto, &postsolve_mapping);
+
+  if (presolve_cache_hit) {
+    SOLVER_LOG(logger, "Presolved model found in the cache.");
+  } else if (absl::GetFlag(FLAGS_debug_model_copy)) {
     *new_cp_model_proto = model_proto;
   } else if (!ImportModelWithBasicPresolveIntoContext(model_proto,
                                                       context.get())) {
@@ -4275,9 +4544,9 @@ CpSolverResponse SolveCpModel(const CpModelProto& model_proto, Model* model) {
   }
 
   // Do the actual presolve.
-  std::vector<int> postsolve_mapping;
   const CpSolverStatus presolve_status =
-      PresolveCpModel(context.get(), &postsolve_mapping);
+      presolve_cache_hit ? CpSolverStatus::UNKNOWN
+                         : PresolveCpModel(context.get(), &postsolve_mapping);
 
   if (presolve_status != CpSolverStatus::UNKNOWN) {
     SOLVER_LOG(logger, "Problem closed by presolve.");
@@ -4446,10 +4715,18 @@ CpSolverResponse SolveCpModel(const CpModelProto& model_proto, Model* model) {
     TestSolutionHintForFeasibility(*new_cp_model_proto, logger, nullptr);
   }
 
-  if (params.symmetry_level() > 1) {
+  // A cached presolved model already contains its symmetries.
+  if (params.symmetry_level() > 1 && !presolve_cache_hit) {
     DetectAndAddSymmetryToProto(params, new_cp_model_proto, logger);
   }
 
+  // We do not cache a presolve that might have been interrupted.
+  if (use_presolve_cache && !presolve_cache_hit &&
+      !shared_time_limit->LimitReached()) {
+    presolve_cache->Store(model_proto, params, *new_cp_model_proto,
+                          *mapping_proto, postsolve_mapping);
+  }
+
   LoadDebugSolution(*new_cp_model_proto, model);
 
   // Linear model (used by feasibility_jump and violation_ls)
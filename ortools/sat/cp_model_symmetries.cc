@@ -514,9 +514,12 @@ void FindCpModelSymmetries(
       &equivalence_classes, generators, &factorized_automorphism_group_size,
       time_limit.get());
 
-  // TODO(user): Change the API to not return an error when the time limit is
-  // reached.
-  if (!status.ok()) {
+  // Reaching the time limit is not an error: the generators found so far are
+  // all valid permutations and we just use what we have.
+  if (absl::IsDeadlineExceeded(status)) {
+    SOLVER_LOG(logger, "[Symmetry] Time limit reached with ",
+               generators->size(), " generators found. ", status.message());
+  } else if (!status.ok()) {
     SOLVER_LOG(logger,
                "[Symmetry] GraphSymmetryFinder error: ", status.message());
   }
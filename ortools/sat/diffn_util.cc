@@ -43,24 +43,58 @@ std::vector<absl::Span<int>> GetOverlappingRectangleComponents(
     const std::vector<Rectangle>& rectangles,
     absl::Span<int> active_rectangles) {
   if (active_rectangles.empty()) return {};
-
-  std::vector<absl::Span<int>> result;
   const int size = active_rectangles.size();
-  for (int start = 0; start < size;) {
-    // Find the component of active_rectangles[start].
-    int end = start + 1;
-    for (int i = start; i < end; i++) {
-      for (int j = end; j < size; ++j) {
-        if (!rectangles[active_rectangles[i]].IsDisjoint(
-                rectangles[active_rectangles[j]])) {
-          std::swap(active_rectangles[end++], active_rectangles[j]);
-        }
-      }
+
+  // Sweep over the x axis by increasing x_min, keeping the rectangles whose
+  // x-range may still contain the sweep position. Only those are tested for
+  // overlap, instead of all the pairs.
+  std::vector<int> by_x_min(size);
+  for (int i = 0; i < size; ++i) by_x_min[i] = i;
+  std::sort(by_x_min.begin(), by_x_min.end(), [&](int a, int b) {
+    return rectangles[active_rectangles[a]].x_min <
+           rectangles[active_rectangles[b]].x_min;
+  });
+  DenseConnectedComponentsFinder union_find;
+  union_find.SetNumberOfNodes(size);
+  std::vector<int> sweep_set;
+  for (const int i : by_x_min) {
+    const Rectangle& rectangle = rectangles[active_rectangles[i]];
+    int new_size = 0;
+    for (const int j : sweep_set) {
+      const Rectangle& other = rectangles[active_rectangles[j]];
+      // "other" is disjoint from all the rectangles not yet swept.
+      if (other.x_max <= rectangle.x_min) continue;
+      sweep_set[new_size++] = j;
+      if (!rectangle.IsDisjoint(other)) union_find.AddEdge(i, j);
     }
-    if (end > start + 1) {
-      result.push_back(active_rectangles.subspan(start, end - start));
+    sweep_set.resize(new_size);
+    sweep_set.push_back(i);
+  }
+
+  // Regroup each component contiguously. Components are ordered by their first
+  // rectangle, and each keeps the relative order of its rectangles.
+  const std::vector<int> component_ids = union_find.GetComponentIds();
+  const int num_components = union_find.GetNumberOfComponents();
+  std::vector<int> component_starts(num_components + 1, 0);
+  for (const int id : component_ids) ++component_starts[id + 1];
+  for (int c = 0; c < num_components; ++c) {
+    component_starts[c + 1] += component_starts[c];
+  }
+  std::vector<int> sorted(size);
+  std::vector<int> positions(component_starts.begin(),
+                             component_starts.end() - 1);
+  for (int i = 0; i < size; ++i) {
+    sorted[positions[component_ids[i]]++] = active_rectangles[i];
+  }
+  std::copy(sorted.begin(), sorted.end(), active_rectangles.begin());
+
+  std::vector<absl::Span<int>> result;
+  for (int c = 0; c < num_components; ++c) {
+    const int start = component_starts[c];
+    const int component_size = component_starts[c + 1] - start;
+    if (component_size > 1) {
+      result.push_back(active_rectangles.subspan(start, component_size));
     }
-    start = end;
   }
   return result;
 }
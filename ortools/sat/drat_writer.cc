@@ -13,14 +13,16 @@
 
 #include "ortools/sat/drat_writer.h"
 
+#include <cstdint>
 #include <string>
+
 #if !defined(__PORTABLE_PLATFORM__)
 #include "ortools/base/file.h"
 #include "ortools/base/helpers.h"
 #include "ortools/base/options.h"
 #endif  // !__PORTABLE_PLATFORM__
 #include "absl/log/check.h"
-#include "absl/strings/str_format.h"
+#include "absl/strings/str_cat.h"
 #include "absl/types/span.h"
 #include "ortools/sat/sat_base.h"
 
@@ -37,20 +39,41 @@ DratWriter::~DratWriter() {
 }
 
 void DratWriter::AddClause(absl::Span<const Literal> clause) {
+  if (in_binary_format_) buffer_.push_back('a');
   WriteClause(clause);
 }
 
 void DratWriter::DeleteClause(absl::Span<const Literal> clause) {
-  buffer_ += "d ";
+  if (in_binary_format_) {
+    buffer_.push_back('d');
+  } else {
+    buffer_ += "d ";
+  }
   WriteClause(clause);
 }
 
+void DratWriter::AppendBinaryLiteral(Literal literal) {
+  // Literal::Index() is already 2 * variable + (negated ? 1 : 0) with
+  // 0-based variables, the DRAT encoding uses 1-based variables.
+  uint32_t value = literal.Index().value() + 2;
+  while (value > 127) {
+    buffer_.push_back(static_cast<char>((value & 127) | 128));
+    value >>= 7;
+  }
+  buffer_.push_back(static_cast<char>(value));
+}
+
 void DratWriter::WriteClause(absl::Span<const Literal> clause) {
-  for (const Literal literal : clause) {
-    absl::StrAppendFormat(&buffer_, "%d ", literal.SignedValue());
+  if (in_binary_format_) {
+    for (const Literal literal : clause) AppendBinaryLiteral(literal);
+    buffer_.push_back(0);
+  } else {
+    for (const Literal literal : clause) {
+      absl::StrAppend(&buffer_, literal.SignedValue(), " ");
+    }
+    buffer_ += "0\n";
   }
-  buffer_ += "0\n";
-  if (buffer_.size() > 10000) {
+  if (buffer_.size() > kBufferSize) {
 #if !defined(__PORTABLE_PLATFORM__)
     CHECK_OK(file::WriteString(output_, buffer_, file::Defaults()));
 #endif  // !__PORTABLE_PLATFORM__
@@ -51,7 +51,13 @@ class DratWriter {
  private:
   void WriteClause(absl::Span<const Literal> clause);
 
-  // TODO(user): Support binary format as proof in text format can be large.
+  // Appends one literal in the DRAT binary encoding: 2 * var + sign, written
+  // as a little-endian sequence of 7-bit groups.
+  void AppendBinaryLiteral(Literal literal);
+
+  // Flushes `buffer_` to `output_` once it exceeds this size.
+  static constexpr int kBufferSize = 1 << 20;
+
   bool in_binary_format_;
   File* output_;
 
@@ -33,6 +33,7 @@
 #include "absl/random/bit_gen_ref.h"
 #include "absl/random/distributions.h"
 #include "absl/strings/str_cat.h"
+#include "absl/synchronization/mutex.h"
 #include "absl/types/span.h"
 #include "ortools/algorithms/binary_search.h"
 #include "ortools/base/logging.h"
@@ -103,6 +104,25 @@ std::pair<int64_t, double> JumpTable::GetJump(int var) {
   return std::make_pair(deltas_[var], scores_[var]);
 }
 
+void SharedLinearEvaluatorViews::ShareOrRegister(
+    int linearization_level, LinearIncrementalEvaluator* evaluator) {
+  std::shared_ptr<const LinearIncrementalEvaluator::CompactView> view;
+  {
+    absl::MutexLock mutex_lock(&mutex_);
+    const auto [it, inserted] =
+        views_.insert({linearization_level, evaluator->SharedCompactView()});
+    if (inserted) return;
+    view = it->second;
+  }
+
+  // The comparison is done outside the lock. It can only fail if some other
+  // parameters changed the linear constraints, in which case we just keep our
+  // own copy.
+  if (!evaluator->UseCompactView(std::move(view))) {
+    VLOG(2) << "Could not share the linear evaluator view.";
+  }
+}
+
 FeasibilityJumpSolver::~FeasibilityJumpSolver() {
   stat_tables_->AddTimingStat(*this);
   stat_tables_->AddLsStat(name(), num_batches_, num_restarts_,
@@ -135,6 +155,11 @@ void FeasibilityJumpSolver::Initialize() {
                                       linear_model_->ignored_constraints(),
                                       linear_model_->additional_constraints());
   }
+  if (shared_views_ != nullptr) {
+    shared_views_->ShareOrRegister(
+        params_.feasibility_jump_linearization_level(),
+        evaluator_->MutableLinearEvaluator());
+  }
 
   const int num_variables = linear_model_->model_proto().variables().size();
   var_domains_.resize(num_variables);
@@ -273,6 +298,21 @@ void FeasibilityJumpSolver::ResetCurrentSolution() {
       }
     }
   }
+
+  // The first time, start from the solution hint if there is one. When the
+  // hint is close to feasible, this is usually the fastest way to a first
+  // solution. Later restarts use the default values above for diversity.
+  const CpModelProto& model_proto = linear_model_->model_proto();
+  if (num_restarts_ <= 1 && model_proto.has_solution_hint()) {
+    for (int i = 0; i < model_proto.solution_hint().vars_size(); ++i) {
+      const int ref = model_proto.solution_hint().vars(i);
+      const int var = PositiveRef(ref);
+      if (var_domains_[var].IsFixed()) continue;
+      const int64_t value = model_proto.solution_hint().values(i);
+      solution[var] =
+          var_domains_[var].ClosestValue(RefIsPositive(ref) ? value : -value);
+    }
+  }
 }
 
 void FeasibilityJumpSolver::PerturbateCurrentSolution() {
@@ -972,8 +1012,7 @@ bool FeasibilityJumpSolver::ScanRelevantVariables(int num_to_scan,
       continue;
     }
     const auto [delta, scan_score] = jumps.GetJump(var);
-    if ((num_general_evals_ + num_linear_evals_) % 100 == 0 &&
-        shared_time_limit_ != nullptr && shared_time_limit_->LimitReached()) {
+    if (shared_time_limit_ != nullptr && time_limit_checker_.LimitReached()) {
       time_limit_crossed_ = true;
       return false;
     }
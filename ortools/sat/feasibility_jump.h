@@ -23,8 +23,11 @@
 #include <utility>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/functional/any_invocable.h"
 #include "absl/functional/bind_front.h"
+#include "absl/synchronization/mutex.h"
 #include "absl/types/span.h"
 #include "ortools/sat/constraint_violation.h"
 #include "ortools/sat/linear_model.h"
@@ -34,6 +37,7 @@
 #include "ortools/sat/synchronization.h"
 #include "ortools/sat/util.h"
 #include "ortools/util/sorted_interval_list.h"
+#include "ortools/util/time_limit.h"
 
 namespace operations_research::sat {
 
@@ -92,13 +96,33 @@ class JumpTable {
 // "Feasibility Jump: an LP-free Lagrangian MIP heuristic", Bjørnar
 // Luteberget, Giorgio Sartor, 2023, Mathematical Programming Computation.
 //
+// Shares the static part of the linear evaluator (the model and its transpose)
+// between all the FeasibilityJumpSolver created from the same LinearModel, so
+// that the memory does not grow with the number of workers. The views are
+// indexed by feasibility_jump_linearization_level() since it changes the set
+// of linear constraints.
+//
+// This class is thread-safe.
+class SharedLinearEvaluatorViews {
+ public:
+  SharedLinearEvaluatorViews() = default;
+
+  // If there is a view registered for the given level, make the evaluator use
+  // it. Otherwise register the view of the evaluator. The evaluator compact
+  // view must have been computed.
+  void ShareOrRegister(int linearization_level,
+                       LinearIncrementalEvaluator* evaluator);
+
+ private:
+  absl::Mutex mutex_;
+  absl::flat_hash_map<
+      int, std::shared_ptr<const LinearIncrementalEvaluator::CompactView>>
+      views_ ABSL_GUARDED_BY(mutex_);
+};
+
 // This is basically a Guided local search (GLS) with a nice algo to know what
 // value an integer variable should move to (its jump value). For binary, it
 // can only be swapped, so the situation is easier.
-//
-// TODO(user): If we have more than one of these solver, we might want to share
-// the evaluator memory between them. Right now we basically keep a copy of the
-// model and its transpose for each FeasibilityJumpSolver.
 class FeasibilityJumpSolver : public SubSolver {
  public:
   FeasibilityJumpSolver(const std::string name, SubSolver::SubsolverType type,
@@ -107,15 +131,18 @@ class FeasibilityJumpSolver : public SubSolver {
                         SharedResponseManager* shared_response,
                         SharedBoundsManager* shared_bounds,
                         SharedStatistics* shared_stats,
-                        SharedStatTables* stat_tables)
+                        SharedStatTables* stat_tables,
+                        SharedLinearEvaluatorViews* shared_views = nullptr)
       : SubSolver(name, type),
         linear_model_(linear_model),
         params_(params),
         shared_time_limit_(shared_time_limit),
+        time_limit_checker_(shared_time_limit, /*check_period=*/100),
         shared_response_(shared_response),
         shared_bounds_(shared_bounds),
         shared_stats_(shared_stats),
         stat_tables_(stat_tables),
+        shared_views_(shared_views),
         random_(params_),
         linear_jumps_(
             absl::bind_front(&FeasibilityJumpSolver::ComputeLinearJump, this)),
@@ -220,10 +247,12 @@ class FeasibilityJumpSolver : public SubSolver {
   const LinearModel* linear_model_;
   SatParameters params_;
   ModelSharedTimeLimit* shared_time_limit_;
+  SharedTimeLimitChecker time_limit_checker_;
   SharedResponseManager* shared_response_;
   SharedBoundsManager* shared_bounds_ = nullptr;
   SharedStatistics* shared_stats_;
   SharedStatTables* stat_tables_;
+  SharedLinearEvaluatorViews* shared_views_;
   ModelRandomGenerator random_;
 
   // Synchronization Booleans.
@@ -1306,9 +1306,27 @@ bool IntegerTrail::Enqueue(IntegerLiteral i_lit,
                          trail_index_with_same_reason);
 }
 
+bool IntegerTrail::EnqueueWithSameReason(
+    absl::Span<const IntegerLiteral> i_lits,
+    absl::Span<const Literal> literal_reason,
+    absl::Span<const IntegerLiteral> integer_reason) {
+  // The first TrailEntry created by these calls will store the reason, and all
+  // the other ones will refer to it. Note that this also works if the first
+  // pushes do not create any entry.
+  const int trail_index_with_same_reason = integer_trail_.size();
+  for (const IntegerLiteral i_lit : i_lits) {
+    if (!EnqueueInternal(i_lit, nullptr, literal_reason, integer_reason,
+                         trail_index_with_same_reason)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 bool IntegerTrail::Enqueue(IntegerLiteral i_lit,
                            LazyReasonFunction lazy_reason) {
-  return EnqueueInternal(i_lit, lazy_reason, {}, {}, integer_trail_.size());
+  return EnqueueInternal(i_lit, std::move(lazy_reason), {}, {},
+                         integer_trail_.size());
 }
 
 bool IntegerTrail::ReasonIsValid(
@@ -1727,7 +1745,7 @@ bool IntegerTrail::EnqueueInternal(
     if (integer_trail_.size() >= lazy_reasons_.size()) {
       lazy_reasons_.resize(integer_trail_.size() + 1, nullptr);
     }
-    lazy_reasons_[integer_trail_.size()] = lazy_reason;
+    lazy_reasons_[integer_trail_.size()] = std::move(lazy_reason);
     reason_index = -1;
   } else if (trail_index_with_same_reason >= integer_trail_.size()) {
     // Save the reason into our internal buffers.
@@ -469,6 +469,10 @@ class IntegerEncoder {
   // Memory optimization: you can call this before encoding variables.
   void ReserveSpaceForNumVariables(int num_vars);
 
+  // Returns the number of Boolean variables created by this class to encode
+  // integer literals. This is mainly useful for statistics.
+  int64_t NumCreatedVariables() const { return num_created_variables_; }
+
   // Fully encode a variable using its current initial domain.
   // If the variable is already fully encoded, this does nothing.
   //
@@ -990,6 +994,14 @@ class IntegerTrail : public SatPropagator {
       absl::Span<const IntegerLiteral> integer_reason,
       int trail_index_with_same_reason);
 
+  // Same as calling Enqueue() on each of the given literals with the same
+  // reason, except that the reason is only stored once. This is meant for
+  // propagators that push many bounds at once with the same explanation.
+  ABSL_MUST_USE_RESULT bool EnqueueWithSameReason(
+      absl::Span<const IntegerLiteral> i_lits,
+      absl::Span<const Literal> literal_reason,
+      absl::Span<const IntegerLiteral> integer_reason);
+
   // Lazy reason API.
   //
   // The function is provided with the IntegerLiteral to explain and its index
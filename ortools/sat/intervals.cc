@@ -292,7 +292,7 @@ bool SchedulingConstraintHelper::Propagate() {
 
 bool SchedulingConstraintHelper::IncrementalPropagate(
     const std::vector<int>& watch_indices) {
-  for (const int t : watch_indices) recompute_cache_[t] = true;
+  for (const int t : watch_indices) recompute_cache_.Set(t);
   return true;
 }
 
@@ -325,7 +325,6 @@ void SchedulingConstraintHelper::RegisterWith(GenericLiteralWatcher* watcher) {
 }
 
 bool SchedulingConstraintHelper::UpdateCachedValues(int t) {
-  recompute_cache_[t] = false;
   if (IsAbsent(t)) return true;
 
   IntegerValue smin = integer_trail_->LowerBound(starts_[t]);
@@ -430,7 +429,7 @@ void SchedulingConstraintHelper::InitSortedVectors() {
   const int num_tasks = starts_.size();
 
   recompute_all_cache_ = true;
-  recompute_cache_.resize(num_tasks, true);
+  recompute_cache_.ClearAndResize(num_tasks);
 
   // Make sure all the cached_* arrays can hold enough data.
   CHECK_LE(num_tasks, capacity_);
@@ -483,12 +482,11 @@ bool SchedulingConstraintHelper::SynchronizeAndSetTimeDirection(
       if (!UpdateCachedValues(t)) return false;
     }
   } else {
-    for (int t = 0; t < recompute_cache_.size(); ++t) {
-      if (recompute_cache_[t]) {
-        if (!UpdateCachedValues(t)) return false;
-      }
+    for (const int t : recompute_cache_.PositionsSetAtLeastOnce()) {
+      if (!UpdateCachedValues(t)) return false;
     }
   }
+  recompute_cache_.SparseClearAll();
   recompute_all_cache_ = false;
   return true;
 }
@@ -37,6 +37,7 @@
 #include "ortools/sat/precedences.h"
 #include "ortools/sat/sat_base.h"
 #include "ortools/sat/sat_solver.h"
+#include "ortools/util/bitset.h"
 #include "ortools/util/rev.h"
 #include "ortools/util/strong_integers.h"
 
@@ -589,9 +590,10 @@ class SchedulingConstraintHelper : public PropagatorInterface,
   bool recompute_negated_shifted_end_max_ = true;
 
   // If recompute_cache_[t] is true, then we need to update all the cached
-  // value for the task t in SynchronizeAndSetTimeDirection().
+  // value for the task t in SynchronizeAndSetTimeDirection(). This is a sparse
+  // bitset so that we only loop over the modified tasks there.
   bool recompute_all_cache_ = true;
-  std::vector<bool> recompute_cache_;
+  SparseBitset<int> recompute_cache_;
 
   // Reason vectors.
   std::vector<Literal> literal_reason_;
@@ -166,13 +166,16 @@ bool LbTreeSearch::FullRestart() {
   num_decisions_taken_at_last_restart_ = num_decisions_taken_;
   num_nodes_in_tree_ = 0;
   nodes_.clear();
+  free_nodes_.clear();
   current_branch_.clear();
   return sat_solver_->RestoreSolverToAssumptionLevel();
 }
 
-void LbTreeSearch::MarkAsDeletedNodeAndUnreachableSubtree(Node& node) {
+void LbTreeSearch::MarkAsDeletedNodeAndUnreachableSubtree(NodeIndex n) {
+  Node& node = nodes_[n];
   --num_nodes_in_tree_;
   node.is_deleted = true;
+  free_nodes_.push_back(n);
   if (sat_solver_->Assignment().LiteralIsTrue(node.literal)) {
     MarkSubtreeAsDeleted(node.false_child);
   } else {
@@ -188,6 +191,7 @@ void LbTreeSearch::MarkSubtreeAsDeleted(NodeIndex root) {
 
     --num_nodes_in_tree_;
     nodes_[n].is_deleted = true;
+    free_nodes_.push_back(n);
 
     to_delete.push_back(nodes_[n].true_child);
     to_delete.push_back(nodes_[n].false_child);
@@ -229,6 +233,10 @@ SatSolver::Status LbTreeSearch::Search(
   const int kMaxNumInitialRestarts = 10;
   const int64_t kNumDecisionsBeforeInitialRestarts = 1000;
 
+  // To keep the memory bounded on long runs, we also restart when the tree
+  // gets too large. With 32 bytes per node, this is about 512 MB.
+  const int kMaxNumNodesInTree = 1 << 24;
+
   while (!time_limit_->LimitReached() && !shared_response_->ProblemIsSolved()) {
     // This is the current bound we try to improve. We cache it here to avoid
     // getting the lock many times and it is also easier to follow the code if
@@ -333,6 +341,11 @@ SatSolver::Status LbTreeSearch::Search(
               << ")";
       if (!FullRestart()) return sat_solver_->UnsatStatus();
     }
+    if (num_nodes_in_tree_ > kMaxNumNodesInTree) {
+      VLOG(2) << "lb_tree_search (memory_restart " << SmallProgressString()
+              << ")";
+      if (!FullRestart()) return sat_solver_->UnsatStatus();
+    }
 
     // Backtrack if needed.
     //
@@ -433,7 +446,7 @@ SatSolver::Status LbTreeSearch::Search(
           n = node.false_child;
           new_lb = node.false_objective;
         }
-        MarkAsDeletedNodeAndUnreachableSubtree(node);
+        MarkAsDeletedNodeAndUnreachableSubtree(current_branch_[level]);
 
         // We jump directly to the subnode.
         // Else we will change the root.
@@ -665,18 +678,24 @@ std::vector<Literal> LbTreeSearch::ExtractDecisions(
 }
 
 void LbTreeSearch::AppendNewNodeToCurrentBranch(Literal decision) {
-  const NodeIndex n(nodes_.size());
+  NodeIndex n(nodes_.size());
   ++num_nodes_in_tree_;
-  nodes_.emplace_back(Literal(decision), current_objective_lb_);
+  if (free_nodes_.empty()) {
+    nodes_.emplace_back(Literal(decision), current_objective_lb_);
+  } else {
+    n = free_nodes_.back();
+    free_nodes_.pop_back();
+    nodes_[n] = Node(Literal(decision), current_objective_lb_);
+  }
   if (!current_branch_.empty()) {
     const NodeIndex parent = current_branch_.back();
     if (sat_solver_->Assignment().LiteralIsTrue(nodes_[parent].literal)) {
       nodes_[parent].true_child = n;
-      nodes_[parent].UpdateTrueObjective(nodes_.back().MinObjective());
+      nodes_[parent].UpdateTrueObjective(nodes_[n].MinObjective());
     } else {
       CHECK(sat_solver_->Assignment().LiteralIsFalse(nodes_[parent].literal));
       nodes_[parent].false_child = n;
-      nodes_[parent].UpdateFalseObjective(nodes_.back().MinObjective());
+      nodes_[parent].UpdateFalseObjective(nodes_[n].MinObjective());
     }
   }
   current_branch_.push_back(n);
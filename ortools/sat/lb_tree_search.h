@@ -89,6 +89,10 @@ class LbTreeSearch {
     // The decision for the true and false branch under this node.
     /*const*/ Literal literal;
 
+    // Indicates if this nodes was removed from the tree. This is here rather
+    // than at the end so that a Node only takes 32 bytes.
+    bool is_deleted = false;
+
     // The objective lower bound in both branches.
     IntegerValue true_objective;
     IntegerValue false_objective;
@@ -96,9 +100,6 @@ class LbTreeSearch {
     // Points to adjacent nodes in the tree. Large if no connection.
     NodeIndex true_child = NodeIndex(std::numeric_limits<int32_t>::max());
     NodeIndex false_child = NodeIndex(std::numeric_limits<int32_t>::max());
-
-    // Indicates if this nodes was removed from the tree.
-    bool is_deleted = false;
   };
 
   // Display the current tree, this is mainly here to investigate ideas to
@@ -117,8 +118,9 @@ class LbTreeSearch {
   bool FullRestart();
 
   // Mark the given node as deleted. Its literal is assumed to be set. We also
-  // delete the subtree that is not longer relevant.
-  void MarkAsDeletedNodeAndUnreachableSubtree(Node& node);
+  // delete the subtree that is not longer relevant. The memory of the deleted
+  // nodes is reused by the next nodes we create.
+  void MarkAsDeletedNodeAndUnreachableSubtree(NodeIndex n);
   void MarkSubtreeAsDeleted(NodeIndex root);
 
   // Create a new node at the end of the current branch.
@@ -157,9 +159,11 @@ class LbTreeSearch {
   // We temporarily cache the shared_response_ objective lb here.
   IntegerValue current_objective_lb_;
 
-  // Memory for all the nodes.
+  // Memory for all the nodes. The deleted nodes are kept in free_nodes_ until
+  // they are reused, so nodes_.size() is the maximum size the tree ever had.
   int num_nodes_in_tree_ = 0;
   absl::StrongVector<NodeIndex, Node> nodes_;
+  std::vector<NodeIndex> free_nodes_;
 
   // The list of nodes in the current branch, in order from the root.
   std::vector<NodeIndex> current_branch_;
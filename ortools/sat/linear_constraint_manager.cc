@@ -284,36 +284,92 @@ bool LinearConstraintManager::AddCut(const LinearConstraint& ct,
   return true;
 }
 
-void LinearConstraintManager::PermanentlyRemoveSomeConstraints() {
-  std::vector<double> deletable_constraint_counts;
+void LinearConstraintManager::SimplifyAllConstraints() {
+  absl::StrongVector<ConstraintIndex, bool> to_remove;
   for (ConstraintIndex i(0); i < constraint_infos_.size(); ++i) {
-    if (constraint_infos_[i].is_deletable && !constraint_infos_[i].is_in_lp) {
-      deletable_constraint_counts.push_back(constraint_infos_[i].active_count);
+    // This constraint was merged into an earlier one. Its hash is now owned by
+    // the kept constraint, so we must not touch it.
+    if (!to_remove.empty() && to_remove[i]) continue;
+    if (!SimplifyConstraint(&constraint_infos_[i].constraint)) continue;
+    ++num_simplifications_;
+
+    // Note that the canonicalization shouldn't be needed since the order
+    // of the variable is not changed by the simplification, and we only
+    // reduce the coefficients at both end of the spectrum.
+    DivideByGCD(&constraint_infos_[i].constraint);
+    DCHECK(DebugCheckConstraint(constraint_infos_[i].constraint));
+
+    constraint_infos_[i].objective_parallelism_computed = false;
+    constraint_infos_[i].l2_norm =
+        ComputeL2Norm(constraint_infos_[i].constraint);
+    FillDerivedFields(&constraint_infos_[i]);
+
+    if (constraint_infos_[i].is_in_lp) current_lp_is_changed_ = true;
+    equiv_constraints_.erase(constraint_infos_[i].hash);
+    constraint_infos_[i].hash =
+        ComputeHashOfTerms(constraint_infos_[i].constraint);
+    const auto [it, inserted] =
+        equiv_constraints_.insert({constraint_infos_[i].hash, i});
+    if (inserted) continue;
+
+    // Because we simplified this constraint, it is possible that it is now a
+    // duplicate of another one. Merge them, keeping the one in the LP if any.
+    const ConstraintIndex j = it->second;
+    const bool keep_i = constraint_infos_[i].is_in_lp;
+    const ConstraintIndex kept = keep_i ? i : j;
+    const ConstraintIndex removed = keep_i ? j : i;
+    if (!MergeDuplicateConstraint(kept, removed)) {
+      it->second = i;
+      continue;
     }
+    it->second = kept;
+    if (to_remove.empty()) to_remove.resize(constraint_infos_.size(), false);
+    to_remove[removed] = true;
   }
-  if (deletable_constraint_counts.empty()) return;
-  std::sort(deletable_constraint_counts.begin(),
-            deletable_constraint_counts.end());
+  if (!to_remove.empty()) RemoveConstraints(to_remove);
+}
 
-  // We will delete the oldest (in the order they where added) cleanup target
-  // constraints with a count lower or equal to this.
-  double active_count_threshold = std::numeric_limits<double>::infinity();
-  if (sat_parameters_.cut_cleanup_target() <
-      deletable_constraint_counts.size()) {
-    active_count_threshold =
-        deletable_constraint_counts[sat_parameters_.cut_cleanup_target()];
+bool LinearConstraintManager::MergeDuplicateConstraint(ConstraintIndex kept,
+                                                       ConstraintIndex removed) {
+  ConstraintInfo& kept_info = constraint_infos_[kept];
+  const ConstraintInfo& removed_info = constraint_infos_[removed];
+  if (removed_info.is_in_lp) return false;
+  if (kept_info.constraint.vars != removed_info.constraint.vars ||
+      kept_info.constraint.coeffs != removed_info.constraint.coeffs) {
+    return false;
+  }
+
+  if (removed_info.constraint.lb > kept_info.constraint.lb ||
+      removed_info.constraint.ub < kept_info.constraint.ub) {
+    if (kept_info.is_in_lp) current_lp_is_changed_ = true;
+    kept_info.constraint.lb =
+        std::max(kept_info.constraint.lb, removed_info.constraint.lb);
+    kept_info.constraint.ub =
+        std::min(kept_info.constraint.ub, removed_info.constraint.ub);
+    FillDerivedFields(&kept_info);
   }
 
+  // A problem constraint must never be deleted.
+  if (removed_info.is_deletable) --num_deletable_constraints_;
+  if (kept_info.is_deletable && !removed_info.is_deletable) {
+    kept_info.is_deletable = false;
+    --num_deletable_constraints_;
+  }
+  kept_info.active_count =
+      std::max(kept_info.active_count, removed_info.active_count);
+  ++num_merged_constraints_;
+  return true;
+}
+
+void LinearConstraintManager::RemoveConstraints(
+    const absl::StrongVector<ConstraintIndex, bool>& to_remove) {
   ConstraintIndex new_size(0);
   equiv_constraints_.clear();
   absl::StrongVector<ConstraintIndex, ConstraintIndex> index_mapping(
       constraint_infos_.size());
-  int num_deleted_constraints = 0;
   for (ConstraintIndex i(0); i < constraint_infos_.size(); ++i) {
-    if (constraint_infos_[i].is_deletable && !constraint_infos_[i].is_in_lp &&
-        constraint_infos_[i].active_count <= active_count_threshold &&
-        num_deleted_constraints < sat_parameters_.cut_cleanup_target()) {
-      ++num_deleted_constraints;
+    if (to_remove[i]) {
+      DCHECK(!constraint_infos_[i].is_in_lp);
       continue;
     }
 
@@ -332,6 +388,40 @@ void LinearConstraintManager::PermanentlyRemoveSomeConstraints() {
   for (int i = 0; i < lp_constraints_.size(); ++i) {
     lp_constraints_[i] = index_mapping[lp_constraints_[i]];
   }
+}
+
+void LinearConstraintManager::PermanentlyRemoveSomeConstraints() {
+  std::vector<double> deletable_constraint_counts;
+  for (ConstraintIndex i(0); i < constraint_infos_.size(); ++i) {
+    if (constraint_infos_[i].is_deletable && !constraint_infos_[i].is_in_lp) {
+      deletable_constraint_counts.push_back(constraint_infos_[i].active_count);
+    }
+  }
+  if (deletable_constraint_counts.empty()) return;
+  std::sort(deletable_constraint_counts.begin(),
+            deletable_constraint_counts.end());
+
+  // We will delete the oldest (in the order they where added) cleanup target
+  // constraints with a count lower or equal to this.
+  double active_count_threshold = std::numeric_limits<double>::infinity();
+  if (sat_parameters_.cut_cleanup_target() <
+      deletable_constraint_counts.size()) {
+    active_count_threshold =
+        deletable_constraint_counts[sat_parameters_.cut_cleanup_target()];
+  }
+
+  absl::StrongVector<ConstraintIndex, bool> to_remove(constraint_infos_.size(),
+                                                      false);
+  int num_deleted_constraints = 0;
+  for (ConstraintIndex i(0); i < constraint_infos_.size(); ++i) {
+    if (constraint_infos_[i].is_deletable && !constraint_infos_[i].is_in_lp &&
+        constraint_infos_[i].active_count <= active_count_threshold &&
+        num_deleted_constraints < sat_parameters_.cut_cleanup_target()) {
+      ++num_deleted_constraints;
+      to_remove[i] = true;
+    }
+  }
+  RemoveConstraints(to_remove);
 
   if (num_deleted_constraints > 0) {
     VLOG(3) << "Constraint manager cleanup: #deleted:"
@@ -529,33 +619,8 @@ bool LinearConstraintManager::ChangeLp(glop::BasisState* solution_state,
   // of potential new constraints.
   bool rescale_active_count = false;
   const double tolerance = 1e-6;
+  if (simplify_constraints) SimplifyAllConstraints();
   for (ConstraintIndex i(0); i < constraint_infos_.size(); ++i) {
-    // Inprocessing of the constraint.
-    if (simplify_constraints &&
-        SimplifyConstraint(&constraint_infos_[i].constraint)) {
-      ++num_simplifications_;
-
-      // Note that the canonicalization shouldn't be needed since the order
-      // of the variable is not changed by the simplification, and we only
-      // reduce the coefficients at both end of the spectrum.
-      DivideByGCD(&constraint_infos_[i].constraint);
-      DCHECK(DebugCheckConstraint(constraint_infos_[i].constraint));
-
-      constraint_infos_[i].objective_parallelism_computed = false;
-      constraint_infos_[i].l2_norm =
-          ComputeL2Norm(constraint_infos_[i].constraint);
-      FillDerivedFields(&constraint_infos_[i]);
-
-      if (constraint_infos_[i].is_in_lp) current_lp_is_changed_ = true;
-      equiv_constraints_.erase(constraint_infos_[i].hash);
-      constraint_infos_[i].hash =
-          ComputeHashOfTerms(constraint_infos_[i].constraint);
-
-      // TODO(user): Because we simplified this constraint, it is possible that
-      // it is now a duplicate of another one. Merge them.
-      equiv_constraints_[constraint_infos_[i].hash] = i;
-    }
-
     if (constraint_infos_[i].is_in_lp) continue;
 
     // ComputeActivity() often represent the bulk of the time spent in
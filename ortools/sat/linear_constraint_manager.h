@@ -217,6 +217,20 @@ class LinearConstraintManager {
   // Make sure the lb/ub are tight and fill lb_is_trivial/ub_is_trivial.
   void FillDerivedFields(ConstraintInfo* info);
 
+  // Calls SimplifyConstraint() on all constraints, and merges the ones that
+  // become identical to another constraint.
+  void SimplifyAllConstraints();
+
+  // If the two constraints have the same terms and removed is not in the LP,
+  // merges the bounds of removed into kept and returns true. The caller is
+  // responsible for removing the constraint afterwards.
+  bool MergeDuplicateConstraint(ConstraintIndex kept, ConstraintIndex removed);
+
+  // Deletes the given constraints, none of them must be in the LP. This
+  // invalidates all the ConstraintIndex.
+  void RemoveConstraints(
+      const absl::StrongVector<ConstraintIndex, bool>& to_remove);
+
   const SatParameters& sat_parameters_;
   const IntegerTrail& integer_trail_;
 
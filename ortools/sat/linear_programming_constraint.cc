@@ -850,14 +850,10 @@ bool LinearProgrammingConstraint::AnalyzeLp() {
       }
 
       // Push reduced cost strengthening bounds.
-      if (!deductions_.empty()) {
-        const int trail_index_with_same_reason = integer_trail_->Index();
-        for (const IntegerLiteral deduction : deductions_) {
-          if (!integer_trail_->Enqueue(deduction, {}, deductions_reason_,
-                                       trail_index_with_same_reason)) {
-            return false;
-          }
-        }
+      if (!deductions_.empty() &&
+          !integer_trail_->EnqueueWithSameReason(deductions_, {},
+                                                 deductions_reason_)) {
+        return false;
       }
     }
   }
@@ -47,7 +47,7 @@ class Model {
     // The order of deletion seems to be platform dependent.
     // We force a reverse order on the cleanup vector.
     for (int i = cleanup_list_.size() - 1; i >= 0; --i) {
-      cleanup_list_[i].reset();
+      cleanup_list_[i].deleter(cleanup_list_[i].object);
     }
   }
 
@@ -154,7 +154,7 @@ class Model {
    */
   template <typename T>
   T* TakeOwnership(T* t) {
-    cleanup_list_.emplace_back(new Delete<T>(t));
+    cleanup_list_.push_back({t, &DeleteObject<T>});
     return t;
   }
 
@@ -204,25 +204,21 @@ class Model {
   // Map of FastTypeId<T> to a "singleton" of type T.
   absl::flat_hash_map</*typeid*/ size_t, void*> singletons_;
 
-  struct DeleteInterface {
-    virtual ~DeleteInterface() = default;
-  };
   template <typename T>
-  class Delete : public DeleteInterface {
-   public:
-    explicit Delete(T* t) : to_delete_(t) {}
-    ~Delete() override = default;
-
-   private:
-    std::unique_ptr<T> to_delete_;
-  };
+  static void DeleteObject(void* object) {
+    delete static_cast<T*>(object);
+  }
 
-  // The list of items to delete.
+  // The list of items to delete, with the function that deletes each one.
   //
-  // TODO(user): I don't think we need the two layers of unique_ptr, but we
-  // don't care too much about efficiency here and this was easier to get
-  // working.
-  std::vector<std::unique_ptr<DeleteInterface>> cleanup_list_;
+  // Storing a plain function pointer instead of a heap-allocated type-erased
+  // deleter saves one allocation per owned object, which adds up since each
+  // worker model creates many of them.
+  struct Cleanup {
+    void* object;
+    void (*deleter)(void*);
+  };
+  std::vector<Cleanup> cleanup_list_;
 };
 
 }  // namespace sat
@@ -395,9 +395,10 @@ SatSolver::Status FindCores(std::vector<Literal> assumptions,
     // core.
     std::vector<int> indices;
     {
-      absl::btree_set<Literal> temp(core.begin(), core.end());
+      absl::flat_hash_set<LiteralIndex> temp;
+      for (const Literal l : core) temp.insert(l.Index());
       for (int i = 0; i < assumptions.size(); ++i) {
-        if (temp.contains(assumptions[i])) {
+        if (temp.contains(assumptions[i].Index())) {
           indices.push_back(i);
         }
       }
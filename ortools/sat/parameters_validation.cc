@@ -78,6 +78,7 @@ std::string ValidateParameters(const SatParameters& params) {
   TEST_IS_FINITE(merge_no_overlap_work_limit);
   TEST_IS_FINITE(merge_at_most_one_work_limit);
   TEST_IS_FINITE(min_orthogonality_for_lp_constraints);
+  TEST_IS_FINITE(checkpoint_period_in_seconds);
   TEST_IS_FINITE(mip_var_scaling);
   TEST_IS_FINITE(cut_max_active_count_value);
   TEST_IS_FINITE(cut_active_count_decay);
@@ -99,6 +100,7 @@ std::string ValidateParameters(const SatParameters& params) {
   TEST_IN_RANGE(min_num_lns_workers, 0, kMaxReasonableParallelism);
   TEST_IN_RANGE(shared_tree_num_workers, 0, kMaxReasonableParallelism);
   TEST_IN_RANGE(interleave_batch_size, 0, kMaxReasonableParallelism);
+  TEST_IN_RANGE(presolve_num_threads, 1, kMaxReasonableParallelism);
 
   // TODO(user): Consider using annotations directly in the proto for these
   // validation. It is however not open sourced.
@@ -134,10 +136,13 @@ std::string ValidateParameters(const SatParameters& params) {
   TEST_NON_NEGATIVE(mip_wanted_precision);
   TEST_NON_NEGATIVE(max_time_in_seconds);
   TEST_NON_NEGATIVE(max_deterministic_time);
+  TEST_NON_NEGATIVE(checkpoint_period_in_seconds);
   TEST_NON_NEGATIVE(new_constraints_batch_size);
   TEST_NON_NEGATIVE(probing_deterministic_time_limit);
   TEST_NON_NEGATIVE(presolve_probing_deterministic_time_limit);
   TEST_NON_NEGATIVE(linearization_level);
+  TEST_NON_NEGATIVE(chronological_backtracking_threshold);
+  TEST_IN_RANGE(memory_shedding_ratio, 0.0, 1.0);
 
   if (params.enumerate_all_solutions() &&
       (params.num_search_workers() > 1 || params.num_workers() > 1)) {
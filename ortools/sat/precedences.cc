@@ -588,7 +588,12 @@ void PrecedencesPropagator::AddArc(
   if (!enforcement_literals.empty()) {
     const OptionalArcIndex arc_index(potential_arcs_.size());
     potential_arcs_.push_back(
-        {tail, head, offset, offset_var, enforcement_literals});
+        {tail,
+         head,
+         offset,
+         offset_var,
+         /*is_marked=*/false,
+         {enforcement_literals.begin(), enforcement_literals.end()}});
     impacted_potential_arcs_[tail].push_back(arc_index);
     impacted_potential_arcs_[NegationOf(head)].push_back(arc_index);
     if (offset_var != kNoIntegerVariable) {
@@ -640,7 +645,12 @@ void PrecedencesPropagator::AddArc(
     // enforcement_literals.
     const ArcIndex arc_index(arcs_.size());
     arcs_.push_back(
-        {a.tail_var, a.head_var, offset, a.offset_var, enforcement_literals});
+        {a.tail_var,
+         a.head_var,
+         offset,
+         a.offset_var,
+         /*is_marked=*/false,
+         {enforcement_literals.begin(), enforcement_literals.end()}});
     auto& presence_literals = arcs_.back().presence_literals;
     if (integer_trail_->IsOptional(a.head_var)) {
       // TODO(user): More generally, we can remove any literal that is implied
@@ -284,12 +284,18 @@ class PrecedencesPropagator : public SatPropagator, PropagatorInterface {
     IntegerValue offset;
     IntegerVariable offset_var;  // kNoIntegerVariable if none.
 
-    // This arc is "present" iff all these literals are true.
-    absl::InlinedVector<Literal, 6> presence_literals;
-
     // Used temporarily by our implementation of the Bellman-Ford algorithm. It
     // should be false at the beginning of BellmanFordTarjan().
+    //
+    // It is stored here so that it fits in the padding after offset_var.
     mutable bool is_marked;
+
+    // This arc is "present" iff all these literals are true.
+    //
+    // Note that 4 is the largest inlined size that does not make the vector
+    // bigger than its heap-allocated representation. This keeps the arcs,
+    // which are scanned in the propagation inner loop, at 48 bytes.
+    absl::InlinedVector<Literal, 4> presence_literals;
   };
 
   // Internal functions to add new precedence relations.
@@ -0,0 +1,156 @@
+// Copyright 2010-2022 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ortools/sat/presolve_cache.h"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/synchronization/mutex.h"
+#include "ortools/base/hash.h"
+#include "ortools/sat/cp_model.pb.h"
+#include "ortools/sat/cp_model_utils.h"
+#include "ortools/sat/sat_parameters.pb.h"
+
+namespace operations_research {
+namespace sat {
+
+namespace {
+
+// Returns the serialized parameters, without the ones that only change the
+// limits, the logs or what is done after the presolve.
+std::string SerializeParametersForPresolve(const SatParameters& params) {
+  SatParameters copy = params;
+  copy.clear_max_time_in_seconds();
+  copy.clear_max_deterministic_time();
+  copy.clear_max_memory_in_mb();
+  copy.clear_absolute_gap_limit();
+  copy.clear_relative_gap_limit();
+  copy.clear_stop_after_first_solution();
+  copy.clear_log_search_progress();
+  copy.clear_log_subsolver_statistics();
+  copy.clear_log_prefix();
+  copy.clear_log_to_stdout();
+  copy.clear_log_to_response();
+  copy.clear_fill_tightened_domains_in_response();
+  copy.clear_fill_additional_solutions_in_response();
+  copy.clear_checkpoint_file();
+  copy.clear_checkpoint_period_in_seconds();
+  copy.clear_resume_from_checkpoint();
+  copy.clear_presolve_num_threads();
+  std::string result;
+  copy.SerializeToString(&result);
+  return result;
+}
+
+uint64_t ComputeFingerprint(const CpModelProto& model_proto,
+                            const std::string& params) {
+  return FingerprintModel(
+      model_proto,
+      fasthash64(params.data(), params.size(), kDefaultFingerprintSeed));
+}
+
+}  // namespace
+
+PresolveCache::PresolveCache(int64_t max_size_in_bytes)
+    : max_size_in_bytes_(max_size_in_bytes) {}
+
+bool PresolveCache::Lookup(const CpModelProto& model_proto,
+                           const SatParameters& params,
+                           CpModelProto* presolved_model,
+                           CpModelProto* mapping_model,
+                           std::vector<int>* postsolve_mapping) {
+  const std::string serialized_params = SerializeParametersForPresolve(params);
+  const uint64_t fingerprint =
+      ComputeFingerprint(model_proto, serialized_params);
+
+  absl::MutexLock mutex_lock(&mutex_);
+  const auto it = fingerprint_to_entry_.find(fingerprint);
+  if (it == fingerprint_to_entry_.end() ||
+      it->second->params != serialized_params ||
+      it->second->model != model_proto.SerializeAsString()) {
+    ++num_misses_;
+    return false;
+  }
+  ++num_hits_;
+  entries_.splice(entries_.begin(), entries_, it->second);
+  const Entry& entry = *it->second;
+  *presolved_model = entry.presolved_model;
+  *mapping_model = entry.mapping_model;
+  *postsolve_mapping = entry.postsolve_mapping;
+  return true;
+}
+
+void PresolveCache::Store(const CpModelProto& model_proto,
+                          const SatParameters& params,
+                          const CpModelProto& presolved_model,
+                          const CpModelProto& mapping_model,
+                          const std::vector<int>& postsolve_mapping) {
+  Entry entry;
+  entry.params = SerializeParametersForPresolve(params);
+  entry.fingerprint = ComputeFingerprint(model_proto, entry.params);
+  model_proto.SerializeToString(&entry.model);
+  entry.size_in_bytes =
+      entry.model.size() + entry.params.size() +
+      presolved_model.ByteSizeLong() + mapping_model.ByteSizeLong() +
+      postsolve_mapping.size() * sizeof(int);
+  if (entry.size_in_bytes > max_size_in_bytes_) return;
+  entry.presolved_model = presolved_model;
+  entry.mapping_model = mapping_model;
+  entry.postsolve_mapping = postsolve_mapping;
+
+  absl::MutexLock mutex_lock(&mutex_);
+  const auto it = fingerprint_to_entry_.find(entry.fingerprint);
+  if (it != fingerprint_to_entry_.end()) {
+    // Either the same model was presolved concurrently, or this is a
+    // fingerprint collision. In both cases we keep the newest entry.
+    size_in_bytes_ -= it->second->size_in_bytes;
+    entries_.erase(it->second);
+    fingerprint_to_entry_.erase(it);
+  }
+  while (size_in_bytes_ + entry.size_in_bytes > max_size_in_bytes_) {
+    const Entry& last = entries_.back();
+    size_in_bytes_ -= last.size_in_bytes;
+    fingerprint_to_entry_.erase(last.fingerprint);
+    entries_.pop_back();
+  }
+  size_in_bytes_ += entry.size_in_bytes;
+  const uint64_t fingerprint = entry.fingerprint;
+  entries_.push_front(std::move(entry));
+  fingerprint_to_entry_[fingerprint] = entries_.begin();
+}
+
+int64_t PresolveCache::num_entries() const {
+  absl::MutexLock mutex_lock(&mutex_);
+  return entries_.size();
+}
+
+int64_t PresolveCache::size_in_bytes() const {
+  absl::MutexLock mutex_lock(&mutex_);
+  return size_in_bytes_;
+}
+
+int64_t PresolveCache::num_hits() const {
+  absl::MutexLock mutex_lock(&mutex_);
+  return num_hits_;
+}
+
+int64_t PresolveCache::num_misses() const {
+  absl::MutexLock mutex_lock(&mutex_);
+  return num_misses_;
+}
+
+}  // namespace sat
+}  // namespace operations_research
@@ -0,0 +1,100 @@
+// Copyright 2010-2022 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OR_TOOLS_SAT_PRESOLVE_CACHE_H_
+#define OR_TOOLS_SAT_PRESOLVE_CACHE_H_
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
+#include "ortools/sat/cp_model.pb.h"
+#include "ortools/sat/sat_parameters.pb.h"
+
+namespace operations_research {
+namespace sat {
+
+// An in-memory cache of the result of the presolve, to skip it when the same
+// model is solved again with the same parameters. An entry contains the
+// presolved model, with the symmetry generators found by the solver if any,
+// the mapping model and the postsolve mapping.
+//
+// The cache is opt-in: it is only used if it is registered in the Model
+// passed to SolveCpModel():
+//
+//   PresolveCache cache(/*max_size_in_bytes=*/1 << 30);
+//   Model model;
+//   model.Register<PresolveCache>(&cache);
+//   const CpSolverResponse response = SolveCpModel(model_proto, &model);
+//
+// The cache must outlive the solves using it. The lookups are keyed by a
+// fingerprint of the model and of the parameters that can change the
+// presolve, and the full model and parameters are compared on a match, so a
+// fingerprint collision never returns the presolve of another model. When
+// the cache is full, the least recently used entries are evicted.
+//
+// This class is thread-safe.
+class PresolveCache {
+ public:
+  explicit PresolveCache(int64_t max_size_in_bytes);
+
+  // Copies the cached presolve of model_proto with params into the given
+  // protos and returns true, or returns false if there is none.
+  bool Lookup(const CpModelProto& model_proto, const SatParameters& params,
+              CpModelProto* presolved_model, CpModelProto* mapping_model,
+              std::vector<int>* postsolve_mapping);
+
+  // Adds the presolve of model_proto with params to the cache. Does nothing
+  // if the entry is larger than the whole cache.
+  void Store(const CpModelProto& model_proto, const SatParameters& params,
+             const CpModelProto& presolved_model,
+             const CpModelProto& mapping_model,
+             const std::vector<int>& postsolve_mapping);
+
+  int64_t num_entries() const;
+  int64_t size_in_bytes() const;
+  int64_t num_hits() const;
+  int64_t num_misses() const;
+
+ private:
+  struct Entry {
+    uint64_t fingerprint;
+    std::string model;
+    std::string params;
+    CpModelProto presolved_model;
+    CpModelProto mapping_model;
+    std::vector<int> postsolve_mapping;
+    int64_t size_in_bytes;
+  };
+
+  const int64_t max_size_in_bytes_;
+
+  mutable absl::Mutex mutex_;
+
+  // The most recently used entry is first.
+  std::list<Entry> entries_ ABSL_GUARDED_BY(mutex_);
+  absl::flat_hash_map<uint64_t, std::list<Entry>::iterator>
+      fingerprint_to_entry_ ABSL_GUARDED_BY(mutex_);
+  int64_t size_in_bytes_ ABSL_GUARDED_BY(mutex_) = 0;
+  int64_t num_hits_ ABSL_GUARDED_BY(mutex_) = 0;
+  int64_t num_misses_ ABSL_GUARDED_BY(mutex_) = 0;
+};
+
+}  // namespace sat
+}  // namespace operations_research
+
+#endif  // OR_TOOLS_SAT_PRESOLVE_CACHE_H_
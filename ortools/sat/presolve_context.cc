@@ -432,13 +432,13 @@ ABSL_MUST_USE_RESULT bool PresolveContext::IntersectDomainWith(
     if (domains[var].IsIncludedIn(domain)) {
       return true;
     }
-    domains[var] = domains[var].IntersectionWith(domain);
+    domains[var].IntersectInPlace(domain);
   } else {
     const Domain temp = domain.Negation();
     if (domains[var].IsIncludedIn(temp)) {
       return true;
     }
-    domains[var] = domains[var].IntersectionWith(temp);
+    domains[var].IntersectInPlace(temp);
   }
 
   if (domain_modified != nullptr) {
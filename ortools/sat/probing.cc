@@ -245,6 +245,9 @@ bool Prober::ProbeBooleanVariables(
   int num_probed = 0;
 
   for (const BooleanVariable b : bool_vars) {
+    // Probing often fixes many variables of the list before we reach them,
+    // there is no need to even look at those.
+    if (assignment_.VariableIsAssigned(b)) continue;
     const Literal literal(b, true);
     if (implication_graph_->RepresentativeOf(literal) != literal) {
       continue;
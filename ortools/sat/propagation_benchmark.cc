@@ -0,0 +1,112 @@
+// Copyright 2010-2022 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Micro-benchmarks of the core propagation loops of the SAT solver: the clause
+// propagation done by the LiteralWatchers and the bound updates done by the
+// IntegerTrail.
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "ortools/base/logging.h"
+#include "ortools/sat/integer.h"
+#include "ortools/sat/model.h"
+#include "ortools/sat/sat_base.h"
+#include "ortools/sat/sat_solver.h"
+
+namespace operations_research {
+namespace sat {
+namespace {
+
+// Random 3-SAT below the satisfiability threshold, so that long chains of
+// decisions can be taken before a conflict.
+void AddRandom3SatClauses(int num_variables, double clause_ratio,
+                          std::mt19937* random, SatSolver* solver) {
+  solver->SetNumVariables(num_variables);
+  const int num_clauses = static_cast<int>(clause_ratio * num_variables);
+  std::vector<Literal> clause;
+  for (int c = 0; c < num_clauses; ++c) {
+    clause.clear();
+    while (clause.size() < 3) {
+      const BooleanVariable var((*random)() % num_variables);
+      bool duplicate = false;
+      for (const Literal l : clause) duplicate |= l.Variable() == var;
+      if (!duplicate) clause.push_back(Literal(var, (*random)() % 2 == 0));
+    }
+    CHECK(solver->AddProblemClause(clause));
+  }
+}
+
+// Takes random decisions until all the variables are assigned, and then
+// backtracks to level zero. The decisions that lead to a conflict are undone
+// without learning anything, so the clause database stays the same.
+void BM_ClausePropagation(benchmark::State& state) {
+  const int num_variables = state.range(0);
+  std::mt19937 random(12345);
+  Model model;
+  SatSolver* solver = model.GetOrCreate<SatSolver>();
+  AddRandom3SatClauses(num_variables, 3.5, &random, solver);
+  const Trail& trail = *model.GetOrCreate<Trail>();
+
+  std::vector<Literal> decisions;
+  for (int i = 0; i < num_variables; ++i) {
+    decisions.push_back(Literal(BooleanVariable(i), random() % 2 == 0));
+  }
+  int64_t num_assigned = 0;
+  for (auto _ : state) {
+    std::shuffle(decisions.begin(), decisions.end(), random);
+    for (const Literal decision : decisions) {
+      if (solver->Assignment().LiteralIsAssigned(decision)) continue;
+      solver->EnqueueDecisionIfNotConflicting(decision);
+    }
+    num_assigned += trail.Index();
+    solver->Backtrack(0);
+  }
+  state.SetItemsProcessed(num_assigned);
+}
+BENCHMARK(BM_ClausePropagation)->Arg(1000)->Arg(10000)->Arg(100000);
+
+// Pushes the lower bound of all the variables once, with a decision as the
+// reason, and backtracks.
+void BM_IntegerTrailEnqueue(benchmark::State& state) {
+  const int num_variables = state.range(0);
+  Model model;
+  SatSolver* solver = model.GetOrCreate<SatSolver>();
+  IntegerTrail* integer_trail = model.GetOrCreate<IntegerTrail>();
+  std::vector<IntegerVariable> vars;
+  for (int i = 0; i < num_variables; ++i) {
+    vars.push_back(model.Add(NewIntegerVariable(0, 1000)));
+  }
+  const Literal decision(solver->NewBooleanVariable(), true);
+  const std::vector<Literal> reason = {decision.Negated()};
+
+  for (auto _ : state) {
+    CHECK(solver->EnqueueDecisionIfNotConflicting(decision));
+    for (const IntegerVariable var : vars) {
+      CHECK(integer_trail->Enqueue(
+          IntegerLiteral::GreaterOrEqual(var,
+                                         integer_trail->LowerBound(var) + 1),
+          reason, {}));
+    }
+    solver->Backtrack(0);
+  }
+  state.SetItemsProcessed(state.iterations() * num_variables);
+}
+BENCHMARK(BM_IntegerTrailEnqueue)->Arg(1000)->Arg(100000);
+
+}  // namespace
+}  // namespace sat
+}  // namespace operations_research
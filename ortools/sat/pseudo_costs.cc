@@ -89,15 +89,18 @@ IntegerVariable PseudoCosts::GetBestDecisionVar() {
   // TODO(user): Avoid the O(num_relevant_variable) loop.
   // In practice since a variable only become relevant after 100 records, this
   // list might be small compared to the number of variable though.
+  //
+  // We test the score first since it is cheaper than looking at the bounds, and
+  // most variables cannot improve the best score anyway.
   for (const IntegerVariable positive_var : relevant_variables_) {
+    const double score = scores_[positive_var];
+    if (score <= best_score) continue;
     if (integer_trail_->IsCurrentlyIgnored(positive_var)) continue;
     const IntegerValue lb = integer_trail_->LowerBound(positive_var);
     const IntegerValue ub = integer_trail_->UpperBound(positive_var);
     if (lb >= ub) continue;
-    if (scores_[positive_var] > best_score) {
-      chosen_var = positive_var;
-      best_score = scores_[positive_var];
-    }
+    chosen_var = positive_var;
+    best_score = score;
   }
 
   // Pick the direction with best pseudo cost.
@@ -2788,6 +2788,9 @@ class CpSolver:
             sat_parameters_pb2.SatParameters()
         )
         self.log_callback: Optional[swig_helper.LogCallback] = None
+        # If true, the solution callback runs on its own thread and only sees
+        # the latest solution when it cannot keep up with the search.
+        self.asynchronous_solution_callback: bool = False
         self.__solve_wrapper: Optional[swig_helper.SolveWrapper] = None
         self.__lock: threading.Lock = threading.Lock()
 
@@ -2802,7 +2805,12 @@ class CpSolver:
 
         self.__solve_wrapper.SetParameters(self.parameters)
         if solution_callback is not None:
-            self.__solve_wrapper.AddSolutionCallback(solution_callback)
+            if self.asynchronous_solution_callback:
+                self.__solve_wrapper.AddAsynchronousSolutionCallback(
+                    solution_callback
+                )
+            else:
+                self.__solve_wrapper.AddSolutionCallback(solution_callback)
 
         if self.log_callback is not None:
             self.__solve_wrapper.AddLogCallback(self.log_callback)
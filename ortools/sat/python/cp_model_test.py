@@ -1278,6 +1278,27 @@ class CpModelTest(absltest.TestCase):
         self.assertEqual(2, solver.Value(x))
         self.assertEqual(4, solver.Value(y))
 
+    def testChronologicalBacktracking(self):
+        print("testChronologicalBacktracking")
+        for num_pigeons, expected_status in [
+            (6, cp_model.OPTIMAL),
+            (7, cp_model.INFEASIBLE),
+        ]:
+            model = cp_model.CpModel()
+            x = [
+                [model.NewBoolVar(f"x_{p}_{h}") for h in range(6)]
+                for p in range(num_pigeons)
+            ]
+            for p in range(num_pigeons):
+                model.AddExactlyOne(x[p])
+            for h in range(6):
+                model.AddAtMostOne(x[p][h] for p in range(num_pigeons))
+            solver = cp_model.CpSolver()
+            solver.parameters.num_workers = 1
+            solver.parameters.cp_model_presolve = False
+            solver.parameters.chronological_backtracking_threshold = 1
+            self.assertEqual(expected_status, solver.Solve(model))
+
     def testStats(self):
         print("testStats")
         model = cp_model.CpModel()
@@ -23,12 +23,14 @@
 
 #include "ortools/sat/swig_helper.h"
 
+#include <cstdint>
 #include <string>
 
 #include "absl/strings/string_view.h"
 #include "ortools/sat/cp_model.pb.h"
 #include "ortools/util/sorted_interval_list.h"
 #include "pybind11/functional.h"
+#include "pybind11/numpy.h"
 #include "pybind11/pybind11.h"
 #include "pybind11/stl.h"
 #include "pybind11_protobuf/native_proto_caster.h"
@@ -43,6 +45,10 @@ using ::operations_research::sat::SolutionCallback;
 using ::operations_research::sat::SolveWrapper;
 using ::pybind11::arg;
 
+using IndexArray =
+    ::pybind11::array_t<int, ::pybind11::array::c_style |
+                                 ::pybind11::array::forcecast>;
+
 class PySolutionCallback : public SolutionCallback {
  public:
   using SolutionCallback::SolutionCallback; /* Inherit constructors */
@@ -80,6 +86,30 @@ PYBIND11_MODULE(swig_helper, m) {
            arg("index"))
       .def("SolutionIntegerValue", &SolutionCallback::SolutionIntegerValue,
            arg("index"))
+      .def(
+          "SolutionIntegerValues",
+          [](SolutionCallback& callback, const IndexArray& indices) {
+            ::pybind11::array_t<int64_t> result(indices.request().shape);
+            const int* const index_ptr = indices.data();
+            int64_t* const ptr = result.mutable_data();
+            for (int i = 0; i < indices.size(); ++i) {
+              ptr[i] = callback.SolutionIntegerValue(index_ptr[i]);
+            }
+            return result;
+          },
+          arg("indices"))
+      .def(
+          "SolutionBooleanValues",
+          [](SolutionCallback& callback, const IndexArray& indices) {
+            ::pybind11::array_t<bool> result(indices.request().shape);
+            const int* const index_ptr = indices.data();
+            bool* const ptr = result.mutable_data();
+            for (int i = 0; i < indices.size(); ++i) {
+              ptr[i] = callback.SolutionBooleanValue(index_ptr[i]);
+            }
+            return result;
+          },
+          arg("indices"))
       .def("StopSearch", &SolutionCallback::StopSearch)
       .def("UserTime", &SolutionCallback::UserTime)
       .def("WallTime", &SolutionCallback::WallTime);
@@ -89,6 +119,8 @@ PYBIND11_MODULE(swig_helper, m) {
       .def("AddLogCallback", &SolveWrapper::AddLogCallback, arg("log_callback"))
       .def("AddSolutionCallback", &SolveWrapper::AddSolutionCallback,
            arg("callback"))
+      .def("AddAsynchronousSolutionCallback",
+           &SolveWrapper::AddAsynchronousSolutionCallback, arg("callback"))
       .def("ClearSolutionCallback", &SolveWrapper::ClearSolutionCallback)
       .def("SetParameters", &SolveWrapper::SetParameters, arg("parameters"))
       .def("Solve",
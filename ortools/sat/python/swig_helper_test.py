@@ -34,6 +34,17 @@ class Callback(swig_helper.SolutionCallback):
         return self.__solution_count
 
 
+class ValuesCallback(swig_helper.SolutionCallback):
+    def __init__(self):
+        swig_helper.SolutionCallback.__init__(self)
+        self.integer_values = []
+        self.boolean_values = []
+
+    def OnSolutionCallback(self):
+        self.integer_values.append(list(self.SolutionIntegerValues([0, 1])))
+        self.boolean_values.append(list(self.SolutionBooleanValues([2, -3])))
+
+
 class SwigHelperTest(absltest.TestCase):
     def testVariableDomain(self):
         model_string = """
@@ -179,6 +190,79 @@ class SwigHelperTest(absltest.TestCase):
         self.assertEqual(5, callback.SolutionCount())
         self.assertEqual(cp_model_pb2.OPTIMAL, solution.status)
 
+    def testSolutionCallbackValues(self):
+        model_string = """
+      variables { domain: 0 domain: 5 }
+      variables { domain: 0 domain: 6 }
+      variables { domain: 0 domain: 1 }
+      constraints {
+        linear { vars: 0 vars: 1 coeffs: 1 coeffs: 1 domain: 6 domain: 6 } }
+      constraints {
+        linear { vars: 0 vars: 2 coeffs: 1 coeffs: -5 domain: 0 domain: 0 } }
+      """
+        model = cp_model_pb2.CpModelProto()
+        self.assertTrue(text_format.Parse(model_string, model))
+
+        solve_wrapper = swig_helper.SolveWrapper()
+        callback = ValuesCallback()
+        solve_wrapper.AddSolutionCallback(callback)
+        params = sat_parameters_pb2.SatParameters()
+        params.enumerate_all_solutions = True
+        solve_wrapper.SetParameters(params)
+        solution = solve_wrapper.Solve(model)
+
+        self.assertEqual(cp_model_pb2.OPTIMAL, solution.status)
+        self.assertCountEqual([[0, 6], [5, 1]], callback.integer_values)
+        self.assertCountEqual([[False, True], [True, False]], callback.boolean_values)
+
+    def testAsynchronousSolutionCallback(self):
+        model_string = """
+      variables { domain: 0 domain: 5 }
+      variables { domain: 0 domain: 5 }
+      constraints {
+        linear { vars: 0 vars: 1 coeffs: 1 coeffs: 1 domain: 6 domain: 6 } }
+      """
+        model = cp_model_pb2.CpModelProto()
+        self.assertTrue(text_format.Parse(model_string, model))
+
+        solve_wrapper = swig_helper.SolveWrapper()
+        callback = Callback()
+        solve_wrapper.AddAsynchronousSolutionCallback(callback)
+        params = sat_parameters_pb2.SatParameters()
+        params.enumerate_all_solutions = True
+        solve_wrapper.SetParameters(params)
+        solution = solve_wrapper.Solve(model)
+
+        # Solutions can be coalesced, but the last one is always delivered.
+        self.assertBetween(callback.SolutionCount(), 1, 5)
+        self.assertEqual(cp_model_pb2.OPTIMAL, solution.status)
+        self.assertEqual(6, sum(callback.Response().solution))
+
+    def testAsynchronousSolutionCallbackReused(self):
+        model_string = """
+      variables { domain: 0 domain: 5 }
+      variables { domain: 0 domain: 5 }
+      constraints {
+        linear { vars: 0 vars: 1 coeffs: 1 coeffs: 1 domain: 6 domain: 6 } }
+      """
+        model = cp_model_pb2.CpModelProto()
+        self.assertTrue(text_format.Parse(model_string, model))
+
+        solve_wrapper = swig_helper.SolveWrapper()
+        callback = Callback()
+        solve_wrapper.AddAsynchronousSolutionCallback(callback)
+        solve_wrapper.Solve(model)
+        first_count = callback.SolutionCount()
+        self.assertGreater(first_count, 0)
+        solve_wrapper.Solve(model)
+        second_count = callback.SolutionCount()
+        self.assertGreater(second_count, first_count)
+
+        solve_wrapper.ClearSolutionCallback(callback)
+        solution = solve_wrapper.Solve(model)
+        self.assertEqual(second_count, callback.SolutionCount())
+        self.assertEqual(cp_model_pb2.OPTIMAL, solution.status)
+
     def testModelStats(self):
         model_string = """
       variables { domain: -10 domain: 10 }
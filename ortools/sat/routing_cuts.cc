@@ -484,19 +484,38 @@ std::vector<int> ComputeGomoryHuTree(
     int num_nodes, const std::vector<ArcWithLpValue>& relevant_arcs) {
   // Initialize the graph. Note that we use only arcs with a relevant lp
   // value, so this should be small in practice.
-  SimpleMaxFlow max_flow;
+  //
+  // The graph and the capacities are the same for the n - 1 max flow calls
+  // below, so we build them only once and just change the source and sink of
+  // the max flow afterwards.
+  using Graph = ::util::ReverseArcStaticGraph<>;
+  std::vector<int> parent(num_nodes, 0);
+  if (num_nodes < 2) return parent;
+  Graph graph(num_nodes, 2 * relevant_arcs.size());
+  std::vector<FlowQuantity> capacities;
+  capacities.reserve(2 * relevant_arcs.size());
   for (const auto& [tail, head, lp_value] : relevant_arcs) {
-    max_flow.AddArcWithCapacity(tail, head, std::round(1.0e6 * lp_value));
-    max_flow.AddArcWithCapacity(head, tail, std::round(1.0e6 * lp_value));
+    const FlowQuantity capacity = std::round(1.0e6 * lp_value);
+    graph.AddArc(tail, head);
+    graph.AddArc(head, tail);
+    capacities.push_back(capacity);
+    capacities.push_back(capacity);
+  }
+  std::vector<Graph::ArcIndex> permutation;
+  graph.Build(&permutation);
+  GenericMaxFlow<Graph> max_flow(&graph, /*source=*/1, /*sink=*/0);
+  for (int arc = 0; arc < capacities.size(); ++arc) {
+    const int permuted_arc = arc < permutation.size() ? permutation[arc] : arc;
+    max_flow.SetArcCapacity(permuted_arc, capacities[arc]);
   }
 
   // Compute an equivalent max-flow tree, according to the paper.
   // This version should actually produce a Gomory-Hu cut tree.
   std::vector<int> min_cut_subset;
-  std::vector<int> parent(num_nodes, 0);
   for (int s = 1; s < num_nodes; ++s) {
     const int t = parent[s];
-    if (max_flow.Solve(s, t) != SimpleMaxFlow::OPTIMAL) break;
+    max_flow.SetSourceAndSink(s, t);
+    if (!max_flow.Solve()) break;
     max_flow.GetSourceSideMinCut(&min_cut_subset);
     bool parent_of_t_in_subset = false;
     for (const int i : min_cut_subset) {
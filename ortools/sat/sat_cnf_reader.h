@@ -278,8 +278,9 @@ class SatCnfReader {
       is_wcnf_ = true;
     }
 
-    static const char kWordDelimiters[] = " ";
-    auto splitter = absl::StrSplit(line, kWordDelimiters, absl::SkipEmpty());
+    // Splitting on a char is a lot faster than on a string, and this loop
+    // dominates the parsing time of large files.
+    auto splitter = absl::StrSplit(line, ' ', absl::SkipEmpty());
 
     tmp_clause_.clear();
     int64_t weight =
@@ -406,13 +406,15 @@ bool Inprocessing::SubsumeAndStrenghtenRound(bool log_info) {
   const LiteralIndex num_literals(sat_solver_->NumVariables() * 2);
   SparseBitset<LiteralIndex> marked(num_literals);
 
-  // Clause index in clauses.
-  // TODO(user): Storing signatures here might be faster?
-  absl::StrongVector<LiteralIndex, absl::InlinedVector<int, 6>> one_watcher(
-      num_literals.value());
-
-  // Clause signatures in the same order as clauses.
-  std::vector<uint64_t> signatures(clauses.size());
+  // Clause index in clauses, along with its signature. Storing the signature
+  // here avoids a random memory access for each inspected clause, and most of
+  // them are filtered by their signature alone.
+  struct WatchedClause {
+    uint64_t signature;
+    int index;
+  };
+  absl::StrongVector<LiteralIndex, absl::InlinedVector<WatchedClause, 2>>
+      one_watcher(num_literals.value());
 
   std::vector<Literal> candidates_for_removal;
   for (int clause_index = 0; clause_index < clauses.size(); ++clause_index) {
@@ -452,8 +454,8 @@ bool Inprocessing::SubsumeAndStrenghtenRound(bool log_info) {
     const uint64_t mask = ~signature;
     for (const Literal l : clause->AsSpan()) {
       num_inspected_signatures += one_watcher[l].size();
-      for (const int i : one_watcher[l]) {
-        if ((mask & signatures[i]) != 0) continue;
+      for (const auto [other_signature, i] : one_watcher[l]) {
+        if ((mask & other_signature) != 0) continue;
 
         bool subsumed = true;
         bool stengthen = true;
@@ -489,8 +491,8 @@ bool Inprocessing::SubsumeAndStrenghtenRound(bool log_info) {
     // For strengthenning we also need to check the negative watcher lists.
     for (const Literal l : clause->AsSpan()) {
       num_inspected_signatures += one_watcher[l.NegatedIndex()].size();
-      for (const int i : one_watcher[l.NegatedIndex()]) {
-        if ((mask & signatures[i]) != 0) continue;
+      for (const auto [other_signature, i] : one_watcher[l.NegatedIndex()]) {
+        if ((mask & other_signature) != 0) continue;
 
         bool stengthen = true;
         num_inspected_literals += clauses[i]->size();
@@ -569,8 +571,7 @@ bool Inprocessing::SubsumeAndStrenghtenRound(bool log_info) {
       //
       // TODO(user): We could also move the watched literal first so we always
       // skip it.
-      signatures[clause_index] = signature;
-      one_watcher[min_literal].push_back(clause_index);
+      one_watcher[min_literal].push_back({signature, clause_index});
     }
   }
 
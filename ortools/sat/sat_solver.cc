@@ -557,7 +557,9 @@ bool ClauseSubsumption(const std::vector<Literal>& a, SatClause* b) {
 int SatSolver::EnqueueDecisionAndBackjumpOnConflict(Literal true_literal) {
   SCOPED_TIME_STAT(&stats_);
   if (model_is_unsat_) return kUnsatTrailIndex;
-  DCHECK(PropagationIsDone());
+
+  // A Backtrack() may have enqueued some literals again, see there.
+  if (!PropagationIsDone() && !FinishPropagation()) return kUnsatTrailIndex;
 
   // We should never enqueue before the assumptions_.
   if (DEBUG_MODE && !assumptions_.empty()) {
@@ -908,8 +910,37 @@ void SatSolver::ProcessCurrentConflict() {
   decision_policy_->BeforeConflict(trail_->Index());
 
   // Backtrack and add the reason to the set of learned clause.
+  //
+  // If the backjump is too long, we only backtrack to the level before the one
+  // of the first UIP, so that we do not need to redo all the propagation in
+  // between. The learned clause still propagates there.
   counters_.num_literals_learned += learned_conflict_.size();
-  Backtrack(ComputeBacktrackLevel(learned_conflict_));
+  const int backjump_level = ComputeBacktrackLevel(learned_conflict_);
+  const int threshold = parameters_->chronological_backtracking_threshold();
+  int backtrack_level = backjump_level;
+  if (threshold > 0 && backjump_level > assumption_level_ &&
+      learned_conflict_.size() > 2 && !parameters_->use_pb_resolution()) {
+    const int uip_level = DecisionLevel(learned_conflict_[0].Variable());
+    if (uip_level - backjump_level > threshold) {
+      backtrack_level = uip_level - 1;
+    }
+  }
+
+  // If the first UIP was itself propagated by a clause learned with a
+  // chronological backtrack, Backtrack() could enqueue it again, and the
+  // learned clause would then be false. We backtrack below the asserting level
+  // of that clause instead, even if the learned clause is then not asserting.
+  const BooleanVariable uip_var = learned_conflict_[0].Variable();
+  for (const ChronologicalBacktrack& entry : chronological_backtracks_) {
+    if (entry.clause->PropagatedLiteral().Variable() != uip_var) continue;
+    if (entry.asserting_level <= backtrack_level) {
+      backtrack_level = backjump_level;
+    }
+    if (entry.asserting_level <= backtrack_level) {
+      backtrack_level = entry.asserting_level - 1;
+    }
+  }
+  Backtrack(backtrack_level);
   DCHECK(ClauseIsValidUnderDebugAssignment(learned_conflict_));
 
   // Note that we need to output the learned clause before cleaning the clause
@@ -939,6 +970,13 @@ void SatSolver::ProcessCurrentConflict() {
   // Create and attach the new learned clause.
   const int conflict_lbd = AddLearnedClauseAndEnqueueUnitPropagation(
       learned_conflict_, is_redundant);
+  if (backtrack_level > backjump_level) {
+    SatClause* clause = ReasonClauseOrNull(uip_var);
+    DCHECK(clause != nullptr);
+    ++counters_.num_chronological_backtracks;
+    chronological_backtracks_.push_back(
+        {clause, backjump_level, backtrack_level});
+  }
   restart_->OnConflict(conflict_trail_index, conflict_decision_level,
                        conflict_lbd);
 }
@@ -993,9 +1031,13 @@ SatSolver::Status SatSolver::ReapplyDecisionsUpTo(
 SatSolver::Status SatSolver::EnqueueDecisionAndBacktrackOnConflict(
     Literal true_literal, int* first_propagation_index) {
   SCOPED_TIME_STAT(&stats_);
-  CHECK(PropagationIsDone());
   CHECK(assumptions_.empty());
   if (model_is_unsat_) return SatSolver::INFEASIBLE;
+
+  // A Backtrack() may have enqueued some literals again, see there.
+  if (!PropagationIsDone() && !FinishPropagation()) {
+    return SatSolver::INFEASIBLE;
+  }
   DCHECK_LT(CurrentDecisionLevel(), decisions_.size());
   decisions_[CurrentDecisionLevel()].literal = true_literal;
   if (first_propagation_index != nullptr) {
@@ -1046,6 +1088,27 @@ void SatSolver::Backtrack(int target_level) {
 
   Untrail(target_trail_index);
   last_decision_or_backtrack_trail_index_ = trail_->Index();
+  if (!chronological_backtracks_.empty()) RepairChronologicalBacktracks();
+}
+
+void SatSolver::RepairChronologicalBacktracks() {
+  const int level = CurrentDecisionLevel();
+  int new_size = 0;
+  for (ChronologicalBacktrack& entry : chronological_backtracks_) {
+    if (entry.level > level) {
+      // The propagated literal was untrailed. If the clause is still unit, we
+      // enqueue it again at the current level, which is now its level. We stop
+      // tracking it once this is its asserting level.
+      if (entry.asserting_level > level) continue;
+      if (!entry.clause->IsAttached()) continue;
+      clauses_propagator_->EnqueueWithClauseReason(entry.clause, trail_);
+      ++counters_.num_chronological_repairs;
+      entry.level = level;
+      if (entry.asserting_level == level) continue;
+    }
+    chronological_backtracks_[new_size++] = entry;
+  }
+  chronological_backtracks_.resize(new_size);
 }
 
 bool SatSolver::AddBinaryClauses(const std::vector<BinaryClause>& clauses) {
@@ -1636,6 +1699,10 @@ std::string SatSolver::StatusString(Status status) const {
              1.0 * counters_.num_learned_pb_literals / counters_.num_failures) +
          absl::StrFormat("  num subsumed clauses: %d\n",
                          counters_.num_subsumed_clauses) +
+         absl::StrFormat("  num chronological backtracks: %d\n",
+                         counters_.num_chronological_backtracks) +
+         absl::StrFormat("  num chronological repairs: %d\n",
+                         counters_.num_chronological_repairs) +
          absl::StrFormat("  minimization_num_clauses: %d\n",
                          counters_.minimization_num_clauses) +
          absl::StrFormat("  minimization_num_decisions: %d\n",
@@ -2663,6 +2730,12 @@ void SatSolver::CleanClauseDatabaseIfNeeded() {
     // TODO(user): If the need arise, we could avoid this linear scan on the
     // full list of clauses by not keeping the clauses from clauses_info there.
     if (!block_clause_deletion_) {
+      // The reason of a literal can be detached by the probing. We must not
+      // keep a pointer to it once it is deleted.
+      gtl::STLEraseAllFromSequenceIf(
+          &chronological_backtracks_, [](const ChronologicalBacktrack& entry) {
+            return !entry.clause->IsAttached();
+          });
       clauses_propagator_->DeleteRemovedClauses();
     }
   }
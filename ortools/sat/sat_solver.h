@@ -293,6 +293,10 @@ class SatSolver {
   // level and all its propagation will not be undone. But all the trail after
   // this will be cleared. Calling this with 0 will revert all the decisions and
   // only the fixed variables will be left on the trail.
+  //
+  // Note that with chronological backtracking, this may enqueue again at
+  // target_level some literals propagated by a learned clause, see
+  // chronological_backtracks_. The propagation is then not done.
   void Backtrack(int target_level);
 
   // Advanced usage. This is meant to restore the solver to a "proper" state
@@ -609,6 +613,10 @@ class SatSolver {
   // Update the propagators_ list with the relevant propagators.
   void InitializePropagators();
 
+  // Enqueues again the literals of chronological_backtracks_ that were just
+  // untrailed while their clause is still unit, and updates this vector.
+  void RepairChronologicalBacktracks();
+
   // Unrolls the trail until a given point. This unassign the assigned variables
   // and add them to the priority queue with the correct weight.
   void Untrail(int target_trail_index);
@@ -770,6 +778,20 @@ class SatSolver {
   // EnqueueNewDecision() call.
   int last_decision_or_backtrack_trail_index_ = 0;
 
+  // The learned clauses that propagated at a higher level than their backjump
+  // level because of chronological backtracking, and are still on the trail.
+  // If we backtrack to a level in [asserting_level, level), their propagated
+  // literal is unassigned while all the other literals are still false, which
+  // the watchers will never notice. Backtrack() thus enqueues it again with the
+  // same clause as a reason. Note that these clauses cannot be deleted since
+  // they are used as a reason.
+  struct ChronologicalBacktrack {
+    SatClause* clause;
+    int asserting_level;
+    int level;
+  };
+  std::vector<ChronologicalBacktrack> chronological_backtracks_;
+
   // The assumption level. See SolveWithAssumptions().
   int assumption_level_ = 0;
   std::vector<Literal> assumptions_;
@@ -788,6 +810,8 @@ class SatSolver {
     int64_t num_branches = 0;
     int64_t num_failures = 0;
     int64_t num_restarts = 0;
+    int64_t num_chronological_backtracks = 0;
+    int64_t num_chronological_repairs = 0;
 
     // Minimization stats.
     int64_t num_minimizations = 0;
@@ -0,0 +1,95 @@
+// Copyright 2010-2022 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmarks of the full search on random job-shop instances, where the trail
+// is long and mostly made of integer bounds. The first argument is the number
+// of jobs and machines, the second one the chronological backtracking
+// threshold, 0 meaning that it is disabled.
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "ortools/base/logging.h"
+#include "ortools/sat/cp_model.h"
+#include "ortools/sat/cp_model.pb.h"
+#include "ortools/sat/sat_parameters.pb.h"
+
+namespace operations_research {
+namespace sat {
+namespace {
+
+// A square job-shop with random task durations and random machine orders,
+// minimizing the makespan.
+CpModelProto RandomJobShop(int size) {
+  std::mt19937 random(12345);
+  std::uniform_int_distribution<int64_t> duration(1, 20);
+  std::vector<std::vector<int64_t>> durations(size);
+  int64_t horizon = 0;
+  for (int job = 0; job < size; ++job) {
+    for (int task = 0; task < size; ++task) {
+      durations[job].push_back(duration(random));
+      horizon += durations[job].back();
+    }
+  }
+
+  CpModelBuilder cp_model;
+  std::vector<std::vector<IntervalVar>> machine_to_intervals(size);
+  const IntVar makespan = cp_model.NewIntVar({0, horizon});
+  std::vector<int> machines(size);
+  for (int job = 0; job < size; ++job) {
+    std::iota(machines.begin(), machines.end(), 0);
+    std::shuffle(machines.begin(), machines.end(), random);
+    IntVar previous_end;
+    for (int task = 0; task < size; ++task) {
+      const IntVar start = cp_model.NewIntVar({0, horizon});
+      const IntVar end = cp_model.NewIntVar({0, horizon});
+      machine_to_intervals[machines[task]].push_back(
+          cp_model.NewIntervalVar(start, durations[job][task], end));
+      if (task > 0) cp_model.AddLessOrEqual(previous_end, start);
+      previous_end = end;
+    }
+    cp_model.AddLessOrEqual(previous_end, makespan);
+  }
+  for (const std::vector<IntervalVar>& intervals : machine_to_intervals) {
+    cp_model.AddNoOverlap(intervals);
+  }
+  cp_model.Minimize(makespan);
+  return cp_model.Build();
+}
+
+void BM_JobShopChronologicalBacktracking(benchmark::State& state) {
+  const CpModelProto model_proto = RandomJobShop(state.range(0));
+  SatParameters params;
+  params.set_num_workers(1);
+  params.set_max_deterministic_time(10.0);
+  params.set_chronological_backtracking_threshold(state.range(1));
+  int64_t num_conflicts = 0;
+  for (auto _ : state) {
+    const CpSolverResponse response = SolveWithParameters(model_proto, params);
+    CHECK_NE(response.status(), CpSolverStatus::MODEL_INVALID);
+    num_conflicts += response.num_conflicts();
+  }
+  state.counters["conflicts"] = benchmark::Counter(
+      num_conflicts, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_JobShopChronologicalBacktracking)
+    ->ArgsProduct({{6, 10, 15}, {0, 10, 100}})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace sat
+}  // namespace operations_research
@@ -26,7 +26,6 @@
 #include <vector>
 
 #include "absl/base/attributes.h"
-#include "absl/container/btree_set.h"
 #include "absl/container/flat_hash_map.h"
 #include "absl/log/check.h"
 #include "absl/strings/str_cat.h"
@@ -243,16 +242,30 @@ std::vector<int64_t> FindPossibleDemands(const EnergyEvent& event,
   return possible_demands;
 }
 
+// Fills relevant_events with the indices of the events that can contribute to
+// a time window starting at window_start, in their original order. The other
+// events can always end before the window, so AddOneEvent() ignores them.
+void FindEventsRelevantAfter(const std::vector<EnergyEvent>& events,
+                             IntegerValue window_start,
+                             std::vector<int>* relevant_events) {
+  relevant_events->clear();
+  for (int e = 0; e < events.size(); ++e) {
+    if (events[e].x_end_min > window_start) relevant_events->push_back(e);
+  }
+}
+
 // This generates the actual cut and compute its activity vs the
-// available_energy_lp.
+// available_energy_lp. Only the events in relevant_events, as computed by
+// FindEventsRelevantAfter(window_start), are considered.
 bool CutIsEfficient(
-    const std::vector<EnergyEvent>& events, IntegerValue window_start,
+    const std::vector<EnergyEvent>& events,
+    absl::Span<const int> relevant_events, IntegerValue window_start,
     IntegerValue window_end, double available_energy_lp,
     const absl::StrongVector<IntegerVariable, double>& lp_values,
     LinearConstraintBuilder* temp_builder) {
   temp_builder->Clear();
-  for (const EnergyEvent& event : events) {
-    if (!AddOneEvent(event, window_start, window_end, temp_builder)) {
+  for (const int e : relevant_events) {
+    if (!AddOneEvent(events[e], window_start, window_end, temp_builder)) {
       return false;
     }
   }
@@ -363,6 +376,7 @@ void GenerateCumulativeEnergeticCutsWithMakespanAndFixedCapacity(
   const double makespan_lp = makespan.LpValue(lp_values);
   const double makespan_min_lp = ToDouble(makespan_min);
   LinearConstraintBuilder temp_builder(model);
+  std::vector<int> relevant_events;
   for (int i = 0; i + 1 < num_time_points; ++i) {
     // Checks the time limit if the problem is too big.
     if (events.size() > 50 && time_limit->LimitReached()) return;
@@ -370,6 +384,7 @@ void GenerateCumulativeEnergeticCutsWithMakespanAndFixedCapacity(
     const IntegerValue window_start = time_points[i];
     // After max_end_min, all tasks can fit before window_start.
     if (window_start >= max_end_min) break;
+    FindEventsRelevantAfter(events, window_start, &relevant_events);
 
     IntegerValue cumulated_max_energy = 0;
     IntegerValue cumulated_max_energy_before_makespan_min = 0;
@@ -419,8 +434,8 @@ void GenerateCumulativeEnergeticCutsWithMakespanAndFixedCapacity(
       const double available_energy_lp = use_makespan
                                              ? max_energy_up_to_makespan_lp
                                              : ToDouble(cumulated_max_energy);
-      if (CutIsEfficient(events, window_start, window_end, available_energy_lp,
-                         lp_values, &temp_builder)) {
+      if (CutIsEfficient(events, relevant_events, window_start, window_end,
+                         available_energy_lp, lp_values, &temp_builder)) {
         OverloadedTimeWindowWithMakespan w;
         w.start = window_start;
         w.end = window_end;
@@ -507,20 +522,21 @@ void GenerateCumulativeEnergeticCuts(
 
   // Compute relevant time points.
   // TODO(user): We could reduce this set.
-  absl::btree_set<IntegerValue> time_points_set;
+  std::vector<IntegerValue> time_points;
+  time_points.reserve(4 * events.size());
   IntegerValue max_end_min = kMinIntegerValue;
   for (const EnergyEvent& event : events) {
-    time_points_set.insert(event.x_start_min);
-    time_points_set.insert(event.x_start_max);
-    time_points_set.insert(event.x_end_min);
-    time_points_set.insert(event.x_end_max);
+    time_points.push_back(event.x_start_min);
+    time_points.push_back(event.x_start_max);
+    time_points.push_back(event.x_end_min);
+    time_points.push_back(event.x_end_max);
     max_end_min = std::max(max_end_min, event.x_end_min);
   }
-  const std::vector<IntegerValue> time_points(time_points_set.begin(),
-                                              time_points_set.end());
+  gtl::STLSortAndRemoveDuplicates(&time_points);
   const int num_time_points = time_points.size();
 
   LinearConstraintBuilder temp_builder(model);
+  std::vector<int> relevant_events;
   for (int i = 0; i + 1 < num_time_points; ++i) {
     // Checks the time limit if the problem is too big.
     if (events.size() > 50 && time_limit->LimitReached()) return;
@@ -528,14 +544,15 @@ void GenerateCumulativeEnergeticCuts(
     const IntegerValue window_start = time_points[i];
     // After max_end_min, all tasks can fit before window_start.
     if (window_start >= max_end_min) break;
+    FindEventsRelevantAfter(events, window_start, &relevant_events);
 
     for (int j = i + 1; j < num_time_points; ++j) {
       const IntegerValue window_end = time_points[j];
       const double available_energy_lp =
           ToDouble(window_end - window_start) * capacity_lp;
       if (available_energy_lp >= max_possible_energy_lp) break;
-      if (CutIsEfficient(events, window_start, window_end, available_energy_lp,
-                         lp_values, &temp_builder)) {
+      if (CutIsEfficient(events, relevant_events, window_start, window_end,
+                         available_energy_lp, lp_values, &temp_builder)) {
         overloaded_time_windows.push_back({window_start, window_end});
       }
     }
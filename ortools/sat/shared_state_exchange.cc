@@ -0,0 +1,271 @@
+// Copyright 2010-2022 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ortools/sat/shared_state_exchange.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <thread>  // NOLINT
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "ortools/base/file.h"
+#include "ortools/base/logging.h"
+#include "ortools/sat/cp_model.pb.h"
+#include "ortools/sat/cp_model_checker.h"
+#include "ortools/sat/cp_model_service.pb.h"
+#include "ortools/sat/cp_model_utils.h"
+#include "ortools/sat/integer.h"
+#include "ortools/sat/synchronization.h"
+
+namespace operations_research {
+namespace sat {
+
+SharedStateExchange::SharedStateExchange(int node_id,
+                                         const CpModelProto& model_proto,
+                                         SharedResponseManager* response,
+                                         SharedBoundsManager* bounds,
+                                         SharedClausesManager* clauses)
+    : node_id_(node_id),
+      model_proto_(model_proto),
+      response_(response),
+      bounds_(bounds),
+      clauses_(clauses) {
+  const std::string name = absl::StrCat("node_", node_id);
+  if (bounds_ != nullptr) bounds_id_ = bounds_->RegisterNewId();
+  if (clauses_ != nullptr) {
+    clauses_id_ = clauses_->RegisterNewId();
+    clauses_->SetWorkerNameForId(clauses_id_, name);
+  }
+}
+
+void SharedStateExchange::ExportUpdate(v1::SharedStateUpdate* update) {
+  update->Clear();
+  update->set_node_id(node_id_);
+  update->set_sequence_number(sequence_number_++);
+
+  if (bounds_ != nullptr) {
+    bounds_->GetChangedBounds(bounds_id_, &variables_, &lower_bounds_,
+                              &upper_bounds_);
+    update->mutable_bound_variables()->Add(variables_.begin(),
+                                           variables_.end());
+    update->mutable_lower_bounds()->Add(lower_bounds_.begin(),
+                                        lower_bounds_.end());
+    update->mutable_upper_bounds()->Add(upper_bounds_.begin(),
+                                        upper_bounds_.end());
+  }
+
+  if (clauses_ != nullptr) {
+    clauses_->GetUnseenBinaryClauses(clauses_id_, &new_clauses_);
+    update->mutable_binary_clause_literals()->Reserve(2 * new_clauses_.size());
+    for (const auto& [lit1, lit2] : new_clauses_) {
+      update->add_binary_clause_literals(lit1);
+      update->add_binary_clause_literals(lit2);
+    }
+  }
+
+  if (response_ == nullptr) return;
+  const SharedSolutionRepository<int64_t>& solutions =
+      response_->SolutionsRepository();
+  if (solutions.NumSolutions() > 0) {
+    // The solutions are sorted, the first one is the best.
+    const SharedSolutionRepository<int64_t>::Solution best =
+        solutions.GetSolution(0);
+    if (!solution_exported_ || best.rank < last_exported_rank_) {
+      solution_exported_ = true;
+      last_exported_rank_ = best.rank;
+      update->mutable_solution()->Add(best.variable_values.begin(),
+                                      best.variable_values.end());
+    }
+  }
+  if (model_proto_.has_objective()) {
+    update->set_has_objective_lower_bound(true);
+    update->set_inner_objective_lower_bound(
+        response_->GetInnerObjectiveLowerBound().value());
+  }
+}
+
+bool SharedStateExchange::ImportUpdate(const v1::SharedStateUpdate& update) {
+  bool all_imported = true;
+  const std::string name = absl::StrCat("node_", update.node_id());
+  const int num_variables = model_proto_.variables_size();
+
+  if (bounds_ != nullptr && update.bound_variables_size() > 0) {
+    const int num_bounds = update.bound_variables_size();
+    bool valid = update.lower_bounds_size() == num_bounds &&
+                 update.upper_bounds_size() == num_bounds;
+    for (int i = 0; valid && i < num_bounds; ++i) {
+      const int var = update.bound_variables(i);
+      valid = var >= 0 && var < num_variables &&
+              update.lower_bounds(i) <= update.upper_bounds(i);
+    }
+    if (valid) {
+      variables_.assign(update.bound_variables().begin(),
+                        update.bound_variables().end());
+      lower_bounds_.assign(update.lower_bounds().begin(),
+                           update.lower_bounds().end());
+      upper_bounds_.assign(update.upper_bounds().begin(),
+                           update.upper_bounds().end());
+      bounds_->ReportPotentialNewBounds(name, variables_, lower_bounds_,
+                                        upper_bounds_);
+    } else {
+      VLOG(1) << "Ignoring malformed bounds from " << name;
+      all_imported = false;
+    }
+  }
+
+  if (clauses_ != nullptr && update.binary_clause_literals_size() > 0) {
+    const int num_literals = update.binary_clause_literals_size();
+    bool valid = num_literals % 2 == 0;
+    for (int i = 0; valid && i < num_literals; ++i) {
+      const int lit = update.binary_clause_literals(i);
+      // A negative literal -var - 1 refers to NOT(var).
+      valid = lit >= -num_variables && lit < num_variables;
+    }
+    if (valid) {
+      for (int i = 0; i < num_literals; i += 2) {
+        clauses_->AddBinaryClause(clauses_id_,
+                                  update.binary_clause_literals(i),
+                                  update.binary_clause_literals(i + 1));
+      }
+    } else {
+      VLOG(1) << "Ignoring malformed clauses from " << name;
+      all_imported = false;
+    }
+  }
+
+  if (response_ == nullptr) return all_imported;
+  if (update.solution_size() > 0) {
+    if (update.solution_size() == num_variables &&
+        SolutionIsFeasible(model_proto_, update.solution())) {
+      response_->NewSolution(update.solution(), name);
+    } else {
+      VLOG(1) << "Ignoring invalid solution from " << name;
+      all_imported = false;
+    }
+  }
+  if (update.has_objective_lower_bound() && model_proto_.has_objective()) {
+    response_->UpdateInnerObjectiveBounds(
+        name, IntegerValue(update.inner_objective_lower_bound()),
+        kMaxIntegerValue);
+  }
+  return all_imported;
+}
+
+SharedStateCheckpointer::SharedStateCheckpointer(
+    const CpModelProto& model_proto, const std::string& filename,
+    absl::Duration period, SharedResponseManager* response,
+    SharedBoundsManager* bounds, SharedClausesManager* clauses)
+    : filename_(filename),
+      period_(period),
+      exchange_(/*node_id=*/0, model_proto, response, bounds, clauses),
+      last_checkpoint_time_(absl::Now()) {
+  checkpoint_.set_model_fingerprint(FingerprintModel(model_proto));
+}
+
+SharedStateCheckpointer::~SharedStateCheckpointer() {
+  if (writer_.joinable()) writer_.join();
+}
+
+absl::Status SharedStateCheckpointer::Resume() {
+  v1::CpSolverCheckpoint loaded;
+  const absl::Status status =
+      file::GetBinaryProto(filename_, &loaded, file::Defaults());
+  if (!status.ok()) return status;
+  if (loaded.model_fingerprint() != checkpoint_.model_fingerprint()) {
+    return absl::FailedPreconditionError(
+        absl::StrCat("The checkpoint ", filename_,
+                     " was saved for a different model."));
+  }
+  if (!exchange_.ImportUpdate(loaded.state())) {
+    return absl::DataLossError(absl::StrCat(
+        "Some parts of the checkpoint ", filename_, " were not valid."));
+  }
+
+  // The loaded clauses are added to the shared manager under our own id, so
+  // ExportUpdate() will never return them. We thus need to merge the loaded
+  // state into checkpoint_ for it to be part of the next checkpoints.
+  MergeUpdate(loaded.state());
+  return absl::OkStatus();
+}
+
+void SharedStateCheckpointer::MergeUpdate(
+    const v1::SharedStateUpdate& update) {
+  v1::SharedStateUpdate* state = checkpoint_.mutable_state();
+  for (int i = 0; i < update.bound_variables_size(); ++i) {
+    const int var = update.bound_variables(i);
+    const auto [it, inserted] =
+        var_to_bound_index_.insert({var, state->bound_variables_size()});
+    if (inserted) {
+      state->add_bound_variables(var);
+      state->add_lower_bounds(update.lower_bounds(i));
+      state->add_upper_bounds(update.upper_bounds(i));
+    } else {
+      state->set_lower_bounds(it->second, update.lower_bounds(i));
+      state->set_upper_bounds(it->second, update.upper_bounds(i));
+    }
+  }
+  for (int i = 0; i + 1 < update.binary_clause_literals_size(); i += 2) {
+    const int lit1 = update.binary_clause_literals(i);
+    const int lit2 = update.binary_clause_literals(i + 1);
+    if (clauses_.insert({lit1, lit2}).second) {
+      state->add_binary_clause_literals(lit1);
+      state->add_binary_clause_literals(lit2);
+    }
+  }
+  if (update.solution_size() > 0) {
+    *state->mutable_solution() = update.solution();
+  }
+  if (update.has_objective_lower_bound()) {
+    // The bound of the response manager never decreases.
+    state->set_has_objective_lower_bound(true);
+    state->set_inner_objective_lower_bound(
+        update.inner_objective_lower_bound());
+  }
+}
+
+void SharedStateCheckpointer::MaybeCheckpoint() {
+  if (writing_) return;
+  const absl::Time now = absl::Now();
+  if (now - last_checkpoint_time_ < period_) return;
+  last_checkpoint_time_ = now;
+
+  exchange_.ExportUpdate(&update_);
+  MergeUpdate(update_);
+
+  // The previous write is done, since writing_ is false.
+  if (writer_.joinable()) writer_.join();
+  to_write_ = checkpoint_;
+  writing_ = true;
+  writer_ = std::thread([this]() {
+    // Write to a temporary file first so that a preemption during the write
+    // does not corrupt the last checkpoint.
+    const std::string tmp_filename = absl::StrCat(filename_, ".tmp");
+    const absl::Status status =
+        file::SetBinaryProto(tmp_filename, to_write_, file::Defaults());
+    if (!status.ok()) {
+      LOG(WARNING) << "Cannot write checkpoint: " << status;
+    } else if (std::rename(tmp_filename.c_str(), filename_.c_str()) != 0) {
+      LOG(WARNING) << "Cannot rename " << tmp_filename << " to " << filename_;
+    }
+    writing_ = false;
+  });
+}
+
+}  // namespace sat
+}  // namespace operations_research
@@ -0,0 +1,138 @@
+// Copyright 2010-2022 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OR_TOOLS_SAT_SHARED_STATE_EXCHANGE_H_
+#define OR_TOOLS_SAT_SHARED_STATE_EXCHANGE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <thread>  // NOLINT
+#include <utility>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/status/status.h"
+#include "absl/time/time.h"
+#include "ortools/sat/cp_model.pb.h"
+#include "ortools/sat/cp_model_service.pb.h"
+#include "ortools/sat/synchronization.h"
+
+namespace operations_research {
+namespace sat {
+
+// Converts the state of the shared managers of one solve to and from
+// v1::SharedStateUpdate, so that several processes solving the same presolved
+// model can share what they learn. This class does not do any communication:
+// the caller sends the exported updates to the other nodes, for instance with
+// the CpSolver.ExchangeSharedState rpc. The staleness of the shared state is
+// bounded by how often it calls ExportUpdate() and ImportUpdate().
+//
+// The managers can be nullptr, in which case the corresponding part of the
+// state is neither exported nor imported.
+//
+// ExportUpdate() and ImportUpdate() must not be called concurrently.
+class SharedStateExchange {
+ public:
+  SharedStateExchange(int node_id, const CpModelProto& model_proto,
+                      SharedResponseManager* response,
+                      SharedBoundsManager* bounds,
+                      SharedClausesManager* clauses);
+
+  // Fills update with everything that changed locally since the last call:
+  // new bounds, new binary clauses, the best solution if it improved, and the
+  // objective lower bound.
+  void ExportUpdate(v1::SharedStateUpdate* update);
+
+  // Merges the state of another node into the local managers. The update is
+  // checked first, and malformed parts are ignored. In particular, a solution
+  // is only imported if it is feasible for the local model. Returns false if
+  // something was ignored.
+  bool ImportUpdate(const v1::SharedStateUpdate& update);
+
+  int64_t num_updates_exported() const { return sequence_number_; }
+
+ private:
+  const int node_id_;
+  const CpModelProto& model_proto_;
+  SharedResponseManager* response_;
+  SharedBoundsManager* bounds_;
+  SharedClausesManager* clauses_;
+  int bounds_id_ = -1;
+  int clauses_id_ = -1;
+
+  int64_t sequence_number_ = 0;
+  bool solution_exported_ = false;
+  int64_t last_exported_rank_ = std::numeric_limits<int64_t>::max();
+
+  // Buffers reused between calls.
+  std::vector<int> variables_;
+  std::vector<int64_t> lower_bounds_;
+  std::vector<int64_t> upper_bounds_;
+  std::vector<std::pair<int, int>> new_clauses_;
+};
+
+// Periodically saves the shared state of a solve to a file, and loads it back
+// to resume an interrupted solve of the same presolved model. The state is the
+// one of SharedStateExchange, accumulated since the start of the solve.
+//
+// MaybeCheckpoint() is meant to be called from a synchronization point of the
+// search. Only the merge of the new state is done there, the file is written
+// by a background thread. If the previous write is not finished, the
+// checkpoint is delayed to the next call.
+class SharedStateCheckpointer {
+ public:
+  SharedStateCheckpointer(const CpModelProto& model_proto,
+                          const std::string& filename, absl::Duration period,
+                          SharedResponseManager* response,
+                          SharedBoundsManager* bounds,
+                          SharedClausesManager* clauses);
+
+  // Waits for the pending write, if any.
+  ~SharedStateCheckpointer();
+
+  // Loads the checkpoint file into the shared managers. Returns an error if
+  // the file cannot be read or was saved for another model, in which case
+  // nothing is loaded, or if some parts of it were invalid and skipped.
+  absl::Status Resume();
+
+  // Starts writing a new checkpoint if the period has elapsed since the last
+  // one.
+  void MaybeCheckpoint();
+
+ private:
+  void MergeUpdate(const v1::SharedStateUpdate& update);
+
+  const std::string filename_;
+  const absl::Duration period_;
+  SharedStateExchange exchange_;
+  absl::Time last_checkpoint_time_;
+
+  // The accumulated state, and what we need to merge new updates into it.
+  v1::CpSolverCheckpoint checkpoint_;
+  absl::flat_hash_map<int, int> var_to_bound_index_;
+  absl::flat_hash_set<std::pair<int, int>> clauses_;
+  v1::SharedStateUpdate update_;
+
+  // The copy of checkpoint_ being written by writer_.
+  v1::CpSolverCheckpoint to_write_;
+  std::atomic<bool> writing_ = false;
+  std::thread writer_;
+};
+
+}  // namespace sat
+}  // namespace operations_research
+
+#endif  // OR_TOOLS_SAT_SHARED_STATE_EXCHANGE_H_
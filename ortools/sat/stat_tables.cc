@@ -60,7 +60,8 @@ SharedStatTables::SharedStatTables() {
                                "Cuts/Call"});
 
   lns_table_.push_back(
-      {"LNS stats", "Improv/Calls", "Closed", "Difficulty", "TimeLimit"});
+      {"LNS stats", "Improv/Calls", "Closed", "Difficulty", "TimeLimit",
+       "DTime", "Gain/DTime"});
 
   ls_table_.push_back({"LS stats", "Batches", "Restarts", "LinMoves",
                        "GenMoves", "CompoundMoves", "WeightUpdates"});
@@ -215,7 +216,9 @@ void SharedStatTables::AddLnsStat(absl::string_view name,
                     generator.num_calls()),
        absl::StrFormat("%2.0f%%", 100 * fully_solved_proportion),
        absl::StrFormat("%0.2f", generator.difficulty()),
-       absl::StrFormat("%0.2f", generator.deterministic_limit())});
+       absl::StrFormat("%0.2f", generator.deterministic_limit()),
+       absl::StrFormat("%0.2f", generator.total_deterministic_time()),
+       absl::StrFormat("%0.2f", generator.average_gain_per_time_unit())});
 }
 
 void SharedStatTables::AddLsStat(absl::string_view name, int64_t num_batches,
@@ -13,6 +13,7 @@
 
 #include "ortools/sat/subsolver.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <functional>
 #include <memory>
@@ -130,7 +131,14 @@ void DeterministicLoop(std::vector<std::unique_ptr<SubSolver>>& subsolvers,
   std::vector<std::function<void()>> to_run;
   std::vector<int> indices;
   std::vector<double> timing;
+  std::vector<int> schedule_order;
   to_run.reserve(batch_size);
+
+  // Running average of the wall time of the tasks of each subsolver. This is
+  // only used to choose in which order the tasks of a batch are started, which
+  // does not change the result of the search.
+  std::vector<double> average_task_duration(subsolvers.size(), 0.0);
+  std::vector<int64_t> num_completed_tasks(subsolvers.size(), 0);
   ThreadPool pool("DeterministicLoop", num_threads);
   pool.StartWorkers();
   while (true) {
@@ -152,10 +160,26 @@ void DeterministicLoop(std::vector<std::unique_ptr<SubSolver>>& subsolvers,
     }
     if (to_run.empty()) break;
 
-    // Schedule each task.
+    // Schedule each task. Since we wait for the whole batch to be done, we
+    // start the longest tasks first so that they do not end up alone at the
+    // end of the batch while the other threads are idle. Tasks of subsolvers
+    // that never completed a task are started first.
+    schedule_order.resize(to_run.size());
+    for (int i = 0; i < to_run.size(); ++i) schedule_order[i] = i;
+    std::stable_sort(schedule_order.begin(), schedule_order.end(),
+                     [&](int a, int b) {
+                       const int sa = indices[a];
+                       const int sb = indices[b];
+                       if (num_completed_tasks[sa] == 0) {
+                         return num_completed_tasks[sb] > 0;
+                       }
+                       if (num_completed_tasks[sb] == 0) return false;
+                       return average_task_duration[sa] >
+                              average_task_duration[sb];
+                     });
     timing.resize(to_run.size());
     absl::BlockingCounter blocking_counter(static_cast<int>(to_run.size()));
-    for (int i = 0; i < to_run.size(); ++i) {
+    for (const int i : schedule_order) {
       pool.Schedule(
           [i, f = std::move(to_run[i]), &timing, &blocking_counter]() {
             WallTimer timer;
@@ -173,7 +197,11 @@ void DeterministicLoop(std::vector<std::unique_ptr<SubSolver>>& subsolvers,
     // Update times.
     num_in_flight_per_subsolvers.assign(subsolvers.size(), 0);
     for (int i = 0; i < to_run.size(); ++i) {
-      subsolvers[indices[i]]->AddTaskDuration(timing[i]);
+      const int index = indices[i];
+      subsolvers[index]->AddTaskDuration(timing[i]);
+      const int64_t n = ++num_completed_tasks[index];
+      average_task_duration[index] +=
+          (timing[i] - average_task_duration[index]) / n;
     }
   }
 }
@@ -191,10 +219,21 @@ void NonDeterministicLoop(std::vector<std::unique_ptr<SubSolver>>& subsolvers,
   int num_in_flight = 0;  // Guarded by `mutex`.
   std::vector<int> num_in_flight_per_subsolvers(subsolvers.size(), 0);
 
+  // Sum of the wall time of all the executed tasks. Guarded by `mutex`.
+  double total_task_time = 0.0;
+  WallTimer loop_timer;
+  loop_timer.Start();
+
+  // We allow a few more tasks than threads to be in flight. The extra ones
+  // wait in the pool queue, so that a thread finishing a task can start the
+  // next one right away instead of staying idle until the main thread wakes
+  // up, synchronizes and generates a new task.
+  const int max_num_in_flight = num_threads + std::max(1, num_threads / 16);
+
   // Predicate to be used with absl::Condition to detect that num_in_flight <
-  // num_threads. Must only be called while locking `mutex`.
-  const auto num_in_flight_lt_num_threads = [&num_in_flight, num_threads]() {
-    return num_in_flight < num_threads;
+  // max_num_in_flight. Must only be called while locking `mutex`.
+  const auto can_schedule_more_tasks = [&num_in_flight, max_num_in_flight]() {
+    return num_in_flight < max_num_in_flight;
   };
 
   ThreadPool pool("NonDeterministicLoop", num_threads);
@@ -209,10 +248,9 @@ void NonDeterministicLoop(std::vector<std::unique_ptr<SubSolver>>& subsolvers,
     // Set to true if no task is pending right now.
     bool all_done = false;
     {
-      // Wait if num_in_flight == num_threads.
+      // Wait if num_in_flight == max_num_in_flight.
       const bool condition = mutex.LockWhenWithTimeout(
-          absl::Condition(&num_in_flight_lt_num_threads),
-          absl::Milliseconds(100));
+          absl::Condition(&can_schedule_more_tasks), absl::Milliseconds(100));
 
       // To support some "advanced" cancelation of subsolve, we still call
       // synchronize every 0.1 seconds even if there is no worker available.
@@ -260,7 +298,8 @@ void NonDeterministicLoop(std::vector<std::unique_ptr<SubSolver>>& subsolvers,
     std::function<void()> task = subsolvers[best]->GenerateTask(task_id++);
     const std::string name = subsolvers[best]->name();
     pool.Schedule([task = std::move(task), name, best, &subsolvers, &mutex,
-                   &num_in_flight, &num_in_flight_per_subsolvers]() {
+                   &num_in_flight, &num_in_flight_per_subsolvers,
+                   &total_task_time]() {
       WallTimer timer;
       timer.Start();
       task();
@@ -271,9 +310,20 @@ void NonDeterministicLoop(std::vector<std::unique_ptr<SubSolver>>& subsolvers,
       num_in_flight_per_subsolvers[best]--;
       VLOG(1) << name << " done in " << timer.Get() << "s.";
       subsolvers[best]->AddTaskDuration(timer.Get());
+      total_task_time += timer.Get();
       num_in_flight--;
     });
   }
+
+  // Note that all tasks are done here, so we can read total_task_time.
+  const double available_time = num_threads * loop_timer.Get();
+  if (available_time > 0.0) {
+    const absl::MutexLock mutex_lock(&mutex);
+    VLOG(1) << "NonDeterministicLoop: threads were busy "
+            << 100.0 * total_task_time / available_time << "% of the time, "
+            << std::max(0.0, available_time - total_task_time)
+            << "s of idle thread time.";
+  }
 }
 
 #endif  // __PORTABLE_PLATFORM__
@@ -17,8 +17,14 @@
 
 #include <atomic>
 #include <functional>
+#include <memory>
+#include <optional>
 #include <string>
+#include <thread>  // NOLINT
+#include <utility>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
 #include "ortools/base/logging.h"
 #include "ortools/sat/cp_model.pb.h"
 #include "ortools/sat/cp_model_checker.h"
@@ -105,6 +111,95 @@ void SolutionCallback::SetAtomicBooleanToStopTheSearch(
 
 bool SolutionCallback::HasResponse() const { return has_response_; }
 
+// Runs a solution callback on its own thread. The search threads only store
+// the new response and return, and the dispatcher thread runs the callback on
+// the latest stored response each time it is free. The thread only runs
+// between Start() and Stop(), so that the same dispatcher can serve several
+// solves.
+class AsynchronousSolutionDispatcher {
+ public:
+  explicit AsynchronousSolutionDispatcher(const SolutionCallback* callback)
+      : callback_(callback) {}
+
+  ~AsynchronousSolutionDispatcher() { Stop(); }
+
+  const SolutionCallback* callback() const { return callback_; }
+
+  // Starts the dispatcher thread if it is not already running. This does
+  // nothing once Disable() was called.
+  void Start() {
+    absl::MutexLock lock(&mutex_);
+    if (running_ || disabled_) return;
+    running_ = true;
+    stopping_ = false;
+    thread_ = std::thread([this] { Loop(); });
+  }
+
+  // Replaces the pending response, if any. The response is ignored if the
+  // dispatcher thread is not running.
+  void Push(const CpSolverResponse& response) {
+    CpSolverResponse copy = response;
+    absl::MutexLock lock(&mutex_);
+    if (!running_ || stopping_) return;
+    if (pending_.has_value()) ++num_dropped_;
+    pending_ = std::move(copy);
+  }
+
+  // Delivers the pending response, if any, and joins the dispatcher thread.
+  void Stop() {
+    {
+      absl::MutexLock lock(&mutex_);
+      if (!running_ || stopping_) return;
+      stopping_ = true;
+    }
+    thread_.join();
+    absl::MutexLock lock(&mutex_);
+    running_ = false;
+    if (num_dropped_ > 0) {
+      VLOG(1) << num_dropped_ << " solutions were not passed to the callback.";
+      num_dropped_ = 0;
+    }
+  }
+
+  // Stops the dispatcher for good, the callback will never be called again.
+  void Disable() {
+    Stop();
+    absl::MutexLock lock(&mutex_);
+    disabled_ = true;
+  }
+
+ private:
+  bool HasWork() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
+    return stopping_ || pending_.has_value();
+  }
+
+  void Loop() {
+    while (true) {
+      CpSolverResponse response;
+      {
+        absl::MutexLock lock(&mutex_);
+        mutex_.Await(
+            absl::Condition(this, &AsynchronousSolutionDispatcher::HasWork));
+        if (!pending_.has_value()) return;
+        response = std::move(*pending_);
+        pending_.reset();
+      }
+      callback_->Run(response);
+    }
+  }
+
+  const SolutionCallback* callback_;
+  absl::Mutex mutex_;
+  std::optional<CpSolverResponse> pending_ ABSL_GUARDED_BY(mutex_);
+  bool running_ ABSL_GUARDED_BY(mutex_) = false;
+  bool stopping_ ABSL_GUARDED_BY(mutex_) = false;
+  bool disabled_ ABSL_GUARDED_BY(mutex_) = false;
+  int64_t num_dropped_ ABSL_GUARDED_BY(mutex_) = 0;
+  std::thread thread_;
+};
+
+SolveWrapper::~SolveWrapper() = default;
+
 void SolveWrapper::SetParameters(
     const operations_research::sat::SatParameters& parameters) {
   model_.Add(NewSatParameters(parameters));
@@ -121,9 +216,25 @@ void SolveWrapper::AddSolutionCallback(const SolutionCallback& callback) {
       [&callback](const CpSolverResponse& r) { return callback.Run(r); }));
 }
 
+void SolveWrapper::AddAsynchronousSolutionCallback(
+    const SolutionCallback& callback) {
+  callback.SetAtomicBooleanToStopTheSearch(&stopped_);
+  dispatchers_.push_back(
+      std::make_unique<AsynchronousSolutionDispatcher>(&callback));
+  AsynchronousSolutionDispatcher* dispatcher = dispatchers_.back().get();
+  model_.Add(NewFeasibleSolutionObserver(
+      [dispatcher](const CpSolverResponse& r) { dispatcher->Push(r); }));
+}
+
 void SolveWrapper::ClearSolutionCallback(const SolutionCallback& callback) {
   // cleanup the atomic bool.
   callback.SetAtomicBooleanToStopTheSearch(nullptr);
+
+  // The observers registered in the model cannot be removed, so we keep the
+  // dispatcher alive but make sure it never calls this callback again.
+  for (const auto& dispatcher : dispatchers_) {
+    if (dispatcher->callback() == &callback) dispatcher->Disable();
+  }
 }
 
 void SolveWrapper::AddLogCallback(
@@ -144,7 +255,11 @@ operations_research::sat::CpSolverResponse SolveWrapper::Solve(
     const operations_research::sat::CpModelProto& model_proto) {
   FixFlagsAndEnvironmentForSwig();
   model_.GetOrCreate<TimeLimit>()->RegisterExternalBooleanAsLimit(&stopped_);
-  return operations_research::sat::SolveCpModel(model_proto, &model_);
+  for (const auto& dispatcher : dispatchers_) dispatcher->Start();
+  CpSolverResponse response =
+      operations_research::sat::SolveCpModel(model_proto, &model_);
+  for (const auto& dispatcher : dispatchers_) dispatcher->Stop();
+  return response;
 }
 
 void SolveWrapper::StopSearch() { stopped_ = true; }
@@ -17,7 +17,9 @@
 #include <atomic>
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "ortools/sat/cp_model.pb.h"
 #include "ortools/sat/cp_model_checker.h"
@@ -82,6 +84,8 @@ class SolutionCallback {
   mutable std::atomic<bool>* stopped_ptr_;
 };
 
+class AsynchronousSolutionDispatcher;
+
 // Simple director class for C#.
 class LogCallback {
  public:
@@ -106,6 +110,15 @@ class SolveWrapper {
   void SetStringParameters(const std::string& string_parameters);
 
   void AddSolutionCallback(const SolutionCallback& callback);
+
+  // Same as AddSolutionCallback(), but the callback is run on a dedicated
+  // thread and never blocks the search workers. If the callback is slower
+  // than the solver, the intermediate solutions are dropped and only the
+  // latest one is passed to it. The last solution found is always delivered
+  // before Solve() returns. This holds for each Solve() until
+  // ClearSolutionCallback() is called with this callback.
+  void AddAsynchronousSolutionCallback(const SolutionCallback& callback);
+
   void ClearSolutionCallback(const SolutionCallback& callback);
   void AddLogCallback(std::function<void(const std::string&)> log_callback);
 
@@ -117,9 +130,12 @@ class SolveWrapper {
 
   void StopSearch();
 
+  ~SolveWrapper();
+
  private:
   Model model_;
   std::atomic<bool> stopped_ = false;
+  std::vector<std::unique_ptr<AsynchronousSolutionDispatcher>> dispatchers_;
 };
 
 // Static methods are stored in a module which name can vary.
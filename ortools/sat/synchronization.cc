@@ -737,6 +737,20 @@ void SharedResponseManager::RegisterObjectiveBoundImprovement(
   dual_improvements_count_[ExtractSubSolverName(improvement_info)]++;
 }
 
+int SharedResponseManager::NumImprovements(const std::string& subsolver_name) {
+  absl::MutexLock mutex_lock(&mutex_);
+  int num_improvements = 0;
+  const auto primal_it = primal_improvements_count_.find(subsolver_name);
+  if (primal_it != primal_improvements_count_.end()) {
+    num_improvements += primal_it->second;
+  }
+  const auto dual_it = dual_improvements_count_.find(subsolver_name);
+  if (dual_it != dual_improvements_count_.end()) {
+    num_improvements += dual_it->second;
+  }
+  return num_improvements;
+}
+
 void SharedResponseManager::DisplayImprovementStatistics() {
   absl::MutexLock mutex_lock(&mutex_);
   if (!primal_improvements_count_.empty()) {
@@ -761,16 +775,33 @@ void SharedResponseManager::DisplayImprovementStatistics() {
   }
 }
 
+namespace {
+
+// We want shards big enough to not take too many locks per report, but small
+// enough so that workers do not all contend on the same shard.
+constexpr int kMaxNumBoundsShards = 64;
+constexpr int kMinBoundsShardSize = 1024;
+
+}  // namespace
+
 SharedBoundsManager::SharedBoundsManager(const CpModelProto& model_proto)
     : num_variables_(model_proto.variables_size()),
       model_proto_(model_proto),
+      shard_size_(std::max(kMinBoundsShardSize,
+                           (num_variables_ + kMaxNumBoundsShards - 1) /
+                               kMaxNumBoundsShards)),
       lower_bounds_(num_variables_, std::numeric_limits<int64_t>::min()),
       upper_bounds_(num_variables_, std::numeric_limits<int64_t>::max()),
       synchronized_lower_bounds_(num_variables_,
                                  std::numeric_limits<int64_t>::min()),
       synchronized_upper_bounds_(num_variables_,
                                  std::numeric_limits<int64_t>::max()) {
-  changed_variables_since_last_synchronize_.ClearAndResize(num_variables_);
+  for (int start = 0; start < num_variables_; start += shard_size_) {
+    shards_.push_back(std::make_unique<Shard>());
+    absl::MutexLock shard_lock(&shards_.back()->mutex);
+    shards_.back()->changed_variables_since_last_synchronize.ClearAndResize(
+        std::min(shard_size_, num_variables_ - start));
+  }
   for (int i = 0; i < num_variables_; ++i) {
     lower_bounds_[i] = model_proto.variables(i).domain(0);
     const int domain_size = model_proto.variables(i).domain_size();
@@ -788,10 +819,18 @@ void SharedBoundsManager::ReportPotentialNewBounds(
   CHECK_EQ(variables.size(), new_upper_bounds.size());
   int num_improvements = 0;
 
-  absl::MutexLock mutex_lock(&mutex_);
+  // We only hold the lock of the shard of the current variable. Since the
+  // variables are usually reported in increasing order, this rarely changes.
+  Shard* locked_shard = nullptr;
   for (int i = 0; i < variables.size(); ++i) {
     const int var = variables[i];
     if (var >= num_variables_) continue;
+    Shard* shard = shards_[ShardOf(var)].get();
+    if (shard != locked_shard) {
+      if (locked_shard != nullptr) locked_shard->mutex.Unlock();
+      shard->mutex.Lock();
+      locked_shard = shard;
+    }
     const int64_t old_lb = lower_bounds_[var];
     const int64_t old_ub = upper_bounds_[var];
     const int64_t new_lb = new_lower_bounds[i];
@@ -815,10 +854,13 @@ void SharedBoundsManager::ReportPotentialNewBounds(
       }
       upper_bounds_[var] = new_ub;
     }
-    changed_variables_since_last_synchronize_.Set(var);
+    shard->changed_variables_since_last_synchronize.Set(var % shard_size_);
     num_improvements++;
   }
+  if (locked_shard != nullptr) locked_shard->mutex.Unlock();
+
   if (num_improvements > 0) {
+    absl::MutexLock stats_lock(&stats_mutex_);
     bounds_exported_[worker_name] += num_improvements;
   }
 }
@@ -829,7 +871,11 @@ void SharedBoundsManager::ReportPotentialNewBounds(
 void SharedBoundsManager::FixVariablesFromPartialSolution(
     const std::vector<int64_t>& solution,
     const std::vector<int>& variables_to_fix) {
-  absl::MutexLock mutex_lock(&mutex_);
+  // This is rare, so we simply lock all the shards, always in the same order.
+  for (const auto& shard : shards_) shard->mutex.Lock();
+  const auto unlock_all = [this]() {
+    for (const auto& shard : shards_) shard->mutex.Unlock();
+  };
 
   // Abort if incompatible. Note that we only check the position that we are
   // about to fix. This should be enough. Otherwise we might never accept any
@@ -841,6 +887,7 @@ void SharedBoundsManager::FixVariablesFromPartialSolution(
       VLOG(1) << "Incompatibility in FixVariablesFromPartialSolution() "
               << "var: " << var << " value: " << value << " bounds: ["
               << lower_bounds_[var] << "," << upper_bounds_[var] << "]";
+      unlock_all();
       return;
     }
   }
@@ -855,7 +902,8 @@ void SharedBoundsManager::FixVariablesFromPartialSolution(
 
     lower_bounds_[var] = solution[var];
     upper_bounds_[var] = solution[var];
-    changed_variables_since_last_synchronize_.Set(var);
+    shards_[ShardOf(var)]->changed_variables_since_last_synchronize.Set(
+        var % shard_size_);
 
     // This is problematic as we might find a different partial solution.
     // To allow for further investigation, we currently fix it to the debug
@@ -870,19 +918,38 @@ void SharedBoundsManager::FixVariablesFromPartialSolution(
       }
     }
   }
+  unlock_all();
 }
 
 void SharedBoundsManager::Synchronize() {
   absl::MutexLock mutex_lock(&mutex_);
-  for (const int var :
-       changed_variables_since_last_synchronize_.PositionsSetAtLeastOnce()) {
-    synchronized_lower_bounds_[var] = lower_bounds_[var];
-    synchronized_upper_bounds_[var] = upper_bounds_[var];
-    for (int j = 0; j < id_to_changed_variables_.size(); ++j) {
-      id_to_changed_variables_[j].Set(var);
+  for (int s = 0; s < shards_.size(); ++s) {
+    Shard& shard = *shards_[s];
+    const int start = s * shard_size_;
+    absl::MutexLock shard_lock(&shard.mutex);
+    for (const int i :
+         shard.changed_variables_since_last_synchronize
+             .PositionsSetAtLeastOnce()) {
+      const int var = start + i;
+      synchronized_lower_bounds_[var] = lower_bounds_[var];
+      synchronized_upper_bounds_[var] = upper_bounds_[var];
+      changed_variables_log_.push_back(var);
     }
+    shard.changed_variables_since_last_synchronize.ClearAll();
+  }
+
+  // Compact the log. The ids that are not up to date get the part they did
+  // not see yet directly in their set.
+  if (changed_variables_log_.size() > num_variables_) {
+    for (int id = 0; id < id_to_changed_variables_.size(); ++id) {
+      for (int i = id_to_log_index_[id]; i < changed_variables_log_.size();
+           ++i) {
+        id_to_changed_variables_[id].Set(changed_variables_log_[i]);
+      }
+      id_to_log_index_[id] = 0;
+    }
+    changed_variables_log_.clear();
   }
-  changed_variables_since_last_synchronize_.ClearAll();
 }
 
 int SharedBoundsManager::RegisterNewId() {
@@ -890,6 +957,7 @@ int SharedBoundsManager::RegisterNewId() {
   const int id = id_to_changed_variables_.size();
   id_to_changed_variables_.resize(id + 1);
   id_to_changed_variables_[id].ClearAndResize(num_variables_);
+  id_to_log_index_.push_back(changed_variables_log_.size());
   for (int var = 0; var < num_variables_; ++var) {
     const int64_t lb = model_proto_.variables(var).domain(0);
     const int domain_size = model_proto_.variables(var).domain_size();
@@ -909,17 +977,23 @@ void SharedBoundsManager::GetChangedBounds(
   new_lower_bounds->clear();
   new_upper_bounds->clear();
 
-  absl::MutexLock mutex_lock(&mutex_);
-  for (const int var : id_to_changed_variables_[id].PositionsSetAtLeastOnce()) {
+  absl::ReaderMutexLock mutex_lock(&mutex_);
+  SparseBitset<int>& changed_variables = id_to_changed_variables_[id];
+  for (int i = id_to_log_index_[id]; i < changed_variables_log_.size(); ++i) {
+    changed_variables.Set(changed_variables_log_[i]);
+  }
+  id_to_log_index_[id] = changed_variables_log_.size();
+
+  for (const int var : changed_variables.PositionsSetAtLeastOnce()) {
     variables->push_back(var);
     new_lower_bounds->push_back(synchronized_lower_bounds_[var]);
     new_upper_bounds->push_back(synchronized_upper_bounds_[var]);
   }
-  id_to_changed_variables_[id].ClearAll();
+  changed_variables.ClearAll();
 }
 
 void SharedBoundsManager::UpdateDomains(std::vector<Domain>* domains) {
-  absl::MutexLock mutex_lock(&mutex_);
+  absl::ReaderMutexLock mutex_lock(&mutex_);
   CHECK_EQ(domains->size(), synchronized_lower_bounds_.size());
   for (int var = 0; var < domains->size(); ++var) {
     (*domains)[var] = (*domains)[var].IntersectionWith(Domain(
@@ -928,7 +1002,7 @@ void SharedBoundsManager::UpdateDomains(std::vector<Domain>* domains) {
 }
 
 void SharedBoundsManager::LogStatistics(SolverLogger* logger) {
-  absl::MutexLock mutex_lock(&mutex_);
+  absl::MutexLock stats_lock(&stats_mutex_);
   if (!bounds_exported_.empty()) {
     std::vector<std::vector<std::string>> table;
     table.push_back({"Improving bounds shared", "Num"});
@@ -940,7 +1014,7 @@ void SharedBoundsManager::LogStatistics(SolverLogger* logger) {
 }
 
 int SharedBoundsManager::NumBoundsExported(const std::string& worker_name) {
-  absl::MutexLock mutex_lock(&mutex_);
+  absl::MutexLock stats_lock(&stats_mutex_);
   const auto it = bounds_exported_.find(worker_name);
   if (it == bounds_exported_.end()) return 0;
   return it->second;
@@ -953,6 +1027,7 @@ int SharedClausesManager::RegisterNewId() {
   absl::MutexLock mutex_lock(&mutex_);
   const int id = id_to_last_processed_binary_clause_.size();
   id_to_last_processed_binary_clause_.resize(id + 1, 0);
+  id_to_exported_clauses_.resize(id + 1);
   id_to_clauses_exported_.resize(id + 1, 0);
   return id;
 }
@@ -964,32 +1039,42 @@ void SharedClausesManager::SetWorkerNameForId(int id,
 }
 
 void SharedClausesManager::AddBinaryClause(int id, int lit1, int lit2) {
-  absl::MutexLock mutex_lock(&mutex_);
+  absl::ReaderMutexLock mutex_lock(&mutex_);
   if (lit2 < lit1) std::swap(lit1, lit2);
+  id_to_exported_clauses_[id].push_back({lit1, lit2});
+}
 
-  const auto p = std::make_pair(lit1, lit2);
-  const auto [unused_it, inserted] = added_binary_clauses_set_.insert(p);
-  if (inserted) {
-    added_binary_clauses_.push_back(p);
-    if (always_synchronize_) ++last_visible_clause_;
-    id_to_clauses_exported_[id]++;
-    // Small optim. If the worker is already up to date with clauses to import,
-    // we can mark this new clause as already seen.
-    if (id_to_last_processed_binary_clause_[id] ==
-        added_binary_clauses_.size() - 1) {
-      id_to_last_processed_binary_clause_[id]++;
+void SharedClausesManager::MergeExportedClauses() {
+  for (int id = 0; id < id_to_exported_clauses_.size(); ++id) {
+    for (const auto& p : id_to_exported_clauses_[id]) {
+      const auto [unused_it, inserted] = added_binary_clauses_set_.insert(p);
+      if (!inserted) continue;
+      added_binary_clauses_.push_back(p);
+      id_to_clauses_exported_[id]++;
+      // Small optim. If the worker is already up to date with clauses to
+      // import, we can mark this new clause as already seen.
+      if (id_to_last_processed_binary_clause_[id] ==
+          added_binary_clauses_.size() - 1) {
+        id_to_last_processed_binary_clause_[id]++;
+      }
     }
+    id_to_exported_clauses_[id].clear();
   }
+  if (always_synchronize_) last_visible_clause_ = added_binary_clauses_.size();
 }
 
 void SharedClausesManager::GetUnseenBinaryClauses(
     int id, std::vector<std::pair<int, int>>* new_clauses) {
   new_clauses->clear();
-  absl::MutexLock mutex_lock(&mutex_);
+  if (always_synchronize_) {
+    absl::MutexLock mutex_lock(&mutex_);
+    MergeExportedClauses();
+  }
+  absl::ReaderMutexLock mutex_lock(&mutex_);
   const int last_binary_clause_seen = id_to_last_processed_binary_clause_[id];
 
   // Protects against the optim that increase the last_binary_clause_seen in
-  // AddBinaryClause(). Checks is nothing needs to be done.
+  // MergeExportedClauses(). Checks is nothing needs to be done.
   if (last_binary_clause_seen >= last_visible_clause_) return;
 
   new_clauses->assign(added_binary_clauses_.begin() + last_binary_clause_seen,
@@ -1016,10 +1101,75 @@ void SharedClausesManager::LogStatistics(SolverLogger* logger) {
 
 void SharedClausesManager::Synchronize() {
   absl::MutexLock mutex_lock(&mutex_);
+  MergeExportedClauses();
   last_visible_clause_ = added_binary_clauses_.size();
   // TODO(user): We could cleanup added_binary_clauses_ periodically.
 }
 
+int SharedMemoryAccountant::RegisterNewId(absl::string_view worker_name,
+                                          bool can_be_stopped) {
+  absl::MutexLock mutex_lock(&mutex_);
+  const int id = workers_.size();
+  workers_.push_back({std::string(worker_name), can_be_stopped});
+  stop_booleans_.emplace_back(false);
+  return id;
+}
+
+std::atomic<bool>* SharedMemoryAccountant::StopBoolean(int id) {
+  absl::MutexLock mutex_lock(&mutex_);
+  return &stop_booleans_[id];
+}
+
+void SharedMemoryAccountant::ReportMemoryUsage(int id, int64_t num_bytes) {
+  absl::MutexLock mutex_lock(&mutex_);
+  WorkerMemory& worker = workers_[id];
+  worker.current_num_bytes = num_bytes;
+  worker.peak_num_bytes = std::max(worker.peak_num_bytes, num_bytes);
+}
+
+void SharedMemoryAccountant::ReportDone(int id) {
+  absl::MutexLock mutex_lock(&mutex_);
+  workers_[id].done = true;
+  workers_[id].current_num_bytes = 0;
+}
+
+std::string SharedMemoryAccountant::StopWorstWorker(
+    const std::function<int(const std::string&)>& num_improvements) {
+  absl::MutexLock mutex_lock(&mutex_);
+  int num_candidates = 0;
+  int worst = -1;
+  double worst_score = 0.0;
+  for (int id = 0; id < workers_.size(); ++id) {
+    const WorkerMemory& worker = workers_[id];
+    if (!worker.can_be_stopped || worker.done || worker.stopped) continue;
+    ++num_candidates;
+    const double score = static_cast<double>(worker.current_num_bytes) /
+                         (1.0 + num_improvements(worker.name));
+    if (worst == -1 || score > worst_score) {
+      worst = id;
+      worst_score = score;
+    }
+  }
+  if (num_candidates <= 1) return "";
+  workers_[worst].stopped = true;
+  stop_booleans_[worst] = true;
+  return workers_[worst].name;
+}
+
+void SharedMemoryAccountant::LogStatistics(SolverLogger* logger) {
+  absl::MutexLock mutex_lock(&mutex_);
+  if (workers_.empty()) return;
+  const double kMegaByte = 1024.0 * 1024.0;
+  std::vector<std::vector<std::string>> table;
+  table.push_back({"Memory (MB)", "Peak", "Stopped"});
+  for (const WorkerMemory& worker : workers_) {
+    table.push_back({FormatName(worker.name),
+                     absl::StrFormat("%.1f", worker.peak_num_bytes / kMegaByte),
+                     worker.stopped ? "yes" : "no"});
+  }
+  SOLVER_LOG(logger, FormatTable(table));
+}
+
 void SharedStatistics::AddStats(
     absl::Span<const std::pair<std::string, int64_t>> stats) {
   absl::MutexLock mutex_lock(&mutex_);
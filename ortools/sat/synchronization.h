@@ -19,6 +19,7 @@
 #include <deque>
 #include <functional>
 #include <limits>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -347,6 +348,10 @@ class SharedResponseManager {
   // Display improvement stats.
   void DisplayImprovementStatistics();
 
+  // Returns the number of primal and dual improvements found by the given
+  // subsolver so far.
+  int NumImprovements(const std::string& subsolver_name);
+
   // Wrapper around our SolverLogger, but protected by mutex.
   void LogMessage(const std::string& prefix, const std::string& message);
   void LogMessageWithThrottling(const std::string& prefix,
@@ -511,23 +516,49 @@ class SharedBoundsManager {
   }
 
  private:
+  // The current bounds are sharded by variable range so that workers reporting
+  // bounds on different parts of the model do not contend on the same mutex.
+  // The entries of lower_bounds_ and upper_bounds_ for the variables of a shard
+  // are guarded by the mutex of this shard.
+  struct Shard {
+    absl::Mutex mutex;
+
+    // Indexed by variable minus the first variable of the shard.
+    SparseBitset<int> changed_variables_since_last_synchronize
+        ABSL_GUARDED_BY(mutex);
+  };
+  int ShardOf(int var) const { return var / shard_size_; }
+
   const int num_variables_;
   const CpModelProto& model_proto_;
 
-  absl::Mutex mutex_;
-
   // These are always up to date.
-  std::vector<int64_t> lower_bounds_ ABSL_GUARDED_BY(mutex_);
-  std::vector<int64_t> upper_bounds_ ABSL_GUARDED_BY(mutex_);
-  SparseBitset<int> changed_variables_since_last_synchronize_
-      ABSL_GUARDED_BY(mutex_);
+  const int shard_size_;
+  std::vector<std::unique_ptr<Shard>> shards_;
+  std::vector<int64_t> lower_bounds_;
+  std::vector<int64_t> upper_bounds_;
+
+  // Lock ordering: mutex_ must be taken before any shard mutex. Note that
+  // GetChangedBounds() only takes a reader lock, and then each id only touches
+  // its own entry of the vectors indexed by id.
+  absl::Mutex mutex_;
 
   // These are only updated on Synchronize().
   std::vector<int64_t> synchronized_lower_bounds_ ABSL_GUARDED_BY(mutex_);
   std::vector<int64_t> synchronized_upper_bounds_ ABSL_GUARDED_BY(mutex_);
-  std::deque<SparseBitset<int>> id_to_changed_variables_
-      ABSL_GUARDED_BY(mutex_);
-  absl::btree_map<std::string, int> bounds_exported_ ABSL_GUARDED_BY(mutex_);
+
+  // All the variables changed by the successive Synchronize() calls. Each id
+  // reads the part it has not seen yet and merges it with its own set of
+  // changed variables. This way Synchronize() does not need to update the set
+  // of each id. The log is compacted once it gets larger than the number of
+  // variables.
+  std::vector<int> changed_variables_log_ ABSL_GUARDED_BY(mutex_);
+  std::vector<int> id_to_log_index_;
+  std::deque<SparseBitset<int>> id_to_changed_variables_;
+
+  absl::Mutex stats_mutex_;
+  absl::btree_map<std::string, int> bounds_exported_
+      ABSL_GUARDED_BY(stats_mutex_);
 
   std::vector<int64_t> debug_solution_;
 };
@@ -535,7 +566,11 @@ class SharedBoundsManager {
 // This class holds all the binary clauses that were found and shared by the
 // workers.
 //
-// It is thread-safe.
+// It is thread-safe. Since the workers export a lot of clauses, they only take
+// a reader lock to do so and append the clauses to their own buffer. These
+// buffers are merged into the shared store, with duplicates removed, on
+// Synchronize() or, if always_synchronize is true, before a worker imports new
+// clauses.
 //
 // Note that this uses literal as encoded in a cp_model.proto. Thus, the
 // literals can be negative numbers.
@@ -562,14 +597,21 @@ class SharedClausesManager {
   void Synchronize();
 
  private:
+  // Moves the clauses exported by all workers since the last call to the
+  // shared store.
+  void MergeExportedClauses() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  // Only the vectors indexed by worker id are accessed under a reader lock,
+  // and then a worker only touches its own entry.
   absl::Mutex mutex_;
   // Cache to avoid adding the same clause twice.
   absl::flat_hash_set<std::pair<int, int>> added_binary_clauses_set_
       ABSL_GUARDED_BY(mutex_);
   std::vector<std::pair<int, int>> added_binary_clauses_
       ABSL_GUARDED_BY(mutex_);
-  std::vector<int> id_to_last_processed_binary_clause_ ABSL_GUARDED_BY(mutex_);
-  std::vector<int64_t> id_to_clauses_exported_;
+  std::vector<int> id_to_last_processed_binary_clause_;
+  std::vector<std::vector<std::pair<int, int>>> id_to_exported_clauses_;
+  std::vector<int64_t> id_to_clauses_exported_ ABSL_GUARDED_BY(mutex_);
   int last_visible_clause_ ABSL_GUARDED_BY(mutex_) = 0;
   const bool always_synchronize_ = true;
 
@@ -577,6 +619,68 @@ class SharedClausesManager {
   absl::flat_hash_map<int, std::string> id_to_worker_name_;
 };
 
+// Keeps track of an estimate of the memory used by each worker of a parallel
+// search, so that the search can react before the process runs out of memory.
+//
+// The estimates are reported by the workers from their own thread. They only
+// count the data structures that grow during the search, like the clause
+// databases and the LP constraint pools, so they are a lower bound of the
+// real usage.
+//
+// Each worker also gets a Boolean that it should use as a limit, so that it
+// can be stopped under memory pressure, and a pressure counter that tells it
+// when to shrink its pools.
+class SharedMemoryAccountant {
+ public:
+  SharedMemoryAccountant() = default;
+
+  // Registers a new worker. If can_be_stopped is false, the worker will never
+  // be selected by StopWorstWorker().
+  int RegisterNewId(absl::string_view worker_name, bool can_be_stopped);
+
+  // The Boolean set by StopWorstWorker() for this worker. The pointer stays
+  // valid for the lifetime of this class.
+  std::atomic<bool>* StopBoolean(int id);
+
+  // Sets the current estimate of the worker memory usage.
+  void ReportMemoryUsage(int id, int64_t num_bytes);
+
+  // Indicates that the worker is done and its memory was freed.
+  void ReportDone(int id);
+
+  // Increments the counter returned by NumMemoryPressureSignals(). The workers
+  // are expected to shrink their pools when this counter changes.
+  void SignalMemoryPressure() { num_pressure_signals_++; }
+  int64_t NumMemoryPressureSignals() const { return num_pressure_signals_; }
+
+  // Stops the worker that can be stopped with the largest memory usage per
+  // improvement, as given by num_improvements(worker_name). This never stops
+  // the last running worker that can be stopped. Returns the name of the
+  // stopped worker, or an empty string if none was stopped.
+  std::string StopWorstWorker(
+      const std::function<int(const std::string&)>& num_improvements);
+
+  void LogStatistics(SolverLogger* logger);
+
+ private:
+  struct WorkerMemory {
+    std::string name;
+    bool can_be_stopped;
+    bool done = false;
+    bool stopped = false;
+    int64_t current_num_bytes = 0;
+    int64_t peak_num_bytes = 0;
+  };
+
+  absl::Mutex mutex_;
+  std::vector<WorkerMemory> workers_ ABSL_GUARDED_BY(mutex_);
+
+  // A deque so that the pointers given by StopBoolean() stay valid.
+  std::deque<std::atomic<bool>> stop_booleans_ ABSL_GUARDED_BY(mutex_);
+
+  std::atomic<int64_t> num_pressure_signals_ = 0;
+};
+
 // Simple class to add statistics by name and print them at the end.
 class SharedStatistics {
  public:
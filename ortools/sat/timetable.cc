@@ -15,6 +15,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <functional>
 #include <vector>
 
 #include "absl/log/check.h"
@@ -416,14 +417,35 @@ bool TimeTablingPerTask::BuildProfile() {
   const IntegerValue default_non_relevant_height =
       has_demand_equal_to_capacity_ ? 1 : 0;
 
-  const auto& by_decreasing_start_max = helper_->TaskByDecreasingStartMax();
-  const auto& by_end_min = helper_->TaskByIncreasingEndMin();
+  // Only the tasks in the profile contribute to it, the others have a zero
+  // cached demand. When they are few, it is cheaper to sort just their events
+  // than to maintain the helper orders over all the tasks. Both ways give
+  // exactly the same profile.
+  absl::Span<const TaskTime> by_decreasing_start_max;
+  absl::Span<const TaskTime> by_end_min;
+  if (num_profile_tasks_ * kSparseProfileFactor < num_tasks_) {
+    profile_start_max_.clear();
+    profile_end_min_.clear();
+    for (int i = 0; i < num_profile_tasks_; ++i) {
+      const int t = profile_tasks_[i];
+      profile_start_max_.push_back({t, helper_->StartMax(t)});
+      profile_end_min_.push_back({t, helper_->EndMin(t)});
+    }
+    std::sort(profile_start_max_.begin(), profile_start_max_.end(),
+              std::greater<TaskTime>());
+    std::sort(profile_end_min_.begin(), profile_end_min_.end());
+    by_decreasing_start_max = profile_start_max_;
+    by_end_min = profile_end_min_;
+  } else {
+    by_decreasing_start_max = helper_->TaskByDecreasingStartMax();
+    by_end_min = helper_->TaskByIncreasingEndMin();
+  }
 
   // Next start/end of the compulsory parts to be processed. Note that only the
   // task for which IsInProfile() is true must be considered.
-  int next_start = num_tasks_ - 1;
+  const int num_tasks = by_end_min.size();
+  int next_start = num_tasks - 1;
   int next_end = 0;
-  const int num_tasks = num_tasks_;
   while (next_end < num_tasks) {
     IntegerValue time = by_end_min[next_end].time;
     if (next_start >= 0) {
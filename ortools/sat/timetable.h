@@ -205,6 +205,13 @@ class TimeTablingPerTask : public PropagatorInterface {
   // Others will have zero here.
   std::vector<IntegerValue> cached_demands_min_;
 
+  // When fewer than num_tasks_ / kSparseProfileFactor tasks are in the
+  // profile, BuildProfile() sorts their compulsory part events in these
+  // vectors instead of using the helper orders over all the tasks.
+  static constexpr int kSparseProfileFactor = 16;
+  std::vector<TaskTime> profile_start_max_;
+  std::vector<TaskTime> profile_end_min_;
+
   // Statically computed.
   // This allow to simplify the profile for common usage.
   bool has_demand_equal_to_capacity_ = false;
@@ -35,6 +35,7 @@
 #include "ortools/base/logging.h"
 #include "ortools/base/stl_util.h"
 #include "ortools/base/strong_vector.h"
+#include "ortools/base/threadpool.h"
 #include "ortools/sat/cp_model.pb.h"
 #include "ortools/sat/cp_model_utils.h"
 #include "ortools/sat/integer.h"
@@ -224,61 +225,119 @@ bool VarDomination::EndFirstPhase() {
   // TODO(user): Tune the initial size, 50 might be a bit large, since our
   // complexity is borned by this number times the number of entries in the
   // constraints. Still we should in most situation be a lot lower than that.
-  const int kMaxInitialSize = 50;
-  std::vector<IntegerVariable> cropped_vars;
-  absl::StrongVector<IntegerVariable, bool> is_cropped(num_vars_with_negation_,
-                                                       false);
+  constexpr int kMaxInitialSize = 50;
+
+  // The minimal number of variables (and their negation) per thread.
+  constexpr int kMinVariablesPerThread = 100'000;
 
   // Fill the initial domination candidates.
-  int non_cropped_size = 0;
+  //
+  // Each variable is independent, so this is done by blocks of variables,
+  // possibly in parallel. Each block has its own buffer, and they are merged in
+  // order afterwards, so the result does not depend on the number of threads.
   std::vector<IntegerVariable> partition_data;
   const std::vector<absl::Span<const IntegerVariable>> elements_by_part =
       partition_->GetParts(&partition_data);
-  for (IntegerVariable var(0); var < num_vars_with_negation_; ++var) {
-    if (can_freely_decrease_[var]) continue;
-
-    const int part = partition_->PartOf(var.value());
-    const int start = buffer_.size();
-    const uint64_t var_sig = block_down_signatures_[var];
-    const uint64_t not_var_sig = block_down_signatures_[NegationOf(var)];
-    absl::Span<const IntegerVariable> to_scan =
-        has_initial_candidates_[var] ? InitialDominatingCandidates(var)
-                                     : elements_by_part[part];
-
-    // Two modes, either we scan the full list, or a small subset of it.
-    // Not that low variable indices should appear first, so it is better not
-    // to randomize.
-    int new_size = 0;
-    if (to_scan.size() <= 1'000) {
-      for (const IntegerVariable x : to_scan) {
-        if (var_sig & ~block_down_signatures_[x]) continue;  // !included.
-        if (block_down_signatures_[NegationOf(x)] & ~not_var_sig) continue;
-        if (PositiveVariable(x) == PositiveVariable(var)) continue;
-        if (can_freely_decrease_[NegationOf(x)]) continue;
-        ++new_size;
-        buffer_.push_back(x);
-        if (new_size >= kMaxInitialSize) {
-          is_cropped[var] = true;
-          cropped_vars.push_back(var);
+  struct Block {
+    IntegerVariable begin;
+    IntegerVariable end;
+    std::vector<IntegerVariable> buffer;
+    std::vector<IntegerVariable> cropped_vars;
+    int non_cropped_size = 0;
+  };
+  const auto process_block = [this, &elements_by_part](Block* block) {
+    for (IntegerVariable var = block->begin; var < block->end; ++var) {
+      if (can_freely_decrease_[var]) continue;
+
+      const int part = partition_->PartOf(var.value());
+      const int start = block->buffer.size();
+      const uint64_t var_sig = block_down_signatures_[var];
+      const uint64_t not_var_sig = block_down_signatures_[NegationOf(var)];
+      absl::Span<const IntegerVariable> to_scan =
+          has_initial_candidates_[var] ? InitialDominatingCandidates(var)
+                                       : elements_by_part[part];
+
+      // Two modes, either we scan the full list, or a small subset of it.
+      // Not that low variable indices should appear first, so it is better not
+      // to randomize.
+      int new_size = 0;
+      bool is_cropped = false;
+      if (to_scan.size() <= 1'000) {
+        for (const IntegerVariable x : to_scan) {
+          if (var_sig & ~block_down_signatures_[x]) continue;  // !included.
+          if (block_down_signatures_[NegationOf(x)] & ~not_var_sig) continue;
+          if (PositiveVariable(x) == PositiveVariable(var)) continue;
+          if (can_freely_decrease_[NegationOf(x)]) continue;
+          ++new_size;
+          block->buffer.push_back(x);
+          if (new_size >= kMaxInitialSize) {
+            is_cropped = true;
+            block->cropped_vars.push_back(var);
+          }
+        }
+      } else {
+        is_cropped = true;
+        block->cropped_vars.push_back(var);
+        for (int i = 0; i < 200; ++i) {
+          const IntegerVariable x = to_scan[i];
+          if (var_sig & ~block_down_signatures_[x]) continue;  // !included.
+          if (block_down_signatures_[NegationOf(x)] & ~not_var_sig) continue;
+          if (PositiveVariable(x) == PositiveVariable(var)) continue;
+          if (can_freely_decrease_[NegationOf(x)]) continue;
+          ++new_size;
+          block->buffer.push_back(x);
+          if (new_size >= kMaxInitialSize) break;
         }
       }
-    } else {
+
+      if (!is_cropped) block->non_cropped_size += new_size;
+
+      // The start is relative to the block buffer and fixed below.
+      dominating_vars_[var] = {start, new_size};
+    }
+  };
+
+  // We only use threads on large problems, where this is worth the overhead.
+  // There are more blocks than threads to balance the work.
+  const int num_threads =
+      num_vars_with_negation_ >= kMinVariablesPerThread * num_threads_
+          ? num_threads_
+          : 1;
+  const int num_blocks = num_threads == 1 ? 1 : 4 * num_threads;
+  std::vector<Block> blocks(num_blocks);
+  for (int b = 0; b < num_blocks; ++b) {
+    blocks[b].begin = IntegerVariable(
+        static_cast<int64_t>(num_vars_with_negation_) * b / num_blocks);
+    blocks[b].end = IntegerVariable(
+        static_cast<int64_t>(num_vars_with_negation_) * (b + 1) / num_blocks);
+  }
+  if (num_threads == 1) {
+    process_block(&blocks[0]);
+  } else {
+    // The destructor waits for all the blocks to be processed.
+    ThreadPool pool("VarDomination", num_threads);
+    pool.StartWorkers();
+    for (Block& block : blocks) {
+      pool.Schedule([&process_block, &block]() { process_block(&block); });
+    }
+  }
+
+  int non_cropped_size = 0;
+  std::vector<IntegerVariable> cropped_vars;
+  absl::StrongVector<IntegerVariable, bool> is_cropped(num_vars_with_negation_,
+                                                       false);
+  for (Block& block : blocks) {
+    const int offset = buffer_.size();
+    buffer_.insert(buffer_.end(), block.buffer.begin(), block.buffer.end());
+    for (IntegerVariable var = block.begin; var < block.end; ++var) {
+      if (!can_freely_decrease_[var]) dominating_vars_[var].start += offset;
+    }
+    for (const IntegerVariable var : block.cropped_vars) {
       is_cropped[var] = true;
       cropped_vars.push_back(var);
-      for (int i = 0; i < 200; ++i) {
-        const IntegerVariable x = to_scan[i];
-        if (var_sig & ~block_down_signatures_[x]) continue;  // !included.
-        if (block_down_signatures_[NegationOf(x)] & ~not_var_sig) continue;
-        if (PositiveVariable(x) == PositiveVariable(var)) continue;
-        if (can_freely_decrease_[NegationOf(x)]) continue;
-        ++new_size;
-        buffer_.push_back(x);
-        if (new_size >= kMaxInitialSize) break;
-      }
     }
-
-    if (!is_cropped[var]) non_cropped_size += new_size;
-    dominating_vars_[var] = {start, new_size};
+    non_cropped_size += block.non_cropped_size;
+    gtl::STLClearObject(&block.buffer);
   }
 
   // Heuristic: To try not to remove domination relations corresponding to short
@@ -1111,6 +1170,7 @@ void ScanModelForDominanceDetection(PresolveContext& context,
   const CpModelProto& cp_model = *context.working_model;
   const int num_vars = cp_model.variables().size();
   var_domination->Reset(num_vars);
+  var_domination->SetNumThreads(context.params().presolve_num_threads());
 
   for (int var = 0; var < num_vars; ++var) {
     // Ignore variables that have been substituted already or are unused.
@@ -69,6 +69,10 @@ class VarDomination {
   // At the beginning, we assume that there is no constraint.
   void Reset(int num_variables);
 
+  // Sets the number of threads used by EndFirstPhase() to compute the initial
+  // candidate lists on large problems. The result does not depend on it.
+  void SetNumThreads(int num_threads) { num_threads_ = num_threads; }
+
   // These functions are used to encode all of our constraints.
   // The algorithm work in two passes, so one should do:
   // - 1/ Convert all problem constraints to one or more calls
@@ -167,6 +171,7 @@ class VarDomination {
   // EndSecondPhase(). This is used for debug checks and to control what happen
   // on the constraint processing functions.
   int phase_ = 0;
+  int num_threads_ = 1;
 
   // The variables will be sorted by non-decreasking rank. The rank is also the
   // start of the first variable in tmp_ranks_ with this rank.
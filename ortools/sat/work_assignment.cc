@@ -257,14 +257,8 @@ bool SharedTreeManager::SyncTree(ProtoTrail& path) {
 
 void SharedTreeManager::ProposeSplit(ProtoTrail& path, ProtoLiteral decision) {
   absl::MutexLock mutex_lock(&mu_);
-  if (!IsValid(path)) return;
-  std::vector<std::pair<Node*, int>> nodes = GetAssignedNodes(path);
-  if (nodes.back().first->children[0] != nullptr) {
-    LOG_IF(WARNING, nodes.size() > 1)
-        << "Cannot resplit previously split node @ " << nodes.back().second
-        << "/" << nodes.size();
-    return;
-  }
+  // Do the cheap global checks first so that rejected proposals do not pay
+  // for walking the path while holding the lock.
   if (nodes_.size() >= max_nodes_) {
     VLOG(1) << "Too many nodes to accept split";
     return;
@@ -273,6 +267,14 @@ void SharedTreeManager::ProposeSplit(ProtoTrail& path, ProtoLiteral decision) {
     VLOG(1) << "Enough splits for now";
     return;
   }
+  if (!IsValid(path)) return;
+  std::vector<std::pair<Node*, int>> nodes = GetAssignedNodes(path);
+  if (nodes.back().first->children[0] != nullptr) {
+    LOG_IF(WARNING, nodes.size() > 1)
+        << "Cannot resplit previously split node @ " << nodes.back().second
+        << "/" << nodes.size();
+    return;
+  }
   if (params_.shared_tree_split_strategy() ==
           SatParameters::SPLIT_STRATEGY_DISCREPANCY ||
       params_.shared_tree_split_strategy() ==
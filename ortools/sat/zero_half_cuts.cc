@@ -14,10 +14,15 @@
 #include "ortools/sat/zero_half_cuts.h"
 
 #include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
 #include <utility>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/log/check.h"
+#include "absl/types/span.h"
 #include "ortools/base/logging.h"
 #include "ortools/lp_data/lp_types.h"
 #include "ortools/sat/integer.h"
@@ -34,6 +39,7 @@ void ZeroHalfCutHelper::Reset(int size) {
   col_to_rows_.clear();
   col_to_rows_.resize(size);
   tmp_marked_.resize(size);
+  work_done_ = 0;
 }
 
 void ZeroHalfCutHelper::ProcessVariables(
@@ -103,8 +109,8 @@ void ZeroHalfCutHelper::AddOneConstraint(
   // best? and we could use the basis status rather than recomputing the
   // activity for that.
   //
-  // TODO(user): Avoid adding duplicates and just randomly pick one. Note
-  // that we should also remove duplicate in a generic way.
+  // Note that the duplicate rows are removed later, in
+  // RemoveDominatedRowsAndColumns().
   const double tighteness_threshold = 1e-2;
   if (ToDouble(ub) - activity < tighteness_threshold) {
     binary_row.multipliers = {{row, IntegerValue(1)}};
@@ -145,6 +151,86 @@ void ZeroHalfCutHelper::SymmetricDifference(const std::vector<int>& a,
   b->resize(new_size);
 }
 
+void ZeroHalfCutHelper::CombineMultipliers(
+    const std::vector<std::pair<glop::RowIndex, IntegerValue>>& a,
+    std::vector<std::pair<glop::RowIndex, IntegerValue>>* b) {
+  // Both are sorted without duplicates, and identical entries cancel.
+  tmp_multipliers_.clear();
+  std::set_symmetric_difference(a.begin(), a.end(), b->begin(), b->end(),
+                                std::back_inserter(tmp_multipliers_));
+  std::swap(*b, tmp_multipliers_);
+}
+
+void ZeroHalfCutHelper::RemoveDominatedRowsAndColumns() {
+  const int num_cols = col_to_rows_.size();
+  const int num_rows = rows_.size();
+
+  // Merge the columns with the same rows. Note that the lists of rows are
+  // sorted since they are filled by increasing row index. The singleton
+  // columns are removed later, so we do not bother with them here.
+  bool some_columns_merged = false;
+  std::vector<bool> col_is_merged(num_cols, false);
+  {
+    absl::flat_hash_map<absl::Span<const int>, int> rows_to_col;
+    for (int col = 0; col < num_cols; ++col) {
+      if (col_to_rows_[col].size() < 2) continue;
+      const auto [it, inserted] =
+          rows_to_col.insert({absl::MakeConstSpan(col_to_rows_[col]), col});
+      if (inserted) continue;
+      some_columns_merged = true;
+      col_is_merged[col] = true;
+      shifted_lp_values_[it->second] += shifted_lp_values_[col];
+      col_to_rows_[col].clear();
+    }
+  }
+  if (some_columns_merged) {
+    for (CombinationOfRows& row : rows_) {
+      int new_size = 0;
+      for (const int col : row.cols) {
+        if (col_is_merged[col]) continue;
+        row.cols[new_size++] = col;
+      }
+      row.cols.resize(new_size);
+    }
+  }
+
+  // Remove the duplicate rows. We only change the removed rows once all the
+  // rows have been hashed, since the keys point to their columns.
+  bool some_rows_removed = false;
+  std::vector<bool> row_is_removed(num_rows, false);
+  {
+    absl::flat_hash_map<std::pair<absl::Span<const int>, int>, int>
+        cols_to_row;
+    for (int row = 0; row < num_rows; ++row) {
+      std::sort(rows_[row].cols.begin(), rows_[row].cols.end());
+      const auto [it, inserted] = cols_to_row.insert(
+          {{absl::MakeConstSpan(rows_[row].cols), rows_[row].rhs_parity}, row});
+      if (inserted) continue;
+      some_rows_removed = true;
+      if (rows_[row].slack < rows_[it->second].slack) {
+        row_is_removed[it->second] = true;
+        it->second = row;
+      } else {
+        row_is_removed[row] = true;
+      }
+    }
+  }
+  if (!some_rows_removed) return;
+  for (int row = 0; row < num_rows; ++row) {
+    if (!row_is_removed[row]) continue;
+    rows_[row].cols.clear();
+    rows_[row].slack = std::numeric_limits<double>::infinity();
+  }
+  for (std::vector<int>& rows : col_to_rows_) {
+    int new_size = 0;
+    for (const int row : rows) {
+      if (row_is_removed[row]) continue;
+      rows[new_size++] = row;
+    }
+    rows.resize(new_size);
+  }
+}
+
 // This is basically one step of a Gaussian elimination with the given pivot.
 void ZeroHalfCutHelper::EliminateVarUsingRow(int eliminated_col,
                                              int eliminated_row) {
@@ -160,6 +246,8 @@ void ZeroHalfCutHelper::EliminateVarUsingRow(int eliminated_col,
     if (other_row == eliminated_row) continue;
     col_to_rows_[eliminated_col][new_size++] = other_row;
 
+    work_done_ +=
+        rows_[eliminated_row].cols.size() + rows_[other_row].cols.size();
     SymmetricDifference(rows_[eliminated_row].cols, &rows_[other_row].cols);
 
     // Update slack & parity.
@@ -167,23 +255,10 @@ void ZeroHalfCutHelper::EliminateVarUsingRow(int eliminated_col,
     rows_[other_row].slack += rows_[eliminated_row].slack;
 
     // Update the multipliers the same way.
-    {
-      auto& mutable_multipliers = rows_[other_row].multipliers;
-      mutable_multipliers.insert(mutable_multipliers.end(),
-                                 rows_[eliminated_row].multipliers.begin(),
-                                 rows_[eliminated_row].multipliers.end());
-      std::sort(mutable_multipliers.begin(), mutable_multipliers.end());
-      int new_size = 0;
-      for (const auto& entry : mutable_multipliers) {
-        if (new_size > 0 && entry == mutable_multipliers[new_size - 1]) {
-          // Cancel both.
-          --new_size;
-        } else {
-          mutable_multipliers[new_size++] = entry;
-        }
-      }
-      mutable_multipliers.resize(new_size);
-    }
+    work_done_ += rows_[eliminated_row].multipliers.size() +
+                  rows_[other_row].multipliers.size();
+    CombineMultipliers(rows_[eliminated_row].multipliers,
+                       &rows_[other_row].multipliers);
   }
   col_to_rows_[eliminated_col].resize(new_size);
 
@@ -192,6 +267,8 @@ void ZeroHalfCutHelper::EliminateVarUsingRow(int eliminated_col,
     int new_size = 0;
     for (const int other_col : rows_[eliminated_row].cols) {
       if (other_col == eliminated_col) continue;
+      work_done_ += col_to_rows_[eliminated_col].size() +
+                    col_to_rows_[other_col].size();
       SymmetricDifference(col_to_rows_[eliminated_col],
                           &col_to_rows_[other_col]);
       if (col_to_rows_[other_col].size() == 1) {
@@ -216,6 +293,8 @@ std::vector<std::vector<std::pair<glop::RowIndex, IntegerValue>>>
 ZeroHalfCutHelper::InterestingCandidates(ModelRandomGenerator* random) {
   std::vector<std::vector<std::pair<glop::RowIndex, IntegerValue>>> result;
 
+  RemoveDominatedRowsAndColumns();
+
   // Remove singleton column from the picture.
   const int num_cols = col_to_rows_.size();
   for (int singleton_col = 0; singleton_col < num_cols; ++singleton_col) {
@@ -243,6 +322,7 @@ ZeroHalfCutHelper::InterestingCandidates(ModelRandomGenerator* random) {
   });
 
   for (const int row : to_process) {
+    if (work_done_ > kMaxWork) break;
     if (rows_[row].cols.empty()) continue;
     if (rows_[row].slack > 1e-6) continue;
     if (rows_[row].multipliers.size() > kMaxAggregationSize) continue;
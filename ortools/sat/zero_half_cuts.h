@@ -14,6 +14,7 @@
 #ifndef OR_TOOLS_SAT_ZERO_HALF_CUTS_H_
 #define OR_TOOLS_SAT_ZERO_HALF_CUTS_H_
 
+#include <cstdint>
 #include <functional>
 #include <utility>
 #include <vector>
@@ -95,6 +96,21 @@ class ZeroHalfCutHelper {
   void SymmetricDifference(const std::vector<int>& a, std::vector<int>* b);
 
  private:
+  // Simplifies the matrix before the elimination:
+  // - Columns that appear in exactly the same rows are merged, since they
+  //   always have the same parity. The merged column has the sum of their
+  //   shifted lp values.
+  // - Rows with the same columns and rhs parity are combinations of the same
+  //   variables, we only keep the one with the lowest slack.
+  //
+  // The removed rows get an infinite slack so that they are never used.
+  void RemoveDominatedRowsAndColumns();
+
+  // Like SymmetricDifference() but for the sorted multipliers.
+  void CombineMultipliers(
+      const std::vector<std::pair<glop::RowIndex, IntegerValue>>& a,
+      std::vector<std::pair<glop::RowIndex, IntegerValue>>* b);
+
   // As we combine rows, when the activity of a combination get too far away
   // from its bound, we just discard it. Note that the row will still be there
   // but its index will not appear in the col-wise representation of the matrix.
@@ -107,6 +123,12 @@ class ZeroHalfCutHelper {
   const int kMaxInputConstraintSize = 100;
   const double kMaxInputConstraintMagnitude = 1e6;
 
+  // Bound on the work of the elimination, in number of matrix entries
+  // touched, so that the time spent per call stays reasonable on large
+  // problems. We still return the candidates found so far when it is reached.
+  const int64_t kMaxWork = 10'000'000;
+  int64_t work_done_ = 0;
+
   // Variable information.
   std::vector<double> lp_values_;
   std::vector<double> shifted_lp_values_;
@@ -122,6 +144,7 @@ class ZeroHalfCutHelper {
 
   // Temporary vector used by SymmetricDifference().
   std::vector<bool> tmp_marked_;
+  std::vector<std::pair<glop::RowIndex, IntegerValue>> tmp_multipliers_;
 };
 
 }  // namespace sat
@@ -43,6 +43,7 @@ void JsspParser::SetJobs(int job_count) {
   CHECK_GT(job_count, 0);
   declared_job_count_ = job_count;
   problem_.clear_jobs();
+  problem_.mutable_jobs()->Reserve(job_count);
   for (int i = 0; i < job_count; ++i) {
     problem_.add_jobs()->set_name(absl::StrCat("J", i));
   }
@@ -52,6 +53,7 @@ void JsspParser::SetMachines(int machine_count) {
   CHECK_GT(machine_count, 0);
   declared_machine_count_ = machine_count;
   problem_.clear_machines();
+  problem_.mutable_machines()->Reserve(machine_count);
   for (int i = 0; i < machine_count; ++i) {
     problem_.add_machines()->set_name(absl::StrCat("M", i));
   }
@@ -119,12 +121,12 @@ bool JsspParser::ParseFile(const std::string& filename) {
 }
 
 void JsspParser::ProcessJsspLine(const std::string& line) {
-  const std::vector<std::string> words =
+  const std::vector<absl::string_view> words =
       absl::StrSplit(line, ' ', absl::SkipEmpty());
   switch (parser_state_) {
     case START: {
       if (words.size() == 2 && words[0] == "instance") {
-        problem_.set_name(words[1]);
+        problem_.set_name(std::string(words[1]));
         parser_state_ = NAME_READ;
         current_job_index_ = 0;
       } else if (words.size() == 1 && words[0] == "1") {
@@ -149,6 +151,7 @@ void JsspParser::ProcessJsspLine(const std::string& line) {
     case JOB_COUNT_READ: {
       CHECK_GE(words.size(), declared_machine_count_ * 2);
       Job* const job = problem_.mutable_jobs(current_job_index_);
+      job->mutable_tasks()->Reserve(declared_machine_count_);
       for (int i = 0; i < declared_machine_count_; ++i) {
         const int machine_id = strtoint32(words[2 * i]);
         const int64_t duration = strtoint64(words[2 * i + 1]);
@@ -181,7 +184,7 @@ void JsspParser::ProcessJsspLine(const std::string& line) {
 }
 
 void JsspParser::ProcessTaillardLine(const std::string& line) {
-  const std::vector<std::string> words =
+  const std::vector<absl::string_view> words =
       absl::StrSplit(line, ' ', absl::SkipEmpty());
 
   switch (parser_state_) {
@@ -231,6 +234,7 @@ void JsspParser::ProcessTaillardLine(const std::string& line) {
     case JOB_LENGTH_READ: {
       CHECK_EQ(declared_machine_count_, words.size());
       Job* const job = problem_.mutable_jobs(current_job_index_);
+      job->mutable_tasks()->Reserve(declared_machine_count_);
       for (int i = 0; i < declared_machine_count_; ++i) {
         const int64_t duration = strtoint64(words[i]);
         Task* const task = job->add_tasks();
@@ -247,7 +251,7 @@ void JsspParser::ProcessTaillardLine(const std::string& line) {
   }
 }
 void JsspParser::ProcessFlexibleLine(const std::string& line) {
-  const std::vector<std::string> words =
+  const std::vector<absl::string_view> words =
       absl::StrSplit(line, ' ', absl::SkipEmpty());
   switch (parser_state_) {
     case START: {
@@ -262,9 +266,12 @@ void JsspParser::ProcessFlexibleLine(const std::string& line) {
       const int operations_count = strtoint32(words[0]);
       int index = 1;
       Job* const job = problem_.mutable_jobs(current_job_index_);
+      job->mutable_tasks()->Reserve(operations_count);
       for (int operation = 0; operation < operations_count; ++operation) {
         const int alternatives_count = strtoint32(words[index++]);
         Task* const task = job->add_tasks();
+        task->mutable_machine()->Reserve(alternatives_count);
+        task->mutable_duration()->Reserve(alternatives_count);
         for (int alt = 0; alt < alternatives_count; alt++) {
           // Machine id are 1 based.
           const int machine_id = strtoint32(words[index++]) - 1;
@@ -286,7 +293,7 @@ void JsspParser::ProcessFlexibleLine(const std::string& line) {
   }
 }
 void JsspParser::ProcessSdstLine(const std::string& line) {
-  const std::vector<std::string> words =
+  const std::vector<absl::string_view> words =
       absl::StrSplit(line, ' ', absl::SkipEmpty());
   switch (parser_state_) {
     case START: {
@@ -302,6 +309,7 @@ void JsspParser::ProcessSdstLine(const std::string& line) {
     case JOB_COUNT_READ: {
       CHECK_EQ(words.size(), declared_machine_count_ * 2);
       Job* const job = problem_.mutable_jobs(current_job_index_);
+      job->mutable_tasks()->Reserve(declared_machine_count_);
       for (int i = 0; i < declared_machine_count_; ++i) {
         const int machine_id = strtoint32(words[2 * i]);
         const int64_t duration = strtoint64(words[2 * i + 1]);
@@ -332,7 +340,12 @@ void JsspParser::ProcessSdstLine(const std::string& line) {
       CHECK_EQ(declared_job_count_, words.size());
       Machine* const machine =
           problem_.mutable_machines(current_machine_index_);
-      for (const std::string& w : words) {
+      if (current_job_index_ == 0) {
+        machine->mutable_transition_time_matrix()
+            ->mutable_transition_time()
+            ->Reserve(declared_job_count_ * declared_job_count_);
+      }
+      for (const absl::string_view w : words) {
         const int64_t t = strtoint64(w);
         machine->mutable_transition_time_matrix()->add_transition_time(t);
       }
@@ -351,7 +364,7 @@ void JsspParser::ProcessSdstLine(const std::string& line) {
 }
 
 void JsspParser::ProcessTardinessLine(const std::string& line) {
-  const std::vector<std::string> words =
+  const std::vector<absl::string_view> words =
       absl::StrSplit(line, ' ', absl::SkipEmpty());
   switch (parser_state_) {
     case START: {
@@ -370,11 +383,13 @@ void JsspParser::ProcessTardinessLine(const std::string& line) {
         job->mutable_earliest_start()->set_value(est);
       }
       job->set_late_due_date(strtoint64(words[1]));
-      const double weight = std::stod(words[2]);
+      double weight;
+      CHECK(absl::SimpleAtod(words[2], &weight));
       const int64_t tardiness = static_cast<int64_t>(
           round(weight * absl::GetFlag(FLAGS_jssp_scaling_up_factor)));
       job->set_lateness_cost_per_time_unit(tardiness);
       const int num_operations = strtoint32(words[3]);
+      job->mutable_tasks()->Reserve(num_operations);
       for (int i = 0; i < num_operations; ++i) {
         const int machine_id = strtoint32(words[4 + 2 * i]) - 1;  // 1 based.
         const int64_t duration = strtoint64(words[5 + 2 * i]);
@@ -416,7 +431,7 @@ void JsspParser::ProcessTardinessLine(const std::string& line) {
 }
 
 void JsspParser::ProcessPssLine(const std::string& line) {
-  const std::vector<std::string> words =
+  const std::vector<absl::string_view> words =
       absl::StrSplit(line, ' ', absl::SkipEmpty());
   switch (parser_state_) {
     case START: {
@@ -462,10 +477,9 @@ void JsspParser::ProcessPssLine(const std::string& line) {
           transition_index_ = 0;
           for (int m = 0; m < declared_machine_count_; ++m) {
             Machine* const machine = problem_.mutable_machines(m);
-            for (int i = 0; i < declared_job_count_ * declared_job_count_;
-                 ++i) {
-              machine->mutable_transition_time_matrix()->add_transition_time(0);
-            }
+            machine->mutable_transition_time_matrix()
+                ->mutable_transition_time()
+                ->Resize(declared_job_count_ * declared_job_count_, 0);
           }
         }
       }
@@ -508,12 +522,13 @@ void JsspParser::ProcessPssLine(const std::string& line) {
 }
 
 void JsspParser::ProcessEarlyTardyLine(const std::string& line) {
-  const std::vector<std::string> words =
+  const std::vector<absl::string_view> words =
       absl::StrSplit(line, ' ', absl::SkipEmpty());
   switch (parser_state_) {
     case JOB_COUNT_READ: {
       CHECK_EQ(words.size(), declared_machine_count_ * 2 + 3);
       Job* const job = problem_.mutable_jobs(current_job_index_);
+      job->mutable_tasks()->Reserve(declared_machine_count_);
       for (int i = 0; i < declared_machine_count_; ++i) {
         const int machine_id = strtoint32(words[2 * i]);
         const int64_t duration = strtoint64(words[2 * i + 1]);
@@ -85,13 +85,14 @@ void RcpspParser::ReportError(const std::string& line) {
 void RcpspParser::SetNumDeclaredTasks(int t) {
   num_declared_tasks_ = t;
   recipe_sizes_.resize(t + 2, 0);  // The data format adds 2 sentinels.
+  rcpsp_.mutable_tasks()->Reserve(t + 2);
 }
 
 void RcpspParser::ProcessRcpspLine(const std::string& line) {
   if (absl::StartsWith(line, "***")) return;
   if (absl::StartsWith(line, "---")) return;
 
-  const std::vector<std::string> words =
+  const std::vector<absl::string_view> words =
       absl::StrSplit(line, absl::ByAnyChar(" :\t\r"), absl::SkipEmpty());
 
   if (words.empty()) return;
@@ -103,7 +104,7 @@ void RcpspParser::ProcessRcpspLine(const std::string& line) {
     }
     case HEADER_SECTION: {
       if (words[0] == "file") {
-        rcpsp_.set_basedata(words[3]);
+        rcpsp_.set_basedata(std::string(words[3]));
       } else if (words[0] == "initial") {
         rcpsp_.set_seed(strtoint64(words[4]));
         load_status_ = PROJECT_SECTION;
@@ -264,7 +265,7 @@ void RcpspParser::ProcessRcpspLine(const std::string& line) {
 }
 
 void RcpspParser::ProcessRcpspMaxLine(const std::string& line) {
-  const std::vector<std::string> words =
+  const std::vector<absl::string_view> words =
       absl::StrSplit(line, absl::ByAnyChar(" :\t[]\r"), absl::SkipEmpty());
 
   switch (load_status_) {
@@ -493,7 +494,7 @@ void RcpspParser::ProcessRcpspMaxLine(const std::string& line) {
 }
 
 void RcpspParser::ProcessPattersonLine(const std::string& line) {
-  const std::vector<std::string> words =
+  const std::vector<absl::string_view> words =
       absl::StrSplit(line, absl::ByAnyChar(" :\t[]\r"), absl::SkipEmpty());
 
   if (words.empty()) return;
@@ -560,13 +560,18 @@ class Bitset64 {
   // Sets "this" to be the intersection of "this" and "other". The
   // bitsets do not have to be the same size. If other is smaller, all
   // the higher order bits are assumed to be 0.
+  //
+  // The loops below work on raw pointers so that the compiler can keep them
+  // in registers and vectorize the word operations.
   void Intersection(const Bitset64<IndexType>& other) {
-    const int min_size = std::min(data_.size(), other.data_.size());
-    for (int i = 0; i < min_size; ++i) {
-      data_[i] &= other.data_[i];
+    const size_t min_size = std::min(data_.size(), other.data_.size());
+    uint64_t* const data = data_.data();
+    const uint64_t* const other_data = other.data_.data();
+    for (size_t i = 0; i < min_size; ++i) {
+      data[i] &= other_data[i];
     }
-    for (int i = min_size; i < data_.size(); ++i) {
-      data_[i] = 0;
+    if (min_size < data_.size()) {
+      memset(data + min_size, 0, (data_.size() - min_size) * sizeof(uint64_t));
     }
   }
 
@@ -574,10 +579,27 @@ class Bitset64 {
   // bitsets do not have to be the same size. If other is smaller, all
   // the higher order bits are assumed to be 0.
   void Union(const Bitset64<IndexType>& other) {
-    const int min_size = std::min(data_.size(), other.data_.size());
-    for (int i = 0; i < min_size; ++i) {
-      data_[i] |= other.data_[i];
+    const size_t min_size = std::min(data_.size(), other.data_.size());
+    uint64_t* const data = data_.data();
+    const uint64_t* const other_data = other.data_.data();
+    for (size_t i = 0; i < min_size; ++i) {
+      data[i] |= other_data[i];
+    }
+  }
+
+  // Returns the number of bits set in both "this" and "other", without
+  // modifying any of them. This is the same as calling Intersection() on a
+  // copy and counting its bits, but much faster. The bitsets do not have to be
+  // the same size.
+  int64_t IntersectionCount(const Bitset64<IndexType>& other) const {
+    const size_t min_size = std::min(data_.size(), other.data_.size());
+    const uint64_t* const data = data_.data();
+    const uint64_t* const other_data = other.data_.data();
+    uint64_t count = 0;
+    for (size_t i = 0; i < min_size; ++i) {
+      count += BitCount64(data[i] & other_data[i]);
     }
+    return count;
   }
 
   // Class to iterate over the bit positions at 1 of a Bitset64.
@@ -764,7 +786,13 @@ class SparseBitset {
   SparseBitset& operator=(const SparseBitset&) = delete;
   IntegerType size() const { return bitset_.size(); }
   void SparseClearAll() {
-    for (const IntegerType i : to_clear_) bitset_.ClearBucket(i);
+    // When more positions were set than there are buckets, a single memset
+    // is cheaper than the scattered writes.
+    if (to_clear_.size() * 64 > size()) {
+      bitset_.ClearAll();
+    } else {
+      for (const IntegerType i : to_clear_) bitset_.ClearBucket(i);
+    }
     to_clear_.clear();
   }
   void ClearAll() {
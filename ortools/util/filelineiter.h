@@ -27,6 +27,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <string>
 
 #include "ortools/base/file.h"
@@ -64,10 +65,10 @@ class FileLineIterator {
     if (file_ == nullptr) return;
     do {
       while (true) {
-        int i = next_position_after_eol_;
-        for (; i < buffer_size_; ++i) {
-          if (buffer_[i] == '\n') break;
-        }
+        const char* const start = buffer_ + next_position_after_eol_;
+        const char* const eol = static_cast<const char*>(
+            memchr(start, '\n', buffer_size_ - next_position_after_eol_));
+        const int i = eol == nullptr ? buffer_size_ : eol - buffer_;
         if (i == buffer_size_) {
           line_.append(&buffer_[next_position_after_eol_],
                        i - next_position_after_eol_);
@@ -100,9 +101,9 @@ class FileLineIterator {
     if (HasOption(REMOVE_INLINE_CR)) {
       line_.erase(std::remove(line_.begin(), line_.end(), '\r'), line_.end());
     }
-    const auto eol = std::find(line_.begin(), line_.end(), '\n');
-    if (!HasOption(KEEP_LINEFEED) && eol != line_.end()) {
-      line_.erase(eol);
+    // There is at most one '\n', and it is the last character.
+    if (!HasOption(KEEP_LINEFEED) && !line_.empty() && line_.back() == '\n') {
+      line_.pop_back();
     }
   }
 
@@ -23,6 +23,8 @@
 #ifndef OR_TOOLS_UTIL_INTEGER_PQ_H_
 #define OR_TOOLS_UTIL_INTEGER_PQ_H_
 
+#include <algorithm>
+#include <functional>
 #include <vector>
 
 #include "ortools/base/logging.h"
@@ -33,9 +35,18 @@ namespace operations_research {
 // Classic asjustable priority queue implementation. It behaves exactly the same
 // as AdjustablePriorityQueue regarding identical elements, but it uses less
 // memory and is in general slightly faster.
-template <typename Element, class Compare = std::less<Element>>
+//
+// The heap is kArity-ary. The default binary heap does the fewest comparisons
+// per ChangePriority() or IncreasePriority(), while a larger arity (like 4)
+// gives a shallower heap with better cache locality, which can pay off when
+// Pop() dominates. Only the order of the elements with the same priority
+// depends on kArity.
+template <typename Element, class Compare = std::less<Element>,
+          int kArity = 2>
 class IntegerPriorityQueue {
  public:
+  static_assert(kArity >= 2, "The heap arity must be at least 2.");
+
   // Starts with an empty queue and reserve space for n elements.
   explicit IntegerPriorityQueue(int n = 0, Compare comp = Compare())
       : size_(0), less_(comp) {
@@ -105,7 +116,7 @@ class IntegerPriorityQueue {
   void ChangePriority(Element element) {
     DCHECK(Contains(element.Index()));
     const int i = position_[element.Index()];
-    if (i > 1 && less_(heap_[i >> 1], element)) {
+    if (i > 1 && less_(heap_[Parent(i)], element)) {
       SetAndIncreasePriority(i, element);
     } else {
       SetAndDecreasePriority(i, element);
@@ -134,10 +145,46 @@ class IntegerPriorityQueue {
     position_[element.Index()] = i;
   }
 
+  // The heap_ starts at 1, so the children of i are in [FirstChild(i),
+  // FirstChild(i) + kArity). For kArity == 2, these are the usual 2i, 2i + 1
+  // and i / 2.
+  static int FirstChild(int i) { return kArity * (i - 1) + 2; }
+  static int Parent(int i) { return (i - 2) / kArity + 1; }
+
   // Puts the given element at heap index i and update the heap knowing that the
   // element has a priority <= than the priority of the element currently at
   // this position.
   void SetAndDecreasePriority(int i, const Element element) {
+    if constexpr (kArity == 2) {
+      SetAndDecreasePriorityInBinaryHeap(i, element);
+      return;
+    }
+    const int size = size_;
+    while (true) {
+      const int first = FirstChild(i);
+      if (first > size) break;
+
+      // Find the child with the highest priority. On ties, the first one wins.
+      int best = first;
+      Element best_element = heap_[first];
+      const int last = std::min(first + kArity - 1, size);
+      for (int child = first + 1; child <= last; ++child) {
+        const Element child_element = heap_[child];
+        if (less_(best_element, child_element)) {
+          best = child;
+          best_element = child_element;
+        }
+      }
+      if (!less_(element, best_element)) break;
+      Set(i, best_element);
+      i = best;
+    }
+    Set(i, element);
+  }
+
+  // Same as SetAndDecreasePriority() with the loop specialized for two
+  // children, so the default binary heap does not pay for the generality.
+  void SetAndDecreasePriorityInBinaryHeap(int i, const Element element) {
     const int size = size_;
     while (true) {
       const int left = i * 2;
@@ -170,7 +217,7 @@ class IntegerPriorityQueue {
   // this position.
   void SetAndIncreasePriority(int i, const Element element) {
     while (i > 1) {
-      const int parent = i >> 1;
+      const int parent = Parent(i);
       const Element parent_element = heap_[parent];
       if (!less_(parent_element, element)) break;
       Set(i, parent_element);
@@ -50,6 +50,24 @@ int FindSegmentIndex(const std::vector<PiecewiseSegment>& segments, int64_t x) {
   return position - segments.begin();
 }
 
+// Functions with at most this number of segments are searched linearly.
+constexpr int kMaxNumSegmentsForLinearSearch = 8;
+
+// Same as above, on the start points of the segments.
+int FindSegmentIndex(const std::vector<int64_t>& segment_start_x, int64_t x) {
+  const int num_segments = segment_start_x.size();
+  if (num_segments <= kMaxNumSegmentsForLinearSearch) {
+    // This loop has no branch, and is vectorized by the compiler.
+    int num_starts_before_x = 0;
+    for (int i = 0; i < num_segments; ++i) {
+      num_starts_before_x += segment_start_x[i] <= x;
+    }
+    return num_starts_before_x - 1;
+  }
+  return std::upper_bound(segment_start_x.begin(), segment_start_x.end(), x) -
+         segment_start_x.begin() - 1;
+}
+
 inline bool IsAtBounds(int64_t value) {
   return value == kint64min || value == kint64max;
 }
@@ -407,11 +425,11 @@ PiecewiseLinearFunction::CreateEarlyTardyFunctionWithSlack(
 }
 
 bool PiecewiseLinearFunction::InDomain(int64_t x) const {
-  int index = FindSegmentIndex(segments_, x);
+  const int index = FindSegmentIndex(segment_start_x_, x);
   if (index == kNotFound) {
     return false;
   }
-  if (segments_[index].end_x() < x) {
+  if (segment_end_x_[index] < x) {
     return false;
   }
   return true;
@@ -433,15 +451,37 @@ bool PiecewiseLinearFunction::IsNonIncreasing() const {
 }
 
 int64_t PiecewiseLinearFunction::Value(int64_t x) const {
-  if (!InDomain(x)) {
+  const int index = FindSegmentIndex(segment_start_x_, x);
+  if (index == kNotFound || segment_end_x_[index] < x) {
     // TODO(user): Allow the user to specify the
     // undefined value and use kint64max as the default.
     return kint64max;
   }
-  const int index = FindSegmentIndex(segments_, x);
   return segments_[index].Value(x);
 }
 
+void PiecewiseLinearFunction::Values(const std::vector<int64_t>& points,
+                                     std::vector<int64_t>* values) const {
+  values->resize(points.size());
+  const int num_segments = segment_start_x_.size();
+  int index = kNotFound;
+  for (int i = 0; i < points.size(); ++i) {
+    const int64_t x = points[i];
+    if (index == kNotFound || x < segment_start_x_[index]) {
+      index = FindSegmentIndex(segment_start_x_, x);
+    } else if (index + 1 < num_segments && segment_start_x_[index + 1] <= x) {
+      index = std::upper_bound(segment_start_x_.begin() + index + 1,
+                               segment_start_x_.end(), x) -
+              segment_start_x_.begin() - 1;
+    }
+    if (index == kNotFound || segment_end_x_[index] < x) {
+      (*values)[i] = kint64max;
+    } else {
+      (*values)[i] = segments_[index].Value(x);
+    }
+  }
+}
+
 int64_t PiecewiseLinearFunction::GetMaximum(int64_t range_start,
                                             int64_t range_end) const {
   if (IsNonDecreasing() && InDomain(range_end)) {
@@ -624,6 +664,8 @@ void PiecewiseLinearFunction::AddConstantToX(int64_t constant) {
   is_modified_ = true;
   for (int i = 0; i < segments_.size(); ++i) {
     segments_[i].AddConstantToX(constant);
+    segment_start_x_[i] = segments_[i].start_x();
+    segment_end_x_[i] = segments_[i].end_x();
   }
 }
 
@@ -690,6 +732,8 @@ void PiecewiseLinearFunction::InsertSegment(const PiecewiseSegment& segment) {
   // No intersection.
   if (segments_.empty() || segments_.back().end_x() < segment.start_x()) {
     segments_.push_back(segment);
+    segment_start_x_.push_back(segment.start_x());
+    segment_end_x_.push_back(segment.end_x());
     return;
   }
 
@@ -698,9 +742,12 @@ void PiecewiseLinearFunction::InsertSegment(const PiecewiseSegment& segment) {
     if (segments_.back().end_y() == segment.start_y() &&
         segments_.back().slope() == segment.slope()) {
       segments_.back().ExpandEnd(segment.end_x());
+      segment_end_x_.back() = segments_.back().end_x();
       return;
     }
     segments_.push_back(segment);
+    segment_start_x_.push_back(segment.start_x());
+    segment_end_x_.push_back(segment.end_x());
   }
 }
 
@@ -711,6 +758,8 @@ void PiecewiseLinearFunction::Operation(
   std::vector<PiecewiseSegment> own_segments;
   const std::vector<PiecewiseSegment>& other_segments = other.segments();
   own_segments.swap(segments_);
+  segment_start_x_.clear();
+  segment_end_x_.clear();
 
   absl::btree_set<int64_t> start_x_points;
   for (int i = 0; i < own_segments.size(); ++i) {
@@ -754,8 +803,8 @@ void PiecewiseLinearFunction::Operation(
 bool PiecewiseLinearFunction::FindSegmentIndicesFromRange(
     int64_t range_start, int64_t range_end, int* start_segment,
     int* end_segment) const {
-  *start_segment = FindSegmentIndex(segments_, range_start);
-  *end_segment = FindSegmentIndex(segments_, range_end);
+  *start_segment = FindSegmentIndex(segment_start_x_, range_start);
+  *end_segment = FindSegmentIndex(segment_start_x_, range_end);
   if (*start_segment == *end_segment) {
     if (*start_segment < 0) {
       // Given range before function's domain start.
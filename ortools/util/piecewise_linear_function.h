@@ -184,6 +184,12 @@ class PiecewiseLinearFunction {
   bool IsNonIncreasing() const;
   // Returns the value of the piecewise linear function for x.
   int64_t Value(int64_t x) const;
+  // Fills values with the value of the function for each of the points, which
+  // is kint64max outside its domain. This is faster than calling Value() on
+  // each point when the points are sorted, since the search of the segment of a
+  // point then starts from the one of the previous point.
+  void Values(const std::vector<int64_t>& points,
+              std::vector<int64_t>* values) const;
   // Returns the maximum value of all the segments in the function.
   int64_t GetMaximum() const;
   // Returns the minimum value of all the segments in the function.
@@ -263,6 +269,10 @@ class PiecewiseLinearFunction {
   // The vector of segments in the function, sorted in ascending order of start
   // points.
   std::vector<PiecewiseSegment> segments_;
+  // The start and end of segments_, stored contiguously so that finding the
+  // segment of a point does not need to read the segments themselves.
+  std::vector<int64_t> segment_start_x_;
+  std::vector<int64_t> segment_end_x_;
   bool is_modified_;
   bool is_convex_;
   bool is_non_decreasing_;
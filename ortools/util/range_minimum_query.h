@@ -34,6 +34,7 @@
 #define OR_TOOLS_UTIL_RANGE_MINIMUM_QUERY_H_
 
 #include <algorithm>
+#include <cstddef>
 #include <functional>
 #include <numeric>
 #include <utility>
@@ -59,8 +60,17 @@ class RangeMinimumQuery {
   const std::vector<T>& array() const;
 
  private:
-  // cache_[k][i] = min(arr, i, i+2^k).
-  std::vector<std::vector<T>> cache_;
+  // Returns the row of the sparse table for windows of size 2^k, that is
+  // Row(k)[i] = min(arr, i, i+2^k).
+  const T* Row(int k) const {
+    return k == 0 ? array_.data() : table_.data() + row_start_[k];
+  }
+
+  std::vector<T> array_;
+  // All the rows for k >= 1, stored contiguously in a single allocation.
+  // Row k starts at table_[row_start_[k]].
+  std::vector<T> table_;
+  std::vector<size_t> row_start_;
   Compare cmp_;
 };
 
@@ -106,18 +116,25 @@ inline RangeMinimumQuery<T, Compare>::RangeMinimumQuery(std::vector<T> array)
 template <typename T, typename Compare>
 RangeMinimumQuery<T, Compare>::RangeMinimumQuery(std::vector<T> array,
                                                  Compare cmp)
-    : cache_(MostSignificantBitPosition32(array.size()) + 1),
+    : array_(std::move(array)),
+      row_start_(MostSignificantBitPosition32(array_.size()) + 1, 0),
       cmp_(std::move(cmp)) {
-  const int array_size = array.size();
-  cache_[0] = std::move(array);
-  for (int row_idx = 1; row_idx < cache_.size(); ++row_idx) {
+  const int array_size = array_.size();
+  const int num_rows = row_start_.size();
+  size_t table_size = 0;
+  for (int row_idx = 1; row_idx < num_rows; ++row_idx) {
+    row_start_[row_idx] = table_size;
+    table_size += array_size - (1 << row_idx) + 1;
+  }
+  table_.resize(table_size);
+  for (int row_idx = 1; row_idx < num_rows; ++row_idx) {
     const int row_length = array_size - (1 << row_idx) + 1;
     const int window = 1 << (row_idx - 1);
-    cache_[row_idx].resize(row_length);
+    const T* const previous_row = Row(row_idx - 1);
+    T* const row = table_.data() + row_start_[row_idx];
     for (int col_idx = 0; col_idx < row_length; ++col_idx) {
-      cache_[row_idx][col_idx] =
-          std::min(cache_[row_idx - 1][col_idx],
-                   cache_[row_idx - 1][col_idx + window], cmp_);
+      row[col_idx] =
+          std::min(previous_row[col_idx], previous_row[col_idx + window], cmp_);
     }
   }
 }
@@ -130,13 +147,13 @@ inline T RangeMinimumQuery<T, Compare>::GetMinimumFromRange(int from,
   DCHECK_LE(to, array().size());
   const int log_diff = MostSignificantBitPosition32(to - from);
   const int window = 1 << log_diff;
-  const std::vector<T>& row = cache_[log_diff];
+  const T* const row = Row(log_diff);
   return std::min(row[from], row[to - window], cmp_);
 }
 
 template <typename T, typename Compare>
 inline const std::vector<T>& RangeMinimumQuery<T, Compare>::array() const {
-  return cache_[0];
+  return array_;
 }
 
 // RangeMinimumIndexQuery implementation
@@ -370,6 +370,12 @@ Domain Domain::IntersectionWith(const Domain& domain) const {
   Domain result;
   const auto& a = intervals_;
   const auto& b = domain.intervals_;
+  if (a.size() == 1 && b.size() == 1) {
+    const int64_t start = std::max(a[0].start, b[0].start);
+    const int64_t end = std::min(a[0].end, b[0].end);
+    if (start <= end) result.intervals_.push_back({start, end});
+    return result;
+  }
   for (int i = 0, j = 0; i < a.size() && j < b.size();) {
     if (a[i].start <= b[j].start) {
       if (a[i].end < b[j].start) {
@@ -405,13 +411,55 @@ Domain Domain::IntersectionWith(const Domain& domain) const {
   return result;
 }
 
+void Domain::IntersectInPlace(const Domain& domain) {
+  if (domain.intervals_.size() != 1) {
+    *this = IntersectionWith(domain);
+    return;
+  }
+
+  // Clip each interval to [start, end]. Since there is at most one output
+  // interval per input one, we can compact the intervals in place.
+  const int64_t start = domain.intervals_[0].start;
+  const int64_t end = domain.intervals_[0].end;
+  int new_size = 0;
+  for (const ClosedInterval& interval : intervals_) {
+    if (interval.end < start) continue;
+    if (interval.start > end) break;
+    intervals_[new_size++] = {std::max(interval.start, start),
+                              std::min(interval.end, end)};
+  }
+  intervals_.resize(new_size);
+  DCHECK(IntervalsAreSortedAndNonAdjacent(intervals_));
+}
+
 Domain Domain::UnionWith(const Domain& domain) const {
-  Domain result;
   const auto& a = intervals_;
   const auto& b = domain.intervals_;
-  result.intervals_.resize(a.size() + b.size());
-  std::merge(a.begin(), a.end(), b.begin(), b.end(), result.intervals_.begin());
-  UnionOfSortedIntervals(&result.intervals_);
+  if (a.empty()) return domain;
+  if (b.empty()) return *this;
+
+  // Merge the two sorted lists while coalescing overlapping or adjacent
+  // intervals on the fly. Unlike merging into a temporary of size
+  // a.size() + b.size(), this does not allocate when the result is a single
+  // interval.
+  Domain result;
+  auto& out = result.intervals_;
+  const auto append = [&out](const ClosedInterval& interval) {
+    if (!out.empty() && (out.back().end == kint64max ||
+                         interval.start <= out.back().end + 1)) {
+      out.back().end = std::max(out.back().end, interval.end);
+    } else {
+      out.push_back(interval);
+    }
+  };
+  int i = 0;
+  int j = 0;
+  while (i < a.size() && j < b.size()) {
+    append(b[j] < a[i] ? b[j++] : a[i++]);
+  }
+  while (i < a.size()) append(a[i++]);
+  while (j < b.size()) append(b[j++]);
+  DCHECK(IntervalsAreSortedAndNonAdjacent(out));
   return result;
 }
 
@@ -318,6 +318,13 @@ class Domain {
    */
   Domain IntersectionWith(const Domain& domain) const;
 
+  /**
+   * Same as *this = IntersectionWith(domain), but modifies D directly. When
+   * domain is a single interval, this never allocates and reuses the current
+   * storage.
+   */
+  void IntersectInPlace(const Domain& domain);
+
   /**
    * Returns the union of D and domain.
    */
@@ -117,13 +117,14 @@ std::string StatsGroup::StatString() const {
   return result;
 }
 
-TimeDistribution* StatsGroup::LookupOrCreateTimeDistribution(std::string name) {
-  TimeDistribution*& ref = time_distributions_[name];
-  if (ref == nullptr) {
-    ref = new TimeDistribution(name);
-    Register(ref);
-  }
-  return ref;
+TimeDistribution* StatsGroup::LookupOrCreateTimeDistribution(
+    absl::string_view name) {
+  const auto it = time_distributions_.find(name);
+  if (it != time_distributions_.end()) return it->second;
+  TimeDistribution* stat = new TimeDistribution(name);
+  time_distributions_.emplace(std::string(name), stat);
+  Register(stat);
+  return stat;
 }
 
 DistributionStat::DistributionStat(absl::string_view name)
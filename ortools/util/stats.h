@@ -68,6 +68,7 @@
 #ifndef OR_TOOLS_UTIL_STATS_H_
 #define OR_TOOLS_UTIL_STATS_H_
 
+#include <functional>
 #include <map>
 #include <string>
 #include <vector>
@@ -154,8 +155,9 @@ class StatsGroup {
 
   // Returns and if needed creates and registers a TimeDistribution with the
   // given name. Note that this involve a map lookup and his thus slower than
-  // directly accessing a TimeDistribution variable.
-  TimeDistribution* LookupOrCreateTimeDistribution(std::string name);
+  // directly accessing a TimeDistribution variable. The lookup does not
+  // allocate once the distribution exists.
+  TimeDistribution* LookupOrCreateTimeDistribution(absl::string_view name);
 
   // Calls Reset() on all the statistics registered with this group.
   void Reset();
@@ -164,7 +166,7 @@ class StatsGroup {
   std::string name_;
   PrintOrder print_order_ = SORT_BY_PRIORITY_THEN_VALUE;
   std::vector<Stat*> stats_;
-  std::map<std::string, TimeDistribution*> time_distributions_;
+  std::map<std::string, TimeDistribution*, std::less<>> time_distributions_;
 };
 
 // Base class to track and compute statistics about the distribution of a
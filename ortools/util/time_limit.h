@@ -311,11 +311,13 @@ class TimeLimit {
 class SharedTimeLimit {
  public:
   explicit SharedTimeLimit(TimeLimit* time_limit)
-      : time_limit_(time_limit), stopped_boolean_(false) {
-    // We use the one already registered if present or ours otherwise.
-    stopped_ = time_limit->ExternalBooleanAsLimit();
-    if (stopped_ == nullptr) {
-      stopped_ = &stopped_boolean_;
+      : time_limit_(time_limit),
+        stopped_boolean_(false),
+        // We use the one already registered if present or ours otherwise.
+        stopped_(time_limit->ExternalBooleanAsLimit() != nullptr
+                     ? time_limit->ExternalBooleanAsLimit()
+                     : &stopped_boolean_) {
+    if (stopped_ == &stopped_boolean_) {
       time_limit->RegisterExternalBooleanAsLimit(stopped_);
     }
   }
@@ -327,6 +329,10 @@ class SharedTimeLimit {
   }
 
   bool LimitReached() const {
+    // Lock-free fast path: once stopped, there is no need to contend for the
+    // mutex with the other workers.
+    if (IsStopped()) return true;
+
     // Note, time_limit_->LimitReached() is not const, and changes internal
     // state of time_limit_, hence we need a writer's lock.
     absl::MutexLock lock(&mutex_);
@@ -338,6 +344,10 @@ class SharedTimeLimit {
     *stopped_ = true;
   }
 
+  // Returns true if Stop() was called, or if the external Boolean registered
+  // on the wrapped limit is true. This never takes the mutex.
+  bool IsStopped() const { return stopped_->load(std::memory_order_relaxed); }
+
   void UpdateLocalLimit(TimeLimit* local_limit) {
     absl::MutexLock lock(&mutex_);
     local_limit->MergeWithGlobalTimeLimit(time_limit_);
@@ -368,8 +378,34 @@ class SharedTimeLimit {
  private:
   mutable absl::Mutex mutex_;
   TimeLimit* time_limit_ ABSL_GUARDED_BY(mutex_);
-  std::atomic<bool> stopped_boolean_ ABSL_GUARDED_BY(mutex_);
-  std::atomic<bool>* stopped_ ABSL_GUARDED_BY(mutex_);
+  std::atomic<bool> stopped_boolean_;
+  // Never changes after construction, so it can be read without the mutex.
+  std::atomic<bool>* const stopped_;
+};
+
+// Amortizes the calls to SharedTimeLimit::LimitReached() from a tight loop.
+// The full check, which takes the shared mutex, is only done on the first call
+// and then once every check_period calls. The other calls only read the stop
+// Boolean, so a Stop() is still seen right away. An instance must only be used
+// by one thread at a time, typically the one running a given worker.
+class SharedTimeLimitChecker {
+ public:
+  SharedTimeLimitChecker(const SharedTimeLimit* time_limit, int check_period)
+      : time_limit_(time_limit), check_period_(check_period) {}
+
+  bool LimitReached() {
+    if (limit_reached_) return true;
+    if (--num_calls_before_check_ > 0) return time_limit_->IsStopped();
+    num_calls_before_check_ = check_period_;
+    limit_reached_ = time_limit_->LimitReached();
+    return limit_reached_;
+  }
+
+ private:
+  const SharedTimeLimit* const time_limit_;
+  const int check_period_;
+  int num_calls_before_check_ = 0;
+  bool limit_reached_ = false;
 };
 
 /**